@@ -5,6 +5,7 @@
 #include <vector>
 
 #include <DynamicOutput/OutputDevice.hpp>
+#include <GUI/ConsoleLineStore.hpp>
 #include <TextEditor.h>
 #include <imgui.h>
 
@@ -15,15 +16,25 @@ namespace RC::GUI
     class Console
     {
       private:
+        constexpr static size_t maximum_num_lines = 50000;
+        constexpr static size_t maximum_num_text_bytes = 8 * 1024 * 1024;
+        // Producers drain the inbox themselves once this many messages are waiting, keeps memory bounded while the GUI isn't rendering
+        constexpr static size_t maximum_num_pending_messages = 1024;
+        // The text editor is only rebuilt from the store once it holds this many lines more than the store, evicting lines one at a time would be too slow
+        constexpr static size_t text_editor_trim_threshold = maximum_num_lines / 8;
+
         char m_input_buffer[256]{};
-        std::vector<std::string> m_lines{};
         ImGuiTextFilter m_filter{};
         float m_previous_max_scroll_y{};
         float m_current_console_output_width{};
+        ConsoleInbox m_inbox{};
+        // Guards 'm_lines', producers only ever try to lock it so they never wait on the GUI
         std::mutex m_lines_mutex{};
+        ConsoleLineStore m_lines{maximum_num_lines, maximum_num_text_bytes};
+        // Sequence number of the next line from 'm_lines' that hasn't been added to the text editor yet
+        uint64_t m_next_text_editor_sequence{};
         TextEditor m_text_editor{};
         TextEditor::Breakpoints m_breakpoints{};
-        const size_t m_maximum_num_lines{50000};
 
       public:
         Console()
@@ -39,11 +50,15 @@ namespace RC::GUI
       private:
         auto GetLanguageDefinitionNone() -> const TextEditor::LanguageDefinition&;
         auto GetPalette() const -> const TextEditor::Palette&;
+        auto drain_inbox() -> void;
+        auto add_line_to_text_editor(std::string_view line, Color::Color color) -> void;
+        auto sync_text_editor() -> void;
 
       public:
         auto render() -> void;
         auto render_search_box() -> void;
-        auto add_line(const std::string&, Color::Color) -> void;
-        auto add_line(const StringType&, Color::Color) -> void;
+        // Safe to call from any thread, text containing newlines is split into multiple lines
+        auto add_line(std::string, Color::Color) -> void;
+        auto add_line(StringViewType, Color::Color) -> void;
     };
 } // namespace RC::GUI
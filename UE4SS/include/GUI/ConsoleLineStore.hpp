@@ -0,0 +1,168 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <DynamicOutput/OutputDevice.hpp>
+
+namespace RC::GUI
+{
+    /*
+        Fixed-capacity history of console lines
+
+        Line records live in a ring and their text lives in a single circular arena
+        When either one is full, the oldest lines are evicted to make room instead of the whole history being cleared
+        Every line is given a sequence number that keeps increasing across evictions so that readers can tell which lines they've already seen
+
+        Not thread safe, the owner is expected to serialize access (see ConsoleInbox for the producer side)
+    */
+    class ConsoleLineStore
+    {
+      public:
+        struct Line
+        {
+            std::string_view text;
+            Color::Color color;
+        };
+
+      private:
+        struct LineRecord
+        {
+            uint32_t offset;
+            uint32_t size;
+            Color::Color color;
+        };
+
+      private:
+        std::vector<LineRecord> m_records{};
+        std::unique_ptr<char[]> m_text{};
+        size_t m_text_capacity{};
+        size_t m_first_record{};
+        size_t m_num_records{};
+        // Offset in the text arena right after the newest line
+        size_t m_write_offset{};
+        uint64_t m_first_sequence{};
+
+      public:
+        ConsoleLineStore(size_t max_lines, size_t max_text_bytes);
+
+      private:
+        auto evict_oldest() -> void;
+        auto find_space(size_t size) -> size_t;
+
+      public:
+        // Lines longer than the whole text arena are truncated
+        auto append(std::string_view line, Color::Color color) -> void;
+        auto clear() -> void;
+
+        auto size() const -> size_t
+        {
+            return m_num_records;
+        }
+        auto empty() const -> bool
+        {
+            return m_num_records == 0;
+        }
+        auto get_max_lines() const -> size_t
+        {
+            return m_records.size();
+        }
+        // Sequence number of the oldest line still stored
+        auto get_first_sequence() const -> uint64_t
+        {
+            return m_first_sequence;
+        }
+        // Sequence number that the next appended line will get
+        auto get_next_sequence() const -> uint64_t
+        {
+            return m_first_sequence + m_num_records;
+        }
+
+        // 0 is the oldest line
+        auto get_line(size_t index) const -> Line;
+
+        // Calls 'callable' with every stored line whose sequence number is 'first_sequence' or newer, oldest first
+        template <typename Callable>
+        auto for_each_since(uint64_t first_sequence, Callable&& callable) const -> void
+        {
+            auto index = first_sequence > m_first_sequence ? static_cast<size_t>(first_sequence - m_first_sequence) : 0;
+            for (; index < m_num_records; ++index)
+            {
+                callable(get_line(index));
+            }
+        }
+    };
+
+    /*
+        Lock-free multi-producer, single-consumer handoff for console output
+
+        Producers push whole messages without ever waiting on each other or on the consumer
+        The consumer takes every pending message with a single exchange and gets them back in the order they were pushed
+    */
+    class ConsoleInbox
+    {
+      private:
+        struct Message
+        {
+            Message* next;
+            Color::Color color;
+            std::string text;
+        };
+
+      private:
+        std::atomic<Message*> m_pending{};
+        std::atomic<size_t> m_num_pending{};
+
+      public:
+        ConsoleInbox() = default;
+        ConsoleInbox(const ConsoleInbox&) = delete;
+        auto operator=(const ConsoleInbox&) -> ConsoleInbox& = delete;
+        ~ConsoleInbox();
+
+      public:
+        // Returns the number of messages that were pending including this one
+        auto push(std::string text, Color::Color color) -> size_t;
+
+        auto get_num_pending() const -> size_t
+        {
+            return m_num_pending.load(std::memory_order_relaxed);
+        }
+
+        // SAFETY: Only one thread at a time may consume
+        template <typename Callable>
+        auto consume(Callable&& callable) -> size_t
+        {
+            auto message = m_pending.exchange(nullptr, std::memory_order_acquire);
+            if (!message)
+            {
+                return 0;
+            }
+
+            // The list is newest first, reverse it so that messages come out in the order they were pushed
+            Message* oldest_first{};
+            size_t num_messages{};
+            while (message)
+            {
+                auto next = message->next;
+                message->next = oldest_first;
+                oldest_first = message;
+                message = next;
+                ++num_messages;
+            }
+            m_num_pending.fetch_sub(num_messages, std::memory_order_relaxed);
+
+            while (oldest_first)
+            {
+                std::unique_ptr<Message> owned_message{oldest_first};
+                oldest_first = oldest_first->next;
+                callable(std::string_view{owned_message->text}, owned_message->color);
+            }
+            return num_messages;
+        }
+    };
+} // namespace RC::GUI
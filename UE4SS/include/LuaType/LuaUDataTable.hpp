@@ -44,6 +44,8 @@ namespace RC::LuaType
             EmptyTable,
             GetRowNames,
             GetAllRows,
+            GetRows,
+            ExportRows,
         };
 
         auto static prepare_to_handle(DataTableOperation, const LuaMadeSimple::Lua&) -> void;
@@ -55,6 +57,8 @@ namespace RC::LuaType
         Unreal::UScriptStruct* row_struct{};
         Unreal::FName row_struct_fname{};
         size_t row_size{};
+        // Resolved once per operation so that batch operations don't repeat the lookup for every row
+        const StaticState::PropertyValuePusherCallable* row_pusher{};
 
         FDataTableInfo(Unreal::UDataTable* table);
 
@@ -65,5 +69,13 @@ namespace RC::LuaType
         * @param lua Lua state to throw against.
         */
         void validate_row_struct(const LuaMadeSimple::Lua& lua);
+
+        /**
+        * Pushes a row to the Lua stack, either through the pusher registered for the row struct or as a plain table.
+        *
+        * @param lua Lua state to push to.
+        * @param row_data Pointer to the row data.
+        */
+        void push_row(const LuaMadeSimple::Lua& lua, Unreal::uint8* row_data) const;
     };
 }
\ No newline at end of file
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <filesystem>
+#include <vector>
+
+#include <File/File.hpp>
+
+#include <String/StringType.hpp>
+
+namespace RC::ObjectDumper
+{
+    enum class TableExportFormat
+    {
+        CSV,
+        JSON,
+    };
+
+    /*
+        Writes rows of exported values to a file in a single pass
+        Rows are passed to the file handle as they're written, it buffers them so the whole table is never held in memory
+        'end' must be called to write the end of the table, the handle flushes whatever is left when it's closed
+
+        CSV files start with a '---' row name column like the ones the engine imports, every field is quoted
+        JSON files hold one object keyed by row name, each row maps column names to values
+
+        writer.begin(column_names);
+        writer.begin_row(STR("Row_0"));
+        writer.write_value(column_names[0], STR("value"));
+        writer.end_row();
+        writer.end();
+    */
+    class TableExportWriter
+    {
+      public:
+        constexpr static size_t write_buffer_size = 0x10000;
+
+      private:
+        File::Handle m_file;
+        // The text of the row that's being written
+        StringType m_buffer{};
+        TableExportFormat m_format;
+        size_t m_num_rows{};
+        bool m_row_has_values{};
+
+      public:
+        TableExportWriter(const std::filesystem::path& file_path, TableExportFormat format);
+
+        TableExportWriter(const TableExportWriter&) = delete;
+        TableExportWriter(TableExportWriter&&) = delete;
+        auto operator=(const TableExportWriter&) -> void = delete;
+
+      public:
+        auto begin(const std::vector<StringType>& column_names) -> void;
+        auto begin_row(StringViewType row_name) -> void;
+        // Values must be written in the order of the column names passed to 'begin'
+        auto write_value(StringViewType column_name, StringViewType value) -> void;
+        auto end_row() -> void;
+        auto end() -> void;
+        auto get_num_rows() const -> size_t
+        {
+            return m_num_rows;
+        }
+
+        // Raw access for callers that produce their own row format
+        auto append(StringViewType text) -> void;
+        auto flush() -> void;
+
+      private:
+        auto write_buffer() -> void;
+        auto append_escaped(StringViewType text) -> void;
+    };
+} // namespace RC::ObjectDumper
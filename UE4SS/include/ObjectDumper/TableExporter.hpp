@@ -0,0 +1,29 @@
+#pragma once
+
+#include <filesystem>
+#include <vector>
+
+#include <ObjectDumper/TableExportWriter.hpp>
+
+#include <String/StringType.hpp>
+
+namespace RC::Unreal
+{
+    class FProperty;
+    class UStruct;
+    class UDataTable;
+} // namespace RC::Unreal
+
+namespace RC::ObjectDumper
+{
+    // The properties of a struct, resolved once so that every row can be exported with plain offset loads
+    struct StructExportLayout
+    {
+        std::vector<Unreal::FProperty*> properties{};
+        std::vector<StringType> column_names{};
+
+        explicit StructExportLayout(Unreal::UStruct* ustruct);
+    };
+
+    auto export_data_table(Unreal::UDataTable* data_table, const std::filesystem::path& file_path, TableExportFormat format) -> size_t;
+} // namespace RC::ObjectDumper
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+
+#include <File/File.hpp>
+
+namespace RC::UEGenerator
+{
+    /**
+     * Keeps track of the content hash of every file written by a generator so that subsequent runs only touch files that were added, changed or removed.
+     * The manifest is stored as a plain text file in the root of the output directory.
+     */
+    class OutputManifest
+    {
+      public:
+        constexpr static const char* manifest_file_name = "UE4SS_OutputManifest.txt";
+
+      private:
+        std::filesystem::path m_root_directory;
+        // Relative path (UTF-8, forward slashes) -> content hash
+        std::unordered_map<std::string, uint64_t> m_previous_hashes{};
+        std::unordered_map<std::string, uint64_t> m_current_hashes{};
+        // Guards the current hashes and counters, files may be tracked from multiple worker threads
+        std::mutex m_current_hashes_mutex{};
+        bool m_has_previous_manifest{};
+
+        size_t m_num_added{};
+        size_t m_num_changed{};
+        size_t m_num_unchanged{};
+        size_t m_num_removed{};
+
+      public:
+        OutputManifest(const std::filesystem::path& root_directory);
+
+        // Delete copy and move constructors and assignment operator
+        OutputManifest(const OutputManifest&) = delete;
+        OutputManifest(OutputManifest&&) = delete;
+        auto operator=(const OutputManifest&) -> void = delete;
+
+      public:
+        /**
+         * Returns whether a manifest from a previous run was found.
+         * When this is false, the caller is expected to clean up the output directory the non-incremental way.
+         */
+        auto has_previous_manifest() const -> bool
+        {
+            return m_has_previous_manifest;
+        }
+
+        /**
+         * Records the contents of a file that is about to be generated.
+         * Returns true if the file must be written to disk, and false if the file on disk is already identical.
+         * This function is thread-safe.
+         */
+        auto track_file(const std::filesystem::path& file_path, File::StringViewType contents) -> bool;
+
+        /**
+         * Deletes files that were generated by the previous run but not by this one, writes the new manifest to disk and logs a summary.
+         */
+        auto finalize() -> void;
+
+        auto static hash_contents(File::StringViewType contents) -> uint64_t;
+
+      private:
+        auto load() -> void;
+        auto make_key(const std::filesystem::path& file_path) const -> std::string;
+    };
+} // namespace RC::UEGenerator
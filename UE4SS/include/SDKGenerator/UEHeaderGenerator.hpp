@@ -8,6 +8,7 @@
 
 #include <File/File.hpp>
 #include <SDKGenerator/Common.hpp>
+#include <SDKGenerator/OutputManifest.hpp>
 #include <Helpers/String.hpp>
 #pragma warning(disable : 4005)
 #include <Unreal/NameTypes.hpp>
@@ -124,7 +125,7 @@ namespace RC::UEGenerator
         auto append_line_no_indent(const StringType& line) -> void;
         auto begin_indent_level() -> void;
         auto end_indent_level() -> void;
-        auto serialize_file_content_to_disk() -> bool;
+        auto serialize_file_content_to_disk(OutputManifest& manifest) -> bool;
 
         virtual auto has_content_to_save() const -> bool;
         virtual auto generate_file_contents() -> StringType;
@@ -234,6 +235,9 @@ namespace RC::UEGenerator
         // Storage for class defaultsubojects when populating property initializers
         std::unordered_map<StringType, StringType> m_class_subobjects;
 
+        // Content hashes of previously generated files, used to only rewrite files that changed
+        OutputManifest m_manifest;
+
       public:
         UEHeaderGenerator(const FFilePath& root_directory);
 
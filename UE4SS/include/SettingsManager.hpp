@@ -2,11 +2,13 @@
 
 #include <cstdint>
 #include <filesystem>
+#include <vector>
 
 #include <Common.hpp>
 #include <File/File.hpp>
 #include <GUI/GUI.hpp>
 #include <Input/KeyDef.hpp>
+#include <USMapGenerator/Generator.hpp>
 
 namespace RC
 {
@@ -60,6 +62,12 @@ namespace RC
             bool MakeAllConfigsEngineConfig{};
         } UHTHeaderGenerator;
 
+        struct SectionUSMapGenerator
+        {
+            OutTheShade::ECompressionMethod CompressionMethod{OutTheShade::ECompressionMethod::None};
+            int64_t CompressionLevel{19};
+        } USMapGenerator;
+
         struct SectionDebug
         {
             bool SimpleConsoleEnabled{true};
@@ -68,6 +76,8 @@ namespace RC
             float DebugGUIFontScaling{1.0};
             GUI::GfxBackend GraphicsAPI{GUI::GfxBackend::GLFW3_OpenGL3};
             GUI::RenderMode RenderMode{GUI::RenderMode::ExternalThread};
+            bool TraceInputEvents{false};
+            Input::Key BuiltinProfilerKey{Input::Key::P};
         } Debug;
 
         struct SectionCrashDump
@@ -107,10 +117,14 @@ namespace RC
         {
         } Experimental;
 
+        // Invalid values found by 'deserialize', it runs before any log device exists so UE4SSProgram logs these once the log is set up
+        std::vector<StringType> Warnings{};
+
       public:
         SettingsManager() = default;
 
       public:
-        auto deserialize(std::filesystem::path& file_name) -> void;
+        // When 'snapshot_path' isn't empty the parsed settings are cached there in binary form and reused while the file is unchanged
+        auto deserialize(std::filesystem::path& file_name, const std::filesystem::path& snapshot_path = {}) -> void;
     };
 } // namespace RC
@@ -192,6 +192,7 @@ namespace RC
         auto setup_mod_directory_path() -> void;
         auto create_simple_console() -> void;
         auto setup_unreal() -> void;
+        auto get_ini_snapshot_path(const std::filesystem::path& ini_file_path) const -> std::filesystem::path;
         auto load_unreal_offsets_from_file() -> void;
         auto share_lua_functions() -> void;
         auto on_program_start() -> void;
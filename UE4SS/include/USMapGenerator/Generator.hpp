@@ -1,6 +1,17 @@
 #pragma once
 
+#include <cstdint>
+
 namespace RC::OutTheShade
 {
+    // Compression methods defined by the .usmap format
+    enum class ECompressionMethod : uint8_t
+    {
+        None,
+        Oodle,
+        Brotli,
+        ZStandard,
+    };
+
     auto generate_usmap() -> void;
 }
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <vector>
+
+#include <USMapGenerator/Generator.hpp>
+
+namespace RC::OutTheShade
+{
+    constexpr uint16_t usmap_magic = 0x30C4;
+
+    struct USMapHeader
+    {
+        uint16_t magic{};
+        uint8_t version{};
+        ECompressionMethod compression_method{ECompressionMethod::None};
+        uint32_t compressed_size{};
+        uint32_t decompressed_size{};
+    };
+
+    // Writes the header followed by the payload, ZStandard payloads are streamed to the file in ZSTD_CStreamOutSize() chunks
+    // Only None and ZStandard are supported, throws std::runtime_error for other methods or if the file can't be written
+    auto write_usmap_file(const std::filesystem::path& path, std::span<const uint8_t> payload, ECompressionMethod compression_method, int compression_level)
+            -> void;
+
+    // Returns the decompressed payload, throws std::runtime_error if the file isn't a .usmap file that 'write_usmap_file' could have written
+    auto read_usmap_file(const std::filesystem::path& path, USMapHeader* out_header = nullptr) -> std::vector<uint8_t>;
+} // namespace RC::OutTheShade
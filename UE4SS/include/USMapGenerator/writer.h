@@ -69,6 +69,83 @@ public:
     }
 };
 
+// Growable in-memory buffer, written values can be patched later without going through a stream
+class BufferWriter : IBufferWriter
+{
+    std::vector<uint8_t> m_Buffer;
+    size_t m_Pos = 0;
+
+public:
+
+    BufferWriter(size_t InitialCapacity = 0x100000)
+    {
+        m_Buffer.reserve(InitialCapacity);
+    }
+
+    FORCEINLINE const uint8_t* GetData() const
+    {
+        return m_Buffer.data();
+    }
+
+    FORCEINLINE size_t Tell() const
+    {
+        return m_Pos;
+    }
+
+    FORCEINLINE void WriteString(std::string String) override
+    {
+        Write(String.data(), String.size());
+    }
+
+    FORCEINLINE void WriteString(std::string_view String) override
+    {
+        Write((void*)String.data(), String.size());
+    }
+
+    FORCEINLINE void Write(void* Input, size_t Size) override
+    {
+        if (m_Pos + Size > m_Buffer.size())
+        {
+            m_Buffer.resize(m_Pos + Size);
+        }
+        std::memcpy(m_Buffer.data() + m_Pos, Input, Size);
+        m_Pos += Size;
+    }
+
+    FORCEINLINE void Seek(int Pos, int Origin = SEEK_CUR) override
+    {
+        switch (Origin)
+        {
+        case SEEK_SET:
+            m_Pos = Pos;
+            break;
+        case SEEK_END:
+            m_Pos = m_Buffer.size() + Pos;
+            break;
+        default:
+            m_Pos += Pos;
+            break;
+        }
+    }
+
+    uint32_t Size() override
+    {
+        return static_cast<uint32_t>(m_Buffer.size());
+    }
+
+    template <typename T>
+    FORCEINLINE void Write(T Input)
+    {
+        Write(&Input, sizeof(T));
+    }
+
+    template <typename T>
+    FORCEINLINE void WriteAt(size_t Pos, T Input)
+    {
+        std::memcpy(m_Buffer.data() + Pos, &Input, sizeof(T));
+    }
+};
+
 class FileWriter : IBufferWriter
 {
     FILE* m_File;
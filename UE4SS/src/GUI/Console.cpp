@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <ctype.h>
 #include <memory>
 
@@ -129,7 +130,11 @@ namespace RC::GUI
 
         /**/
 
-        std::lock_guard<std::mutex> guard(m_lines_mutex);
+        {
+            std::lock_guard<std::mutex> guard(m_lines_mutex);
+            drain_inbox();
+            sync_text_editor();
+        }
         m_text_editor.Render("TextEditor", {-16.0f, -31.0f + -8.0f});
 
         ImGui_AutoScroll("TextEditor", &m_previous_max_scroll_y);
@@ -166,50 +171,70 @@ namespace RC::GUI
         throw std::runtime_error{"[LogLevel_to_ImColor] Unhandled log_level"};
     }
 
-    auto Console::add_line(const std::string& line, Color::Color color) -> void
+    auto Console::drain_inbox() -> void
+    {
+        m_inbox.consume([&](std::string_view text, Color::Color color) {
+            // Split the same way std::getline does, a trailing newline doesn't produce an empty line
+            while (!text.empty())
+            {
+                auto line_end = text.find('\n');
+                m_lines.append(text.substr(0, line_end), color);
+                if (line_end == text.npos)
+                {
+                    break;
+                }
+                text.remove_prefix(line_end + 1);
+            }
+        });
+    }
+
+    auto Console::add_line_to_text_editor(std::string_view line, Color::Color color) -> void
     {
-        std::lock_guard<std::mutex> guard(m_lines_mutex);
-        if (m_text_editor.GetTotalLines() < 0)
-        {
-            throw std::runtime_error{"Somehow we negative amount of lines in the console"};
-        }
-        if (static_cast<size_t>(m_text_editor.GetTotalLines()) >= m_maximum_num_lines)
-        {
-            m_text_editor.ClearLines();
-        }
-        if (m_lines.size() >= m_maximum_num_lines)
-        {
-            m_lines.clear();
-        }
         if (color != Color::Default && color != Color::NoColor)
         {
             m_text_editor.GetLineColorMarkers().emplace(m_text_editor.GetTotalLines() + 1, LogLevel_to_ImColor(color));
         }
-        m_lines.emplace_back(line);
-        m_text_editor.AddTextLine(line);
+        m_text_editor.AddTextLine(std::string{line});
     }
 
-    auto Console::add_line(const StringType& line, Color::Color color) -> void
+    auto Console::sync_text_editor() -> void
     {
-        auto utf8_string = to_string(line);
-        std::lock_guard<std::mutex> guard(m_lines_mutex);
-        if (m_text_editor.GetTotalLines() < 0)
+        auto next_sequence = m_lines.get_next_sequence();
+        if (m_next_text_editor_sequence == next_sequence)
         {
-            throw std::runtime_error{"Somehow we negative amount of lines in the console"};
+            return;
         }
-        if (static_cast<size_t>(m_text_editor.GetTotalLines()) >= m_maximum_num_lines)
+
+        auto first_new_sequence = std::max(m_next_text_editor_sequence, m_lines.get_first_sequence());
+        auto num_text_editor_lines = static_cast<size_t>(std::max(m_text_editor.GetTotalLines(), 0));
+        if (num_text_editor_lines + (next_sequence - first_new_sequence) > maximum_num_lines + text_editor_trim_threshold)
         {
+            // Lines evicted from the store are dropped from the text editor in batches by rebuilding it from what the store still has
             m_text_editor.ClearLines();
+            m_text_editor.GetLineColorMarkers().clear();
+            first_new_sequence = m_lines.get_first_sequence();
         }
-        if (m_lines.size() >= m_maximum_num_lines)
-        {
-            m_lines.clear();
-        }
-        if (color != Color::Default && color != Color::NoColor)
+
+        m_lines.for_each_since(first_new_sequence, [&](const ConsoleLineStore::Line& line) {
+            add_line_to_text_editor(line.text, line.color);
+        });
+        m_next_text_editor_sequence = next_sequence;
+    }
+
+    auto Console::add_line(std::string line, Color::Color color) -> void
+    {
+        if (m_inbox.push(std::move(line), color) >= maximum_num_pending_messages)
         {
-            m_text_editor.GetLineColorMarkers().emplace(m_text_editor.GetTotalLines() + 1, LogLevel_to_ImColor(color));
+            std::unique_lock<std::mutex> lock(m_lines_mutex, std::try_to_lock);
+            if (lock.owns_lock())
+            {
+                drain_inbox();
+            }
         }
-        m_lines.emplace_back(utf8_string);
-        m_text_editor.AddTextLine(utf8_string);
+    }
+
+    auto Console::add_line(StringViewType line, Color::Color color) -> void
+    {
+        add_line(to_string(line), color);
     }
 } // namespace RC::GUI
@@ -0,0 +1,101 @@
+#include <algorithm>
+#include <cstring>
+
+#include <GUI/ConsoleLineStore.hpp>
+
+namespace RC::GUI
+{
+    ConsoleLineStore::ConsoleLineStore(size_t max_lines, size_t max_text_bytes)
+        : m_records(std::max(max_lines, size_t{1})), m_text(std::make_unique<char[]>(max_text_bytes)), m_text_capacity(max_text_bytes)
+    {
+    }
+
+    auto ConsoleLineStore::evict_oldest() -> void
+    {
+        m_first_record = (m_first_record + 1) % m_records.size();
+        --m_num_records;
+        ++m_first_sequence;
+        if (m_num_records == 0)
+        {
+            m_first_record = 0;
+            m_write_offset = 0;
+        }
+    }
+
+    auto ConsoleLineStore::find_space(size_t size) -> size_t
+    {
+        while (m_num_records > 0)
+        {
+            auto oldest_offset = m_records[m_first_record].offset;
+            if (m_write_offset > oldest_offset)
+            {
+                // Live text is [oldest, write), the free space is after it and before the oldest line once wrapped around
+                if (m_text_capacity - m_write_offset >= size)
+                {
+                    return m_write_offset;
+                }
+                if (oldest_offset >= size)
+                {
+                    return 0;
+                }
+            }
+            else if (oldest_offset - m_write_offset >= size)
+            {
+                // Live text wraps around the end of the arena, the only free space is between the newest and the oldest line
+                return m_write_offset;
+            }
+            evict_oldest();
+        }
+        return 0;
+    }
+
+    auto ConsoleLineStore::append(std::string_view line, Color::Color color) -> void
+    {
+        line = line.substr(0, m_text_capacity);
+
+        if (m_num_records == m_records.size())
+        {
+            evict_oldest();
+        }
+
+        auto offset = find_space(line.size());
+        if (!line.empty())
+        {
+            std::memcpy(m_text.get() + offset, line.data(), line.size());
+        }
+        m_write_offset = offset + line.size();
+
+        auto record_index = (m_first_record + m_num_records) % m_records.size();
+        m_records[record_index] = {static_cast<uint32_t>(offset), static_cast<uint32_t>(line.size()), color};
+        ++m_num_records;
+    }
+
+    auto ConsoleLineStore::clear() -> void
+    {
+        m_first_sequence += m_num_records;
+        m_first_record = 0;
+        m_num_records = 0;
+        m_write_offset = 0;
+    }
+
+    auto ConsoleLineStore::get_line(size_t index) const -> Line
+    {
+        const auto& record = m_records[(m_first_record + index) % m_records.size()];
+        return {std::string_view{m_text.get() + record.offset, record.size}, record.color};
+    }
+
+    ConsoleInbox::~ConsoleInbox()
+    {
+        consume([](std::string_view, Color::Color) {});
+    }
+
+    auto ConsoleInbox::push(std::string text, Color::Color color) -> size_t
+    {
+        auto message = new Message{nullptr, color, std::move(text)};
+        message->next = m_pending.load(std::memory_order_relaxed);
+        while (!m_pending.compare_exchange_weak(message->next, message, std::memory_order_release, std::memory_order_relaxed))
+        {
+        }
+        return m_num_pending.fetch_add(1, std::memory_order_relaxed) + 1;
+    }
+} // namespace RC::GUI
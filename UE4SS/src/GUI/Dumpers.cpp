@@ -9,6 +9,7 @@
 #include <File/Macros.hpp>
 #include <GUI/Dumpers.hpp>
 #include <JSON/JSON.hpp>
+#include <ObjectDumper/TableExporter.hpp>
 #include <USMapGenerator/Generator.hpp>
 #ifdef TEXT
 #undef TEXT
@@ -79,37 +80,133 @@ namespace RC::GUI::Dumpers
         FMeshUVChannelInfo UVChannelData;
     };
 
-    auto generate_root_component_csv(UObject* root_component) -> StringType
+    // Properties used by the actor dumpers, resolved once per dump instead of by name for every actor
+    struct ActorDumpLayout
     {
-        StringType root_actor_buffer{};
+        FProperty* root_component_property{};
+        FProperty* class_property{};
+        FProperty* location_property{};
+        FProperty* rotation_property{};
+        FProperty* scale_property{};
+        FProperty* static_mesh_property{};
+        FProperty* static_materials_property{};
+        UClass* static_mesh_component_class{};
+
+        // Resolves what doesn't depend on the dumped actors, once before the dump starts
+        auto resolve() -> bool
+        {
+            // GameStateClass is only used for its ExportTextItem, any class property would do
+            auto game_mode_base = UObjectGlobals::FindFirstOf(STR("GameModeBase"));
+            if (!game_mode_base)
+            {
+                Output::send<LogLevel::Error>(STR("Unable to dump actors, no GameModeBase instance was found\n"));
+                return false;
+            }
+            class_property = game_mode_base->GetPropertyByNameInChain(FromCharTypePtr<TCHAR>(STR("GameStateClass")));
+            if (!class_property)
+            {
+                Output::send<LogLevel::Error>(STR("Unable to dump actors, GameModeBase has no GameStateClass property\n"));
+                return false;
+            }
+            static_mesh_component_class = UObjectGlobals::StaticFindObject<UClass*>(nullptr, nullptr, STR("/Script/Engine.StaticMeshComponent"));
+            if (!static_mesh_component_class)
+            {
+                Output::send<LogLevel::Error>(STR("Unable to dump actors, /Script/Engine.StaticMeshComponent was not found\n"));
+                return false;
+            }
+            return true;
+        }
 
-        static auto location_property = root_component->GetPropertyByNameInChain(FromCharTypePtr<TCHAR>(STR("RelativeLocation")));
-        static auto rotation_property = root_component->GetPropertyByNameInChain(FromCharTypePtr<TCHAR>(STR("RelativeRotation")));
-        static auto scale_property = root_component->GetPropertyByNameInChain(FromCharTypePtr<TCHAR>(STR("RelativeScale3D")));
+        auto resolve_for_actor(UObject* actor) -> bool
+        {
+            if (!root_component_property)
+            {
+                root_component_property = actor->GetPropertyByNameInChain(FromCharTypePtr<TCHAR>(STR("RootComponent")));
+            }
+            return root_component_property != nullptr;
+        }
 
-        auto location = root_component->GetValuePtrByPropertyNameInChain<FVector>(FromCharTypePtr<TCHAR>(STR("RelativeLocation")));
-        FString location_string{};
-        location_property->ExportTextItem(location_string, location, nullptr, nullptr, 0);
-        root_actor_buffer.append(fmt::format(STR("\"{}\","), location_string.GetCharArray()));
+        auto resolve_for_root_component(UObject* root_component) -> bool
+        {
+            if (!location_property)
+            {
+                location_property = root_component->GetPropertyByNameInChain(FromCharTypePtr<TCHAR>(STR("RelativeLocation")));
+                rotation_property = root_component->GetPropertyByNameInChain(FromCharTypePtr<TCHAR>(STR("RelativeRotation")));
+                scale_property = root_component->GetPropertyByNameInChain(FromCharTypePtr<TCHAR>(STR("RelativeScale3D")));
+            }
+            return location_property && rotation_property && scale_property;
+        }
+    };
 
-        auto rotation = root_component->GetValuePtrByPropertyNameInChain<FRotator>(FromCharTypePtr<TCHAR>(STR("RelativeRotation")));
-        FString rotation_string{};
-        rotation_property->ExportTextItem(rotation_string, rotation, nullptr, nullptr, 0);
-        root_actor_buffer.append(fmt::format(STR("\"{}\","), rotation_string.GetCharArray()));
+    static auto write_exported_property(ObjectDumper::TableExportWriter& writer, FProperty* property, const void* value, StringViewType prefix, StringViewType suffix)
+            -> void
+    {
+        FString value_string{};
+        property->ExportTextItem(value_string, value, nullptr, nullptr, 0);
+        writer.append(prefix);
+        if (value_string.GetCharArray())
+        {
+            writer.append(value_string.GetCharArray());
+        }
+        writer.append(suffix);
+    }
 
-        auto scale = root_component->GetValuePtrByPropertyNameInChain<FVector>(FromCharTypePtr<TCHAR>(STR("RelativeScale3D")));
-        FString scale_string{};
-        scale_property->ExportTextItem(scale_string, scale, nullptr, nullptr, 0);
-        root_actor_buffer.append(fmt::format(STR("\"{}\","), scale_string.GetCharArray()));
+    static auto write_root_component_csv(ObjectDumper::TableExportWriter& writer, ActorDumpLayout& layout, UObject* root_component) -> void
+    {
+        write_exported_property(writer, layout.location_property, layout.location_property->ContainerPtrToValuePtr<void>(root_component), STR("\""), STR("\","));
+        write_exported_property(writer, layout.rotation_property, layout.rotation_property->ContainerPtrToValuePtr<void>(root_component), STR("\""), STR("\","));
+        write_exported_property(writer, layout.scale_property, layout.scale_property->ContainerPtrToValuePtr<void>(root_component), STR("\""), STR("\","));
+    }
 
-        return root_actor_buffer;
+    template <typename StaticMaterialType>
+    static auto write_static_materials_csv(ObjectDumper::TableExportWriter& writer, const TArray<StaticMaterialType>& materials) -> void
+    {
+        if (materials.GetData())
+        {
+            writer.append(STR("Materials=("));
+        }
+        for (auto [material, material_index] : materials | views::enumerate)
+        {
+            if (const UObject* material_interface = material.MaterialInterface; material_interface)
+            {
+                auto material_full_name = material_interface->GetOuterPrivate()->GetFullName();
+                const auto material_type_space_location = material_full_name.find(STR(" "));
+                if (material_type_space_location == material_full_name.npos)
+                {
+                    Output::send<LogLevel::Warning>(STR("SKIPPING MATERIAL! Was unable to find space in full material name in component: '{}'.\n"),
+                                                    material_full_name);
+                }
+                else
+                {
+                    auto material_typeless_name = StringViewType{material_full_name}.substr(material_type_space_location + 1);
+
+                    writer.append(material_interface->GetClassPrivate()->GetName());
+                    writer.append(STR("'\"\""));
+                    writer.append(material_typeless_name);
+                    writer.append(STR("\"\"'"));
+                }
+            }
+
+            if (material_index + 1 < materials.Num())
+            {
+                writer.append(STR(","));
+            }
+            else
+            {
+                writer.append(STR(")"));
+            }
+        }
     }
 
-    static auto generate_actors_csv_file(UClass* dump_actor_class) -> StringType
+    static auto generate_actors_csv_file(UClass* dump_actor_class, ObjectDumper::TableExportWriter& writer) -> size_t
     {
-        StringType file_buffer{};
+        writer.append(STR("---,Actor,Location,Rotation,Scale,Meshes\n"));
 
-        file_buffer.append(STR("---,Actor,Location,Rotation,Scale,Meshes\n"));
+        ActorDumpLayout layout{};
+        if (!layout.resolve())
+        {
+            return 0;
+        }
 
         size_t actor_count{};
         FindObjectSearcher(dump_actor_class, AnySuperStruct::StaticClass()).ForEach([&](UObject* object) {
@@ -119,34 +216,35 @@ namespace RC::GUI::Dumpers
             }
 
             auto actor = static_cast<AActor*>(object);
-
-            auto root_component = actor->GetValuePtrByPropertyNameInChain<UObject*>(FromCharTypePtr<TCHAR>(STR("RootComponent")));
-            if (!root_component || !*root_component)
+            if (!layout.resolve_for_actor(actor))
             {
                 return LoopAction::Continue;
             }
 
-            StringType actor_buffer{};
-
-            actor_buffer.append(fmt::format(STR("Row_{},"), actor_count));
+            auto root_component = *layout.root_component_property->ContainerPtrToValuePtr<UObject*>(actor);
+            if (!root_component || !layout.resolve_for_root_component(root_component))
+            {
+                return LoopAction::Continue;
+            }
 
-            static auto game_mode_base = UObjectGlobals::FindFirstOf(STR("GameModeBase"));
-            static auto class_property = game_mode_base->GetPropertyByNameInChain(FromCharTypePtr<TCHAR>(STR("GameStateClass")));
-            FString actor_class_string{};
-            class_property->ExportTextItem(actor_class_string, &actor->GetClassPrivate(), nullptr, nullptr, 0);
-            actor_buffer.append(fmt::format(STR("{},"), actor_class_string.GetCharArray()));
+            writer.append(fmt::format(STR("Row_{},"), actor_count));
+            write_exported_property(writer, layout.class_property, &actor->GetClassPrivate(), STR(""), STR(","));
 
             // TODO: build system to handle other types of components - possibly including a way to specify which components to dump and which properties are important via a config file
-            actor_buffer.append(generate_root_component_csv(*root_component));
-            actor_buffer.append(STR("\""));
-            static auto static_mesh_component_class = UObjectGlobals::StaticFindObject<UClass*>(nullptr, nullptr, STR("/Script/Engine.StaticMeshComponent"));
-            const auto& static_mesh_components = actor->K2_GetComponentsByClass(static_mesh_component_class);
+            write_root_component_csv(writer, layout, root_component);
+            writer.append(STR("\""));
+            const auto& static_mesh_components = actor->K2_GetComponentsByClass(layout.static_mesh_component_class);
             if (static_mesh_components.Num() > 0)
             {
-                actor_buffer.append(STR("("));
+                writer.append(STR("("));
                 for (auto [static_mesh_component_ptr, static_mesh_component_index] : static_mesh_components | views::enumerate)
                 {
-                    const auto mesh = *static_mesh_component_ptr->GetValuePtrByPropertyNameInChain<UObject*>(FromCharTypePtr<TCHAR>(STR("StaticMesh")));
+                    if (!layout.static_mesh_property)
+                    {
+                        layout.static_mesh_property = static_mesh_component_ptr->GetPropertyByNameInChain(FromCharTypePtr<TCHAR>(STR("StaticMesh")));
+                    }
+
+                    const auto mesh = *layout.static_mesh_property->ContainerPtrToValuePtr<UObject*>(static_mesh_component_ptr);
                     if (!mesh)
                     {
                         Output::send<LogLevel::Warning>(STR("SKIPPING COMPONENT! StaticMeshComponent '{}' has no mesh.\n"),
@@ -154,95 +252,39 @@ namespace RC::GUI::Dumpers
                         continue;
                     }
 
-                    static auto mesh_property = static_mesh_component_ptr->GetPropertyByNameInChain(FromCharTypePtr<TCHAR>(STR("StaticMesh")));
-                    FString mesh_string{};
-                    mesh_property->ExportTextItem(mesh_string, &mesh, nullptr, nullptr, 0);
-                    actor_buffer.append(fmt::format(STR("(StaticMesh={}',"), mesh_string.GetCharArray()));
-
-                    auto materials_for_each_body = [&](const UObject* material_interface) {
-                        if (material_interface)
-                        {
-                            auto material_full_name = material_interface->GetOuterPrivate()->GetFullName();
-                            const auto material_type_space_location = material_full_name.find(STR(" "));
-                            if (material_type_space_location == material_full_name.npos)
-                            {
-                                Output::send<LogLevel::Warning>(STR("SKIPPING MATERIAL! Was unable to find space in full material name in component: '{}'.\n"),
-                                                                material_full_name);
-                                return;
-                            }
-
-                            if (material_type_space_location > static_cast<unsigned long long>(std::numeric_limits<long long>::max()))
-                            {
-                                throw std::runtime_error{"integer overflow when converting material_type_space_location signed\n"};
-                            }
-                            auto material_typeless_name = StringViewType{material_full_name.begin() + static_cast<long long>(material_type_space_location) + 1,
-                                                                         material_full_name.end()};
-
-                            actor_buffer.append(fmt::format(STR("{}'"), material_interface->GetClassPrivate()->GetName()));
-                            actor_buffer.append(fmt::format(STR("\"\"{}"), material_typeless_name));
-                            actor_buffer.append(STR("\"\"'"));
-                        }
-                    };
+                    write_exported_property(writer, layout.static_mesh_property, &mesh, STR("(StaticMesh="), STR("',"));
+
+                    if (!layout.static_materials_property)
+                    {
+                        layout.static_materials_property = mesh->GetPropertyByNameInChain(FromCharTypePtr<TCHAR>(STR("StaticMaterials")));
+                    }
 
                     if (Version::IsAtMost(4, 19))
                     {
-                        const auto materials =
-                                *mesh->GetValuePtrByPropertyName<TArray<FStaticMaterial_419AndBelow>>(FromCharTypePtr<TCHAR>(STR("StaticMaterials")));
-                        if (materials.GetData())
-                        {
-                            actor_buffer.append(STR("Materials=("));
-                        }
-                        for (auto [material, material_index] : materials | views::enumerate)
-                        {
-                            materials_for_each_body(material.MaterialInterface);
-                            if (material_index + 1 < materials.Num())
-                            {
-                                actor_buffer.append(STR(","));
-                            }
-                            else
-                            {
-                                actor_buffer.append(STR(")"));
-                            }
-                        }
+                        write_static_materials_csv(writer,
+                                                   *layout.static_materials_property->ContainerPtrToValuePtr<TArray<FStaticMaterial_419AndBelow>>(mesh));
                     }
                     else
                     {
-                        const auto& materials =
-                                *mesh->GetValuePtrByPropertyName<TArray<FStaticMaterial_420AndAbove>>(FromCharTypePtr<TCHAR>(STR("StaticMaterials")));
-                        if (materials.GetData())
-                        {
-                            actor_buffer.append(STR("Materials=("));
-                        }
-                        for (auto [material, material_index] : materials | views::enumerate)
-                        {
-                            materials_for_each_body(material.MaterialInterface);
-                            if (material_index + 1 < materials.Num())
-                            {
-                                actor_buffer.append(STR(","));
-                            }
-                            else
-                            {
-                                actor_buffer.append(STR(")"));
-                            }
-                        }
+                        write_static_materials_csv(writer,
+                                                   *layout.static_materials_property->ContainerPtrToValuePtr<TArray<FStaticMaterial_420AndAbove>>(mesh));
                     }
-                    actor_buffer.append(STR(")"));
+                    writer.append(STR(")"));
 
                     if (static_mesh_component_index + 1 < static_mesh_components.Num())
                     {
-                        actor_buffer.append(STR(","));
+                        writer.append(STR(","));
                     }
                 }
-                actor_buffer.append(STR(")"));
+                writer.append(STR(")"));
             }
-            actor_buffer.append(STR("\"\n"));
-            file_buffer.append(actor_buffer);
+            writer.append(STR("\"\n"));
 
             ++actor_count;
             return LoopAction::Continue;
         });
 
-        return file_buffer;
+        return actor_count;
     }
 
     static auto generate_actors_json_file(UClass* class_to_dump) -> StringType
@@ -312,28 +354,22 @@ namespace RC::GUI::Dumpers
     {
         Output::send(STR("Dumping CSV of all loaded static mesh actors, positions and mesh properties\n"));
         static auto dump_actor_class = UObjectGlobals::StaticFindObject<UClass*>(nullptr, nullptr, STR("/Script/Engine.StaticMeshActor"));
-        StringType file_buffer{};
-        file_buffer.append(generate_actors_csv_file(dump_actor_class));
-        auto file =
-                File::open(fmt::format(STR("{}\\{}-ue4ss_static_mesh_data.csv"), UE4SSProgram::get_program().get_working_directory(), long(std::time(nullptr))),
-                           File::OpenFor::Writing,
-                           File::OverwriteExistingFile::Yes,
-                           File::CreateIfNonExistent::Yes);
-        file.write_string_to_file(file_buffer);
-        Output::send(STR("Finished dumping CSV of all loaded static mesh actors, positions and mesh properties\n"));
+        ObjectDumper::TableExportWriter writer{
+                fmt::format(STR("{}\\{}-ue4ss_static_mesh_data.csv"), UE4SSProgram::get_program().get_working_directory(), long(std::time(nullptr))),
+                ObjectDumper::TableExportFormat::CSV};
+        auto actor_count = generate_actors_csv_file(dump_actor_class, writer);
+        writer.end();
+        Output::send(STR("Finished dumping CSV of all loaded static mesh actors, positions and mesh properties ({} actors)\n"), actor_count);
     }
 
     void call_generate_all_actor_file()
     {
         Output::send(STR("Dumping CSV of all loaded actor types, positions and mesh properties\n"));
-        StringType file_buffer{};
-        file_buffer.append(generate_actors_csv_file(AActor::StaticClass()));
-        auto file = File::open(fmt::format(STR("{}\\{}-ue4ss_actor_data.csv"), UE4SSProgram::get_program().get_working_directory(), long(std::time(nullptr))),
-                               File::OpenFor::Writing,
-                               File::OverwriteExistingFile::Yes,
-                               File::CreateIfNonExistent::Yes);
-        file.write_string_to_file(file_buffer);
-        Output::send(STR("Finished dumping CSV of all loaded actor types, positions and mesh properties\n"));
+        ObjectDumper::TableExportWriter writer{fmt::format(STR("{}\\{}-ue4ss_actor_data.csv"), UE4SSProgram::get_program().get_working_directory(), long(std::time(nullptr))),
+                                               ObjectDumper::TableExportFormat::CSV};
+        auto actor_count = generate_actors_csv_file(AActor::StaticClass(), writer);
+        writer.end();
+        Output::send(STR("Finished dumping CSV of all loaded actor types, positions and mesh properties ({} actors)\n"), actor_count);
     }
 
     auto render() -> void
@@ -26,6 +26,7 @@
 #include <GUI/UFunctionCallerWidget.hpp>
 #include <Helpers/String.hpp>
 #include <JSON/JSON.hpp>
+#include <JSON/Dom.hpp>
 #include <JSON/Parser/Parser.hpp>
 #include <UE4SSProgram.hpp>
 #include <Unreal/AActor.hpp>
@@ -389,16 +390,16 @@ namespace RC::GUI
     }
 
     template <typename T>
-    static auto json_array_to_filters_list(JSON::Array& json_array, std::vector<T>& list, StringType type, std::string& internal_value) -> void
+    static auto json_array_to_filters_list(JSON::Dom::Array& json_array, std::vector<T>& list, StringType type, std::string& internal_value) -> void
     {
         list.clear();
         internal_value.clear();
-        json_array.for_each([&](JSON::Value& item) {
-            if (!item.is<JSON::String>())
+        json_array.for_each([&](JSON::Dom::Value& item) {
+            if (!item.is<JSON::Dom::String>())
             {
                 throw std::runtime_error{fmt::format("Invalid {} in 'filters.meta.json'", to_string(type))};
             }
-            list.emplace_back(item.as<JSON::String>()->get_view());
+            list.emplace_back(item.as<JSON::Dom::String>()->get_view());
             return LoopAction::Continue;
         });
         for (const auto& class_name : list)
@@ -425,65 +426,65 @@ namespace RC::GUI
                                           File::OpenFor::Reading,
                                           File::OverwriteExistingFile::No,
                                           File::CreateIfNonExistent::Yes);
-        auto json_file_contents = json_file.read_all();
-        if (json_file_contents.empty())
+        auto json_file_view = json_file.read_all_view();
+        if (json_file_view.empty())
         {
             return;
         }
 
-        const auto json_global_object = JSON::Parser::parse(json_file_contents);
-        const auto& json_filters = json_global_object->get<JSON::Array>(STR("Filters"));
-        json_filters.for_each([&](const JSON::Value& filter) {
-            if (!filter.is<JSON::Object>())
+        const auto json_global_object = JSON::Dom::parse(std::move(json_file_view));
+        const auto& json_filters = json_global_object->get<JSON::Dom::Array>(STR("Filters"));
+        json_filters.for_each([&](const JSON::Dom::Value& filter) {
+            if (!filter.is<JSON::Dom::Object>())
             {
                 throw std::runtime_error{"Invalid filter in 'filters.meta.json'"};
             }
-            auto& json_object = *filter.as<JSON::Object>();
-            auto filter_name = json_object.get<JSON::String>(STR("FilterName")).get_view();
-            auto& filter_data = json_object.get<JSON::Object>(STR("FilterData"));
+            auto& json_object = *filter.as<JSON::Dom::Object>();
+            auto filter_name = json_object.get<JSON::Dom::String>(STR("FilterName")).get_view();
+            auto& filter_data = json_object.get<JSON::Dom::Object>(STR("FilterData"));
 
             if (filter_name == STR("IncludeInheritance"))
             {
-                LiveView::s_include_inheritance = filter_data.get<JSON::Bool>(STR("Enabled")).get();
+                LiveView::s_include_inheritance = filter_data.get<JSON::Dom::Bool>(STR("Enabled")).get();
             }
             else if (filter_name == STR("UseRegexForSearch"))
             {
-                LiveView::s_use_regex_for_search = filter_data.get<JSON::Bool>(STR("Enabled")).get();
+                LiveView::s_use_regex_for_search = filter_data.get<JSON::Dom::Bool>(STR("Enabled")).get();
             }
             else if (filter_name == STR("ApplySearchFiltersWhenNotSearching"))
             {
-                LiveView::s_apply_search_filters_when_not_searching = filter_data.get<JSON::Bool>(STR("Enabled")).get();
+                LiveView::s_apply_search_filters_when_not_searching = filter_data.get<JSON::Dom::Bool>(STR("Enabled")).get();
             }
             else if (filter_name == Filter::DefaultObjectsOnly::s_debug_name)
             {
-                Filter::DefaultObjectsOnly::s_enabled = filter_data.get<JSON::Bool>(STR("Enabled")).get();
+                Filter::DefaultObjectsOnly::s_enabled = filter_data.get<JSON::Dom::Bool>(STR("Enabled")).get();
             }
             else if (filter_name == Filter::IncludeDefaultObjects::s_debug_name)
             {
-                Filter::IncludeDefaultObjects::s_enabled = filter_data.get<JSON::Bool>(STR("Enabled")).get();
+                Filter::IncludeDefaultObjects::s_enabled = filter_data.get<JSON::Dom::Bool>(STR("Enabled")).get();
             }
             else if (filter_name == Filter::InstancesOnly::s_debug_name)
             {
-                Filter::InstancesOnly::s_enabled = filter_data.get<JSON::Bool>(STR("Enabled")).get();
+                Filter::InstancesOnly::s_enabled = filter_data.get<JSON::Dom::Bool>(STR("Enabled")).get();
             }
             else if (filter_name == Filter::NonInstancesOnly::s_debug_name)
             {
-                Filter::NonInstancesOnly::s_enabled = filter_data.get<JSON::Bool>(STR("Enabled")).get();
+                Filter::NonInstancesOnly::s_enabled = filter_data.get<JSON::Dom::Bool>(STR("Enabled")).get();
             }
             else if (filter_name == Filter::ClassNamesFilter::s_debug_name)
             {
-                Filter::ClassNamesFilter::b_is_exclude = filter_data.get<JSON::Bool>(STR("IsExclude")).get();
-                auto& class_names = filter_data.get<JSON::Array>(STR("ClassNames"));
+                Filter::ClassNamesFilter::b_is_exclude = filter_data.get<JSON::Dom::Bool>(STR("IsExclude")).get();
+                auto& class_names = filter_data.get<JSON::Dom::Array>(STR("ClassNames"));
                 json_array_to_filters_list(class_names, Filter::ClassNamesFilter::list_class_names, STR("class name"), Filter::ClassNamesFilter::s_internal_class_names);
             }
             else if (filter_name == Filter::HasProperty::s_debug_name)
             {
-                auto& properties = filter_data.get<JSON::Array>(STR("Properties"));
+                auto& properties = filter_data.get<JSON::Dom::Array>(STR("Properties"));
                 json_array_to_filters_list(properties, Filter::HasProperty::list_properties, STR("property"), Filter::HasProperty::s_internal_properties);
             }
             else if (filter_name == Filter::HasPropertyType::s_debug_name)
             {
-                auto& property_types = filter_data.get<JSON::Array>(STR("PropertyTypes"));
+                auto& property_types = filter_data.get<JSON::Dom::Array>(STR("PropertyTypes"));
                 json_array_to_filters_list(property_types,
                                            Filter::HasPropertyType::list_property_types,
                                            STR("property type"),
@@ -491,19 +492,19 @@ namespace RC::GUI
             }
             else if (filter_name == Filter::FunctionParamFlags::s_debug_name)
             {
-                Filter::FunctionParamFlags::s_include_return_property = filter_data.get<JSON::Bool>(STR("IncludeReturnProperty")).get();
+                Filter::FunctionParamFlags::s_include_return_property = filter_data.get<JSON::Dom::Bool>(STR("IncludeReturnProperty")).get();
                 Filter::FunctionParamFlags::s_checkboxes.fill(false);
-                auto& function_param_flags = filter_data.get<JSON::Array>(STR("FunctionParamFlags"));
-                if (function_param_flags.get().size() != Filter::FunctionParamFlags::s_checkboxes.size())
+                auto& function_param_flags = filter_data.get<JSON::Dom::Array>(STR("FunctionParamFlags"));
+                if (function_param_flags.size() != Filter::FunctionParamFlags::s_checkboxes.size())
                 {
                     throw std::runtime_error{"Invalid number of function param flag entires in 'filters.meta.json'"};
                 }
-                function_param_flags.for_each([](auto index, JSON::Value& flag) {
-                    if (!flag.is<JSON::Bool>())
+                function_param_flags.for_each([](auto index, JSON::Dom::Value& flag) {
+                    if (!flag.is<JSON::Dom::Bool>())
                     {
                         throw std::runtime_error{"Invalid flag in 'filters.meta.json'"};
                     }
-                    Filter::FunctionParamFlags::s_checkboxes[index] = flag.as<JSON::Bool>()->get();
+                    Filter::FunctionParamFlags::s_checkboxes[index] = flag.as<JSON::Dom::Bool>()->get();
                     return LoopAction::Continue;
                 });
             }
@@ -613,31 +614,30 @@ namespace RC::GUI
         auto legacy_root_directory_path =
                 StringType{UE4SSProgram::get_program().get_legacy_root_directory()} + fmt::format(STR("\\watches\\watches.meta.json"));
 
-        StringType json_file_contents;
         bool is_legacy = !std::filesystem::exists(working_directory_path) && std::filesystem::exists(legacy_root_directory_path);
         auto json_file = File::open(is_legacy ? legacy_root_directory_path : working_directory_path,
                                     File::OpenFor::Reading,
                                     File::OverwriteExistingFile::No,
                                     File::CreateIfNonExistent::Yes);
-
-        if (json_file_contents.empty())
+        auto json_file_view = json_file.read_all_view();
+        if (json_file_view.empty())
         {
             return;
         }
 
-        auto json_global_object = JSON::Parser::parse(json_file_contents);
-        const auto& elements = json_global_object->get<JSON::Array>(STR("Watches"));
-        elements.for_each([](JSON::Value& element) {
-            if (!element.is<JSON::Object>())
+        auto json_global_object = JSON::Dom::parse(std::move(json_file_view));
+        const auto& elements = json_global_object->get<JSON::Dom::Array>(STR("Watches"));
+        elements.for_each([](JSON::Dom::Value& element) {
+            if (!element.is<JSON::Dom::Object>())
             {
                 throw std::runtime_error{"Invalid watch in 'watches.meta.json'"};
             }
-            auto& json_watch_object = *element.as<JSON::Object>();
-            auto acquisition_id = json_watch_object.get<JSON::String>(STR("AcquisitionID")).get_view();
-            auto property_name = json_watch_object.get<JSON::String>(STR("PropertyName")).get_view();
+            auto& json_watch_object = *element.as<JSON::Dom::Object>();
+            auto acquisition_id = json_watch_object.get<JSON::Dom::String>(STR("AcquisitionID")).get_view();
+            auto property_name = json_watch_object.get<JSON::Dom::String>(STR("PropertyName")).get_view();
             auto acquisition_method =
-                    static_cast<LiveView::Watch::AcquisitionMethod>(json_watch_object.get<JSON::Number>(STR("AcquisitionMethod")).get<int64_t>());
-            auto watch_type = static_cast<LiveView::Watch::Type>(json_watch_object.get<JSON::Number>(STR("WatchType")).get<int64_t>());
+                    static_cast<LiveView::Watch::AcquisitionMethod>(json_watch_object.get<JSON::Dom::Number>(STR("AcquisitionMethod")).get<int64_t>());
+            auto watch_type = static_cast<LiveView::Watch::Type>(json_watch_object.get<JSON::Dom::Number>(STR("WatchType")).get<int64_t>());
 
             UObject* object{};
             switch (acquisition_method)
@@ -2783,8 +2783,7 @@ namespace RC::GUI
             render_flags<ClassFlagsStringifier>(as_class, "ClassFlags");
             // Note: We must check to make sure that ClassCastFlags is not missing entirely because it was not previously dumped from UVTD.
             // TODO: Potentially remove if we're ever sure all custom configs are updated to include this.
-            static auto offset = as_class->MemberOffsets.find(STR("ClassCastFlags"));
-            if (offset != as_class->MemberOffsets.end())
+            if (UClass::MemberOffsets.contains(STR("ClassCastFlags")))
             {
                 render_flags<ClassCastFlagsStringifier>(as_class, "ClassCastFlags");
             }
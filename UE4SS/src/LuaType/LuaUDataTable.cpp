@@ -1,4 +1,6 @@
+#include <Helpers/String.hpp>
 #include <LuaType/LuaUDataTable.hpp>
+#include <ObjectDumper/TableExporter.hpp>
 #include <Unreal/Engine/UDataTable.hpp>
 #include <Unreal/UObject.hpp>
 #include <Unreal/UClass.hpp>
@@ -192,6 +194,18 @@ namespace RC::LuaType
                            return 1;
                        });
 
+        table.add_pair("GetRows",
+                       [](const LuaMadeSimple::Lua& lua) -> int {
+                           prepare_to_handle(DataTableOperation::GetRows, lua);
+                           return 1;
+                       });
+
+        table.add_pair("ExportRows",
+                       [](const LuaMadeSimple::Lua& lua) -> int {
+                           prepare_to_handle(DataTableOperation::ExportRows, lua);
+                           return 1;
+                       });
+
         table.add_pair("ForEachRow",
                        [](const LuaMadeSimple::Lua& lua) -> int {
                            UDataTable& lua_object = lua.get_userdata<UDataTable>();
@@ -216,25 +230,7 @@ namespace RC::LuaType
                                lua.set_string(to_string(Pair.Key.ToString()));
 
                                // Push row data as second parameter
-                               PusherParams pusher_params{
-                                       .operation = LuaMadeSimple::Type::Operation::GetParam,
-                                       .lua = lua,
-                                       .base = nullptr,
-                                       .data = Pair.Value,
-                                       .property = nullptr
-                               };
-
-                               // Check if we have a pusher for the row struct type
-                               Unreal::int32 comparison_index = static_cast<Unreal::int32>(info.row_struct_fname.GetComparisonIndex());
-                               if (StaticState::m_property_value_pushers.contains(comparison_index))
-                               {
-                                   StaticState::m_property_value_pushers[comparison_index](pusher_params);
-                               }
-                               else
-                               {
-                                   // Use the helper function for struct conversion
-                                   convert_struct_to_lua_table(lua, info.row_struct, Pair.Value, true, nullptr);
-                               }
+                               info.push_row(lua, Pair.Value);
 
                                // Call function with row name and row data
                                lua.call_function(2, 0);
@@ -393,24 +389,7 @@ namespace RC::LuaType
 
                 // Add row data
                 row_table.add_key("Data");
-
-                Unreal::int32 comparison_index = static_cast<Unreal::int32>(info.row_struct_fname.GetComparisonIndex());
-                if (StaticState::m_property_value_pushers.contains(comparison_index))
-                {
-                    PusherParams pusher_params{
-                            .operation = LuaMadeSimple::Type::Operation::GetParam,
-                            .lua = lua,
-                            .base = nullptr,
-                            .data = Pair.Value,
-                            .property = nullptr
-                    };
-                    StaticState::m_property_value_pushers[comparison_index](pusher_params);
-                }
-                else
-                {
-                    // Use the helper function for struct conversion
-                    convert_struct_to_lua_table(lua, info.row_struct, Pair.Value, true, nullptr);
-                }
+                info.push_row(lua, Pair.Value);
                 row_table.fuse_pair();
 
                 // Now make row_table local and fuse it into main table
@@ -421,6 +400,78 @@ namespace RC::LuaType
             lua_table.make_local();
             break;
         }
+        case DataTableOperation::GetRows: {
+            info.validate_row_struct(lua);
+
+            // Optional parameter: array of row names to fetch, all rows are returned if omitted
+            std::vector<Unreal::FName> requested_rows{};
+            if (lua.is_table())
+            {
+                lua.for_each_in_table([&](const LuaMadeSimple::LuaTableReference& table) {
+                    if (table.value.is_string())
+                    {
+                        requested_rows.emplace_back(ensure_str(table.value.get_string()).c_str(), Unreal::FNAME_Add);
+                    }
+                    return false;
+                });
+            }
+
+            auto lua_table = lua.prepare_new_table();
+            if (requested_rows.empty())
+            {
+                for (const auto& Pair : data_table->GetRowMap())
+                {
+                    lua_table.add_key(to_string(Pair.Key.ToString()).c_str());
+                    info.push_row(lua, Pair.Value);
+                    lua_table.fuse_pair();
+                }
+            }
+            else
+            {
+                for (const auto& row_name : requested_rows)
+                {
+                    Unreal::uint8* row_data = data_table->FindRowUnchecked(row_name);
+                    if (!row_data)
+                    {
+                        continue;
+                    }
+
+                    lua_table.add_key(to_string(row_name.ToString()).c_str());
+                    info.push_row(lua, row_data);
+                    lua_table.fuse_pair();
+                }
+            }
+
+            lua_table.make_local();
+            break;
+        }
+        case DataTableOperation::ExportRows: {
+            info.validate_row_struct(lua);
+
+            if (!lua.is_string())
+            {
+                lua.throw_error("ExportRows expects a file path as the first parameter");
+            }
+            auto file_path = ensure_str(lua.get_string());
+
+            auto format = ObjectDumper::TableExportFormat::CSV;
+            if (lua.is_string())
+            {
+                auto format_string = ensure_str(lua.get_string());
+                if (String::iequal(format_string, STR("JSON")))
+                {
+                    format = ObjectDumper::TableExportFormat::JSON;
+                }
+                else if (!String::iequal(format_string, STR("CSV")))
+                {
+                    lua.throw_error("ExportRows expects 'CSV' or 'JSON' as the second parameter");
+                }
+            }
+
+            auto num_rows = ObjectDumper::export_data_table(data_table, file_path, format);
+            lua.set_integer(static_cast<int64_t>(num_rows));
+            break;
+        }
         }
     }
 
@@ -433,6 +484,12 @@ namespace RC::LuaType
             {
                 row_struct_fname = row_struct->GetClassPrivate()->GetNamePrivate();
                 row_size = row_struct->GetSize();
+
+                auto pusher = StaticState::m_property_value_pushers.find(static_cast<Unreal::int32>(row_struct_fname.GetComparisonIndex()));
+                if (pusher != StaticState::m_property_value_pushers.end())
+                {
+                    row_pusher = &pusher->second;
+                }
             }
         }
     }
@@ -444,4 +501,24 @@ namespace RC::LuaType
             lua.throw_error("DataTable has no RowStruct specified");
         }
     }
-}
\ No newline at end of file
+
+    void FDataTableInfo::push_row(const LuaMadeSimple::Lua& lua, Unreal::uint8* row_data) const
+    {
+        if (row_pusher)
+        {
+            PusherParams pusher_params{
+                    .operation = LuaMadeSimple::Type::Operation::GetParam,
+                    .lua = lua,
+                    .base = nullptr,
+                    .data = row_data,
+                    .property = nullptr
+            };
+            (*row_pusher)(pusher_params);
+        }
+        else
+        {
+            // Use the helper function for struct conversion
+            convert_struct_to_lua_table(lua, row_struct, row_data, true, nullptr);
+        }
+    }
+}
@@ -0,0 +1,131 @@
+#include <JSON/Escape.hpp>
+#include <ObjectDumper/TableExportWriter.hpp>
+
+namespace RC::ObjectDumper
+{
+    TableExportWriter::TableExportWriter(const std::filesystem::path& file_path, TableExportFormat format)
+        : m_file(File::open(file_path, File::OpenFor::Writing, File::OverwriteExistingFile::Yes, File::CreateIfNonExistent::Yes)), m_format(format)
+    {
+        m_file.set_write_buffer_size(write_buffer_size);
+    }
+
+    auto TableExportWriter::write_buffer() -> void
+    {
+        // The file layer refuses to write empty strings
+        if (m_buffer.empty())
+        {
+            return;
+        }
+        m_file.write_string_to_file(m_buffer);
+        m_buffer.clear();
+    }
+
+    auto TableExportWriter::append(StringViewType text) -> void
+    {
+        m_buffer.append(text);
+        write_buffer();
+    }
+
+    auto TableExportWriter::flush() -> void
+    {
+        write_buffer();
+        m_file.flush();
+    }
+
+    auto TableExportWriter::append_escaped(StringViewType text) -> void
+    {
+        if (m_format == TableExportFormat::CSV)
+        {
+            // Every field is quoted, quotes inside the field are doubled
+            m_buffer.push_back(STR('"'));
+            for (auto c : text)
+            {
+                if (c == STR('"'))
+                {
+                    m_buffer.push_back(STR('"'));
+                }
+                m_buffer.push_back(c);
+            }
+            m_buffer.push_back(STR('"'));
+            return;
+        }
+
+        JSON::append_escaped(m_buffer, text);
+    }
+
+    auto TableExportWriter::begin(const std::vector<StringType>& column_names) -> void
+    {
+        if (m_format == TableExportFormat::CSV)
+        {
+            // '---' is the row name column header used by the engine's own CSV importer
+            m_buffer.append(STR("---"));
+            for (const auto& column_name : column_names)
+            {
+                m_buffer.push_back(STR(','));
+                append_escaped(column_name);
+            }
+            m_buffer.push_back(STR('\n'));
+        }
+        else
+        {
+            m_buffer.push_back(STR('{'));
+        }
+        write_buffer();
+    }
+
+    auto TableExportWriter::begin_row(StringViewType row_name) -> void
+    {
+        m_row_has_values = false;
+        if (m_format == TableExportFormat::CSV)
+        {
+            append_escaped(row_name);
+        }
+        else
+        {
+            if (m_num_rows > 0)
+            {
+                m_buffer.push_back(STR(','));
+            }
+            // Rows are keyed by name so that a column can't collide with the row name
+            m_buffer.append(STR("\n  "));
+            append_escaped(row_name);
+            m_buffer.append(STR(":{"));
+        }
+    }
+
+    auto TableExportWriter::write_value(StringViewType column_name, StringViewType value) -> void
+    {
+        if (m_format == TableExportFormat::CSV)
+        {
+            m_buffer.push_back(STR(','));
+            append_escaped(value);
+        }
+        else
+        {
+            if (m_row_has_values)
+            {
+                m_buffer.push_back(STR(','));
+            }
+            m_row_has_values = true;
+            append_escaped(column_name);
+            m_buffer.push_back(STR(':'));
+            append_escaped(value);
+        }
+    }
+
+    auto TableExportWriter::end_row() -> void
+    {
+        m_buffer.push_back(m_format == TableExportFormat::CSV ? STR('\n') : STR('}'));
+        ++m_num_rows;
+        write_buffer();
+    }
+
+    auto TableExportWriter::end() -> void
+    {
+        if (m_format == TableExportFormat::JSON)
+        {
+            m_buffer.append(STR("\n}\n"));
+        }
+        flush();
+    }
+} // namespace RC::ObjectDumper
@@ -0,0 +1,66 @@
+#include <DynamicOutput/DynamicOutput.hpp>
+#include <ObjectDumper/TableExporter.hpp>
+
+#pragma warning(disable : 4005)
+#include <Unreal/Engine/UDataTable.hpp>
+#include <Unreal/FProperty.hpp>
+#include <Unreal/FString.hpp>
+#include <Unreal/UScriptStruct.hpp>
+#include <Unreal/UStruct.hpp>
+#pragma warning(default : 4005)
+
+namespace RC::ObjectDumper
+{
+    using namespace Unreal;
+
+    StructExportLayout::StructExportLayout(UStruct* ustruct)
+    {
+        if (!ustruct)
+        {
+            return;
+        }
+
+        for (FProperty* property : ustruct->ForEachPropertyInChain())
+        {
+            properties.emplace_back(property);
+            column_names.emplace_back(property->GetName());
+        }
+    }
+
+    // Exports 'property' of the row at 'row_data' as text, 'value_buffer' is scratch storage reused for every value of a table
+    static auto export_value(StringType& value_buffer, FProperty* property, const void* row_data) -> StringViewType
+    {
+        FString value_string{};
+        auto value_ptr = static_cast<const uint8_t*>(row_data) + property->GetOffset_Internal();
+        property->ExportTextItem(value_string, value_ptr, nullptr, nullptr, 0);
+        value_buffer.assign(value_string.GetCharArray() ? StringViewType{value_string.GetCharArray()} : StringViewType{});
+        return value_buffer;
+    }
+
+    auto export_data_table(UDataTable* data_table, const std::filesystem::path& file_path, TableExportFormat format) -> size_t
+    {
+        if (!data_table || !data_table->GetRowStruct())
+        {
+            Output::send<LogLevel::Warning>(STR("Unable to export DataTable, it's null or has no row struct\n"));
+            return 0;
+        }
+
+        const StructExportLayout layout{data_table->GetRowStruct()};
+
+        TableExportWriter writer{file_path, format};
+        StringType value_buffer{};
+        writer.begin(layout.column_names);
+        for (const auto& row : data_table->GetRowMap())
+        {
+            writer.begin_row(row.Key.ToString());
+            for (size_t i = 0; i < layout.properties.size(); ++i)
+            {
+                writer.write_value(layout.column_names[i], export_value(value_buffer, layout.properties[i], row.Value));
+            }
+            writer.end_row();
+        }
+        writer.end();
+
+        return writer.get_num_rows();
+    }
+} // namespace RC::ObjectDumper
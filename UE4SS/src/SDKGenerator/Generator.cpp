@@ -1,10 +1,15 @@
+#include <algorithm>
+#include <atomic>
 #include <cwctype>
 #include <format>
+#include <future>
 #include <locale>
 #include <set>
+#include <thread>
 
 #include <SDKGenerator/Common.hpp>
 #include <SDKGenerator/Generator.hpp>
+#include <SDKGenerator/OutputManifest.hpp>
 #include <UE4SSProgram.hpp>
 #pragma warning(disable : 4005)
 #include <DynamicOutput/DynamicOutput.hpp>
@@ -74,10 +79,10 @@ namespace RC::UEGenerator
         std::vector<File::StringType> ordered_primary_file_contents;
         std::vector<File::StringType> ordered_secondary_file_contents;
         File::StringType package_name;
-        File::Handle primary_file;
-        File::Handle secondary_file;
         bool primary_file_has_no_contents;
         bool secondary_file_has_no_contents;
+        // Filled by 'discover_class', in the order that the classes were found in
+        std::vector<ObjectInfo*> classes_to_generate{};
     };
 
     auto generate_tab(size_t num_tabs = 1) -> File::StringType
@@ -125,6 +130,7 @@ namespace RC::UEGenerator
       private:
         T specification{};
         const std::filesystem::path m_directory_to_generate_in;
+        OutputManifest m_manifest;
 
       public:
         struct FileName
@@ -139,70 +145,129 @@ namespace RC::UEGenerator
 
       public:
         TypeGenerator() = delete;
-        TypeGenerator(const std::filesystem::path directory_to_generate_in) : m_directory_to_generate_in(directory_to_generate_in)
+        TypeGenerator(const std::filesystem::path directory_to_generate_in)
+            : m_directory_to_generate_in(directory_to_generate_in), m_manifest(directory_to_generate_in)
         {
             m_files.reserve(512);
         }
 
-        auto create_all_files() -> void
+        auto write_file_if_changed(const std::filesystem::path& file_path, const File::StringType& file_contents) -> void
         {
-            Output::send(STR("Creating all files...\n"));
-            for (auto& [comparison_index, generated_file] : m_files)
+            if (!m_manifest.track_file(file_path, file_contents))
             {
-                if (!generated_file.ordered_primary_file_contents.empty())
-                {
-                    generated_file.primary_file =
-                            File::open(generated_file.primary_file_name, File::OpenFor::Appending, File::OverwriteExistingFile::Yes, File::CreateIfNonExistent::Yes);
+                return;
+            }
 
-                    specification.generate_file_header(generated_file);
+            auto file = File::open(file_path, File::OpenFor::Writing, File::OverwriteExistingFile::Yes, File::CreateIfNonExistent::Yes);
+            file.write_string_to_file(file_contents);
+            file.close();
+        }
 
-                    sort_files(generated_file.ordered_primary_file_contents);
+        struct FileCreationResult
+        {
+            bool has_empty_primary_contents{};
+            bool has_empty_secondary_contents{};
+        };
 
-                    File::StringType combined_file_contents;
-                    for (auto& line : generated_file.ordered_primary_file_contents)
-                    {
-                        combined_file_contents.append(line);
-                    }
+        auto create_file(GeneratedFile& generated_file) -> FileCreationResult
+        {
+            FileCreationResult result{};
 
-                    if (combined_file_contents.empty())
-                    {
-                        Output::send(STR("Empty primary file contents in '{}'\n"), generated_file.package_name);
-                    }
-                    else
-                    {
-                        generated_file.primary_file.write_string_to_file(combined_file_contents);
-                    }
+            if (!generated_file.ordered_primary_file_contents.empty())
+            {
+                File::StringType combined_file_contents;
+                specification.generate_file_header(generated_file, combined_file_contents);
 
-                    specification.generate_file_footer(generated_file);
+                sort_files(generated_file.ordered_primary_file_contents);
 
-                    generated_file.primary_file.close();
+                bool has_contents{};
+                for (auto& line : generated_file.ordered_primary_file_contents)
+                {
+                    has_contents = has_contents || !line.empty();
+                    combined_file_contents.append(line);
                 }
+                result.has_empty_primary_contents = !has_contents;
 
-                if (!generated_file.ordered_secondary_file_contents.empty())
+                specification.generate_file_footer(generated_file, combined_file_contents);
+
+                write_file_if_changed(generated_file.primary_file_name, combined_file_contents);
+            }
+
+            if (!generated_file.ordered_secondary_file_contents.empty())
+            {
+                sort_files(generated_file.ordered_secondary_file_contents);
+
+                File::StringType combined_file_contents;
+                for (auto& line : generated_file.ordered_secondary_file_contents)
                 {
-                    generated_file.secondary_file =
-                            File::open(generated_file.secondary_file_name, File::OpenFor::Appending, File::OverwriteExistingFile::Yes, File::CreateIfNonExistent::Yes);
+                    combined_file_contents.append(line);
+                }
 
-                    sort_files(generated_file.ordered_secondary_file_contents);
+                if (combined_file_contents.empty())
+                {
+                    result.has_empty_secondary_contents = true;
+                }
+                else
+                {
+                    write_file_if_changed(generated_file.secondary_file_name, combined_file_contents);
+                }
+            }
 
-                    File::StringType combined_file_contents;
-                    for (auto& line : generated_file.ordered_secondary_file_contents)
-                    {
-                        combined_file_contents.append(line);
-                    }
+            return result;
+        }
 
-                    if (combined_file_contents.empty())
-                    {
-                        Output::send(STR("Empty secondary file contents in '{}'\n"), generated_file.package_name);
-                    }
-                    else
-                    {
-                        generated_file.secondary_file.write_string_to_file(combined_file_contents);
-                    }
+        auto create_all_files() -> void
+        {
+            Output::send(STR("Generating and creating all files...\n"));
+
+            // Every class and its dependencies were discovered at this point, so each file can be generated, sorted, combined and written independently
+            // The files are ordered by package name so that the log output is identical between runs
+            std::vector<GeneratedFile*> files_to_create{};
+            files_to_create.reserve(m_files.size());
+            for (auto& [comparison_index, generated_file] : m_files)
+            {
+                files_to_create.emplace_back(&generated_file);
+            }
+            std::sort(files_to_create.begin(), files_to_create.end(), [](const GeneratedFile* a, const GeneratedFile* b) {
+                return a->package_name < b->package_name;
+            });
 
-                    generated_file.secondary_file.close();
+            std::vector<FileCreationResult> results(files_to_create.size());
+            std::atomic<size_t> next_file_index{};
+            auto worker = [&] {
+                for (size_t file_index = next_file_index++; file_index < files_to_create.size(); file_index = next_file_index++)
+                {
+                    generate_classes(*files_to_create[file_index]);
+                    results[file_index] = create_file(*files_to_create[file_index]);
                 }
+            };
+
+            size_t num_threads = std::clamp<size_t>(std::thread::hardware_concurrency(), 1, files_to_create.size() == 0 ? 1 : files_to_create.size());
+            std::vector<std::future<void>> worker_threads;
+            for (size_t thread_id = 1; thread_id < num_threads; ++thread_id)
+            {
+                worker_threads.emplace_back(std::async(std::launch::async, worker));
             }
+            worker();
+            for (auto& worker_thread : worker_threads)
+            {
+                // Rethrows any exception that happened on the worker
+                worker_thread.get();
+            }
+
+            for (size_t file_index = 0; file_index < files_to_create.size(); ++file_index)
+            {
+                if (results[file_index].has_empty_primary_contents)
+                {
+                    Output::send(STR("Empty primary file contents in '{}'\n"), files_to_create[file_index]->package_name);
+                }
+                if (results[file_index].has_empty_secondary_contents)
+                {
+                    Output::send(STR("Empty secondary file contents in '{}'\n"), files_to_create[file_index]->package_name);
+                }
+            }
+
+            m_manifest.finalize();
         }
 
         auto sort_files(std::vector<File::StringType>& content) -> void
@@ -279,42 +344,28 @@ namespace RC::UEGenerator
 
         auto check_ignore_forward_declaration(const ObjectInfo& owner, XProperty* return_property) -> bool
         {
+            UObject* property_class{};
             if (return_property->IsA<FStructProperty>())
             {
                 // Can StructProperty even be forward declared ? I don't know if it's ever a pointer to a struct
-                UScriptStruct* script_struct = static_cast<FStructProperty*>(return_property)->GetStruct();
-                if (m_classes_dumped.contains(script_struct))
-                {
-                    auto& property_class_info = m_classes_dumped[script_struct];
-                    if (property_class_info.first_encountered_at)
-                    {
-                        return property_class_info.first_encountered_at->object == owner.object;
-                    }
-                }
+                property_class = static_cast<FStructProperty*>(return_property)->GetStruct();
             }
             else if (return_property->IsA<FClassProperty>())
             {
                 // Can ClassProperty be forward declared ? Maybe ?
-                UClass* meta_class = static_cast<FClassProperty*>(return_property)->GetMetaClass();
-                if (m_classes_dumped.contains(meta_class))
-                {
-                    auto& property_class_info = m_classes_dumped[meta_class];
-                    if (property_class_info.first_encountered_at)
-                    {
-                        return property_class_info.first_encountered_at->object == owner.object;
-                    }
-                }
+                property_class = static_cast<FClassProperty*>(return_property)->GetMetaClass();
             }
             else if (return_property->IsA<FObjectProperty>())
             {
-                UClass* property_class = static_cast<FObjectProperty*>(return_property)->GetPropertyClass();
-                if (m_classes_dumped.contains(property_class))
+                property_class = static_cast<FObjectProperty*>(return_property)->GetPropertyClass();
+            }
+
+            // Called while classes are generated in parallel, so only 'find' is used
+            if (auto it = m_classes_dumped.find(property_class); property_class && it != m_classes_dumped.end())
+            {
+                if (it->second.first_encountered_at)
                 {
-                    auto& property_class_info = m_classes_dumped[property_class];
-                    if (property_class_info.first_encountered_at)
-                    {
-                        return property_class_info.first_encountered_at->object == owner.object;
-                    }
+                    return it->second.first_encountered_at->object == owner.object;
                 }
             }
             return false;
@@ -364,60 +415,73 @@ namespace RC::UEGenerator
             out_current_class_content.append(current_class_content);
         }
 
-        auto generate_class_dependency(ObjectInfo& owner, UStruct* inherited_class, File::StringType& current_class_content) -> void
+        // Registers the class and, depth first, every class that it depends on
+        // This is the only part of the generation that adds to m_classes_dumped and m_files, so it runs before the classes are generated in parallel
+        auto discover_class(ObjectInfo& object_info, GeneratedFile& generated_file) -> void
         {
-            if (!inherited_class)
+            generated_file.classes_to_generate.emplace_back(&object_info);
+
+            UStruct* native_class = static_cast<UStruct*>(object_info.object);
+            if (!specification.should_generate_class(native_class))
             {
                 return;
             }
+            generated_file.primary_file_has_no_contents = false;
 
-            if (!m_classes_dumped.contains(inherited_class))
+            // Same order as the specifications use the dependencies in, it decides which class a dependency is first encountered at
+            discover_class_dependency(object_info, native_class->GetSuperStruct());
+            for (XProperty* property : native_class->ForEachProperty())
+            {
+                discover_class_dependencies_from_property(object_info, property);
+            }
+            for (UFunction* function : native_class->ForEachFunction())
+            {
+                discover_class_dependencies_from_function(object_info, function);
+            }
+            for (XProperty* property : native_class->ForEachProperty())
             {
-                GeneratedFile* package_file_for_inherited_class = generate_package_if_non_existent(inherited_class);
-                if (package_file_for_inherited_class)
+                if (property->IsA<FDelegateProperty>())
                 {
-                    auto& inherited_object_info = m_classes_dumped.emplace(inherited_class, ObjectInfo{inherited_class, &owner}).first->second;
-                    File::StringType new_class_content{};
-                    generate_class(inherited_object_info, *package_file_for_inherited_class, new_class_content);
-                    if (!package_file_for_inherited_class->primary_file_has_no_contents)
-                    {
-                        package_file_for_inherited_class->ordered_primary_file_contents.push_back(new_class_content);
-                    }
+                    discover_class_dependencies_from_function(object_info, static_cast<FDelegateProperty*>(property)->GetSignatureFunction());
+                }
+                else if (property->IsA<FMulticastInlineDelegateProperty>())
+                {
+                    discover_class_dependencies_from_function(object_info, static_cast<FMulticastInlineDelegateProperty*>(property)->GetSignatureFunction());
+                }
+                else if (property->IsA<FMulticastSparseDelegateProperty>())
+                {
+                    discover_class_dependencies_from_function(object_info, static_cast<FMulticastSparseDelegateProperty*>(property)->GetSignatureFunction());
                 }
-
-                return;
             }
         }
 
-        auto generate_class_dependency_from_property(ObjectInfo& owner, XProperty* property, File::StringType& current_class_content) -> bool
+        auto discover_class_dependency(ObjectInfo& owner, UStruct* inherited_class) -> void
         {
-            if (property->IsA<FStructProperty>())
+            if (!inherited_class || m_classes_dumped.contains(inherited_class))
             {
-                generate_class_dependency(owner, static_cast<FStructProperty*>(property)->GetStruct(), current_class_content);
-                return false;
+                return;
             }
-            else if (property->IsA<FClassProperty>())
+
+            GeneratedFile* package_file_for_inherited_class = generate_package_if_non_existent(inherited_class);
+            if (package_file_for_inherited_class)
             {
-                // return generate_class_dependency(owner, static_cast<XClassProperty*>(property)->get_meta_class());
-                return false;
+                auto& inherited_object_info = m_classes_dumped.emplace(inherited_class, ObjectInfo{inherited_class, &owner}).first->second;
+                discover_class(inherited_object_info, *package_file_for_inherited_class);
             }
-            else if (property->IsA<FObjectProperty>())
+        }
+
+        auto discover_class_dependencies_from_property(ObjectInfo& owner, XProperty* property) -> void
+        {
+            if (property->IsA<FStructProperty>())
             {
-                // return generate_class_dependency(owner, static_cast<XObjectProperty*>(property)->get_property_class());
-                return true;
+                discover_class_dependency(owner, static_cast<FStructProperty*>(property)->GetStruct());
             }
             else if (property->IsA<FArrayProperty>())
             {
-                // return generate_class_dependency_from_property(owner, static_cast<XArrayProperty*>(property)->get_inner());
-                // if (static_cast<XArrayProperty*>(property)->get_inner()->is_child_of<XObjectProperty>())
-                //{
-                //     return true;
-                // }
                 XProperty* inner = static_cast<FArrayProperty*>(property)->GetInner();
                 if (inner->IsA<FStructProperty>())
                 {
-                    generate_class_dependency(owner, static_cast<FStructProperty*>(inner)->GetStruct(), current_class_content);
-                    return false;
+                    discover_class_dependency(owner, static_cast<FStructProperty*>(inner)->GetStruct());
                 }
             }
             else if (property->IsA<FMapProperty>())
@@ -427,21 +491,35 @@ namespace RC::UEGenerator
 
                 if (key_property->IsA<FStructProperty>())
                 {
-                    generate_class_dependency(owner, static_cast<FStructProperty*>(key_property)->GetStruct(), current_class_content);
+                    discover_class_dependency(owner, static_cast<FStructProperty*>(key_property)->GetStruct());
                 }
 
                 if (value_property->IsA<FStructProperty>())
                 {
-                    generate_class_dependency(owner, static_cast<FStructProperty*>(value_property)->GetStruct(), current_class_content);
+                    discover_class_dependency(owner, static_cast<FStructProperty*>(value_property)->GetStruct());
                 }
+            }
+        }
 
-                return false;
+        auto discover_class_dependencies_from_function(ObjectInfo& owner, UFunction* function) -> void
+        {
+            for (XProperty* param : function->ForEachProperty())
+            {
+                if (param->HasAnyPropertyFlags(Unreal::CPF_Parm | Unreal::CPF_ReturnParm))
+                {
+                    discover_class_dependencies_from_property(owner, param);
+                }
             }
+        }
 
-            return false;
+        // Object properties are pointers, so their classes can be forward declared
+        // Class properties can't, and struct, array and map properties have their struct dependencies defined by 'discover_class'
+        auto should_forward_declare(XProperty* property) -> bool
+        {
+            return property->IsA<FObjectProperty>() && !property->IsA<FClassProperty>();
         }
 
-        auto make_function_info(ObjectInfo& owner, UFunction* function, File::StringType& current_class_content) -> FunctionInfo
+        auto make_function_info(ObjectInfo& owner, UFunction* function) -> FunctionInfo
         {
             FunctionInfo function_info{
                     .function = function,
@@ -455,22 +533,25 @@ namespace RC::UEGenerator
                     continue;
                 }
 
-                function_info.params.emplace_back(PropertyInfo{param, generate_class_dependency_from_property(owner, param, current_class_content)});
+                function_info.params.emplace_back(PropertyInfo{param, should_forward_declare(param)});
             }
 
             return function_info;
         }
 
-        auto generate_class(ObjectInfo object_info, GeneratedFile& generated_file, File::StringType& current_class_content) -> XProperty*
+        // Only reads m_classes_dumped, so that every file's classes can be generated on a different thread
+        auto generate_classes(GeneratedFile& generated_file) -> void
         {
-            UStruct* native_class = static_cast<UStruct*>(object_info.object);
-            if (specification.should_generate_class(native_class))
+            for (ObjectInfo* object_info : generated_file.classes_to_generate)
             {
-                generated_file.primary_file_has_no_contents = false;
-                specification.generate_class(this, object_info, generated_file, current_class_content);
+                UStruct* native_class = static_cast<UStruct*>(object_info->object);
+                if (specification.should_generate_class(native_class))
+                {
+                    File::StringType class_content{};
+                    specification.generate_class(this, *object_info, generated_file, class_content);
+                    generated_file.ordered_primary_file_contents.push_back(std::move(class_content));
+                }
             }
-
-            return native_class->GetFirstProperty();
         }
 
         auto generate_enum(UObject* native_object, GeneratedFile& generated_file) -> void
@@ -576,8 +657,6 @@ namespace RC::UEGenerator
                         .ordered_primary_file_contents = {},
                         .ordered_secondary_file_contents = {},
                         .package_name = package_name,
-                        .primary_file = {},
-                        .secondary_file = {},
                         .primary_file_has_no_contents = true,
                         .secondary_file_has_no_contents = true,
                 };
@@ -612,8 +691,15 @@ namespace RC::UEGenerator
       public:
         auto generate() -> void
         {
-            Output::send(STR("Cleaning up old SDK files...\n"));
-            cleanup_old_sdk();
+            if (m_manifest.has_previous_manifest())
+            {
+                Output::send(STR("Found output manifest, only changed files will be written\n"));
+            }
+            else
+            {
+                Output::send(STR("Cleaning up old SDK files...\n"));
+                cleanup_old_sdk();
+            }
             Output::send(STR("Generating SDK...\n"));
 
             // 400k should be enough for most games, and it's highly unlikely to cause more than one reallocation even if the game is huge
@@ -643,12 +729,7 @@ namespace RC::UEGenerator
                 {
                     // Generate a class for this object
                     auto& object_info = m_classes_dumped.emplace(object, ObjectInfo{object}).first->second;
-                    File::StringType class_content{};
-                    generate_class(object_info, *package_file, class_content);
-                    if (!package_file->primary_file_has_no_contents)
-                    {
-                        package_file->ordered_primary_file_contents.push_back(class_content);
-                    }
+                    discover_class(object_info, *package_file);
                     ++num_objects_generated;
 
                     return LoopAction::Continue;
@@ -671,20 +752,19 @@ namespace RC::UEGenerator
         {
             return STR(".hpp");
         }
-        auto generate_file_header(GeneratedFile& generated_file) -> void
+        auto generate_file_header(GeneratedFile& generated_file, File::StringType& content_buffer) -> void
         {
-            generated_file.primary_file.write_string_to_file(
+            content_buffer.append(
                     fmt::format(STR("#ifndef UE4SS_SDK_{}_HPP\n#define UE4SS_SDK_{}_HPP\n\n"), generated_file.package_name, generated_file.package_name));
 
             if (!generated_file.secondary_file_has_no_contents)
             {
-                generated_file.primary_file.write_string_to_file(
-                        fmt::format(STR("#include \"{}\"\n\n"), ensure_str(generated_file.secondary_file_name.filename())));
+                content_buffer.append(fmt::format(STR("#include \"{}\"\n\n"), ensure_str(generated_file.secondary_file_name.filename())));
             }
         }
-        auto generate_file_footer(GeneratedFile& generated_file) -> void
+        auto generate_file_footer(GeneratedFile& generated_file, File::StringType& content_buffer) -> void
         {
-            generated_file.primary_file.write_string_to_file(fmt::format(STR("#endif\n")));
+            content_buffer.append(STR("#endif\n"));
         }
         auto generate_enum_declaration(File::StringType& content_buffer, UEnum* uenum) -> void
         {
@@ -731,33 +811,18 @@ namespace RC::UEGenerator
 
             UStruct* inherits_from_class = native_class->GetSuperStruct();
 
-            // Make sure that the base class is defined
-            generator->generate_class_dependency(object_info, inherits_from_class, current_class_content);
-
-            // If any properties have dependencies, make sure that they are defined
+            // The base class and the types of the properties were already generated by 'TypeGenerator::discover_class'
             // This makes sure that we don't have member variables with undefined types (if the types are local, otherwise we need to include the file that the struct exists in)
             std::vector<PropertyInfo> properties_to_generate{};
             for (XProperty* property : native_class->ForEachProperty())
             {
-                properties_to_generate.emplace_back(
-                        PropertyInfo{property, generator->generate_class_dependency_from_property(object_info, property, current_class_content)});
+                properties_to_generate.emplace_back(PropertyInfo{property, generator->should_forward_declare(property)});
             }
 
             std::vector<FunctionInfo> functions_to_generate{};
             for (UFunction* function : native_class->ForEachFunction())
             {
-                auto& function_info = functions_to_generate.emplace_back(FunctionInfo{function, object_info});
-
-                for (XProperty* param : function->ForEachProperty())
-                {
-                    if (!param->HasAnyPropertyFlags(Unreal::CPF_Parm | Unreal::CPF_ReturnParm))
-                    {
-                        continue;
-                    }
-
-                    function_info.params.emplace_back(
-                            PropertyInfo{param, generator->generate_class_dependency_from_property(object_info, param, current_class_content)});
-                }
+                functions_to_generate.emplace_back(generator->make_function_info(object_info, function));
             }
 
             auto class_name = generate_class_name(native_class);
@@ -793,9 +858,7 @@ namespace RC::UEGenerator
                 if (property->IsA<FDelegateProperty>())
                 {
                     generator->generate_function_declaration(object_info,
-                                                             generator->make_function_info(object_info,
-                                                                                           static_cast<FDelegateProperty*>(property)->GetSignatureFunction(),
-                                                                                           current_class_content),
+                                                             generator->make_function_info(object_info, static_cast<FDelegateProperty*>(property)->GetSignatureFunction()),
                                                              generated_file,
                                                              content_buffer,
                                                              IsDelegateFunction::Yes);
@@ -804,9 +867,7 @@ namespace RC::UEGenerator
                 {
                     generator->generate_function_declaration(
                             object_info,
-                            generator->make_function_info(object_info,
-                                                          static_cast<FMulticastInlineDelegateProperty*>(property)->GetSignatureFunction(),
-                                                          current_class_content),
+                            generator->make_function_info(object_info, static_cast<FMulticastInlineDelegateProperty*>(property)->GetSignatureFunction()),
                             generated_file,
                             content_buffer,
                             IsDelegateFunction::Yes);
@@ -815,9 +876,7 @@ namespace RC::UEGenerator
                 {
                     generator->generate_function_declaration(
                             object_info,
-                            generator->make_function_info(object_info,
-                                                          static_cast<FMulticastSparseDelegateProperty*>(property)->GetSignatureFunction(),
-                                                          current_class_content),
+                            generator->make_function_info(object_info, static_cast<FMulticastSparseDelegateProperty*>(property)->GetSignatureFunction()),
                             generated_file,
                             content_buffer,
                             IsDelegateFunction::Yes);
@@ -1082,11 +1141,11 @@ namespace RC::UEGenerator
         {
             return STR(".lua");
         }
-        auto generate_file_header(GeneratedFile& generated_file) -> void
+        auto generate_file_header(GeneratedFile& generated_file, File::StringType& content_buffer) -> void
         {
-            generated_file.primary_file.write_string_to_file(STR("---@meta\n\n"));
+            content_buffer.append(STR("---@meta\n\n"));
         }
-        auto generate_file_footer(GeneratedFile& generated_file) -> void
+        auto generate_file_footer(GeneratedFile& generated_file, File::StringType& content_buffer) -> void
         {
         }
         auto generate_enum_declaration(File::StringType& content_buffer, UEnum* uenum) -> void
@@ -1115,33 +1174,18 @@ namespace RC::UEGenerator
 
             UStruct* inherits_from_class = native_class->GetSuperStruct();
 
-            // Make sure that the base class is defined
-            generator->generate_class_dependency(object_info, inherits_from_class, current_class_content);
-
-            // If any properties have dependencies, make sure that they are defined
+            // The base class and the types of the properties were already generated by 'TypeGenerator::discover_class'
             // This makes sure that we don't have member variables with undefined types (if the types are local, otherwise we need to include the file that the struct exists in)
             std::vector<PropertyInfo> properties_to_generate{};
             for (XProperty* property : native_class->ForEachProperty())
             {
-                properties_to_generate.emplace_back(
-                        PropertyInfo{property, generator->generate_class_dependency_from_property(object_info, property, current_class_content)});
+                properties_to_generate.emplace_back(PropertyInfo{property, generator->should_forward_declare(property)});
             }
 
             std::vector<FunctionInfo> functions_to_generate{};
             for (UFunction* function : native_class->ForEachFunction())
             {
-                auto& function_info = functions_to_generate.emplace_back(FunctionInfo{function, object_info});
-
-                for (XProperty* param : function->ForEachProperty())
-                {
-                    if (!param->HasAnyPropertyFlags(Unreal::CPF_Parm | Unreal::CPF_ReturnParm))
-                    {
-                        continue;
-                    }
-
-                    function_info.params.emplace_back(
-                            PropertyInfo{param, generator->generate_class_dependency_from_property(object_info, param, current_class_content)});
-                }
+                functions_to_generate.emplace_back(generator->make_function_info(object_info, function));
             }
 
             auto class_name = generate_class_name(native_class);
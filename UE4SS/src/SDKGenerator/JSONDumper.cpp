@@ -1,5 +1,5 @@
 #include <DynamicOutput/DynamicOutput.hpp>
-#include <JSON/JSON.hpp>
+#include <JSON/StreamWriter.hpp>
 #include <SDKGenerator/Common.hpp>
 #include <SDKGenerator/JSONDumper.hpp>
 #include <Timer/ScopedTimer.hpp>
@@ -186,13 +186,36 @@ namespace RC::UEGenerator::JSONDumper
         return false;
     }
 
+    auto static write_function_args(JSON::StreamWriter& writer, UFunction* function) -> void
+    {
+        writer.begin_array(STR("args"));
+        for (FProperty* param : function->ForEachProperty())
+        {
+            if (should_skip_property(param))
+            {
+                continue;
+            }
+
+            writer.begin_object();
+            writer.string(STR("name"), param->GetName());
+            writer.string(STR("type"), generate_property_cxx_name(param, true, function));
+            bool is_out = param->HasAnyPropertyFlags(EPropertyFlags::CPF_OutParm) && !param->HasAnyPropertyFlags(EPropertyFlags::CPF_ConstParm);
+            writer.boolean(STR("is_out"), is_out);
+            writer.boolean(STR("is_return"), param->HasAnyPropertyFlags(Unreal::EPropertyFlags::CPF_ReturnParm));
+            writer.end_object();
+        }
+        writer.end_array();
+    }
+
     auto dump_to_json(File::StringViewType file_name) -> void
     {
         Output::send(STR("Loading all assets...\n"));
         UAssetRegistry::LoadAllAssets();
 
         Output::send(STR("Dumping to JSON file\n"));
-        auto json = JSON::Array{};
+        // Each class is written to disk as soon as it's been visited instead of building the whole document in memory first
+        auto json = JSON::StreamWriter{file_name};
+        json.begin_array();
 
         UObjectGlobals::ForEachUObject([&](void* raw_object, int32_t chunk_index, int32_t object_index) {
             if (!raw_object)
@@ -210,18 +233,18 @@ namespace RC::UEGenerator::JSONDumper
 
             object_name.erase(object_name.size() - 2, 2);
 
-            auto& bp_class = json.new_object();
-            bp_class.new_string(STR("bp_class"), object_name);
+            json.begin_object();
+            json.string(STR("bp_class"), object_name);
             if (auto* super_struct = object_as_class->GetSuperStruct(); super_struct)
             {
-                bp_class.new_string(STR("inherits"), super_struct->GetName());
+                json.string(STR("inherits"), super_struct->GetName());
             }
             else
             {
-                bp_class.new_null(STR("inherits"));
+                json.null(STR("inherits"));
             }
 
-            auto& events = bp_class.new_array(STR("events"));
+            json.begin_array(STR("events"));
             for (UFunction* event_function : object_as_class->ForEachFunction())
             {
                 if (should_skip_general_function(event_function))
@@ -239,27 +262,14 @@ namespace RC::UEGenerator::JSONDumper
                     continue;
                 }
 
-                auto& bp_events = events.new_object();
-                bp_events.new_string(STR("name"), event_name);
-
-                auto& bp_event_args = bp_events.new_array(STR("args"));
-                for (FProperty* param : event_function->ForEachProperty())
-                {
-                    if (should_skip_property(param))
-                    {
-                        continue;
-                    }
-
-                    auto& bp_event_arg = bp_event_args.new_object();
-                    bp_event_arg.new_string(STR("name"), param->GetName());
-                    bp_event_arg.new_string(STR("type"), generate_property_cxx_name(param, true, event_function));
-                    bool is_out = param->HasAnyPropertyFlags(EPropertyFlags::CPF_OutParm) && !param->HasAnyPropertyFlags(EPropertyFlags::CPF_ConstParm);
-                    bp_event_arg.new_bool(STR("is_out"), is_out);
-                    bp_event_arg.new_bool(STR("is_return"), param->HasAnyPropertyFlags(Unreal::EPropertyFlags::CPF_ReturnParm));
-                }
+                json.begin_object();
+                json.string(STR("name"), event_name);
+                write_function_args(json, event_function);
+                json.end_object();
             }
+            json.end_array();
 
-            auto& functions = bp_class.new_array(STR("functions"));
+            json.begin_array(STR("functions"));
             for (UFunction* function : object_as_class->ForEachFunction())
             {
                 if (should_skip_function(function))
@@ -267,27 +277,14 @@ namespace RC::UEGenerator::JSONDumper
                     continue;
                 }
 
-                auto& bp_function = functions.new_object();
-                bp_function.new_string(STR("name"), function->GetName());
-
-                auto& bp_function_args = bp_function.new_array(STR("args"));
-                for (FProperty* param : function->ForEachProperty())
-                {
-                    if (should_skip_property(param))
-                    {
-                        continue;
-                    }
-
-                    auto& bp_function_arg = bp_function_args.new_object();
-                    bp_function_arg.new_string(STR("name"), param->GetName());
-                    bp_function_arg.new_string(STR("type"), generate_property_cxx_name(param, true, function));
-                    bool is_out = param->HasAnyPropertyFlags(EPropertyFlags::CPF_OutParm) && !param->HasAnyPropertyFlags(EPropertyFlags::CPF_ConstParm);
-                    bp_function_arg.new_bool(STR("is_out"), is_out);
-                    bp_function_arg.new_bool(STR("is_return"), param->HasAnyPropertyFlags(Unreal::EPropertyFlags::CPF_ReturnParm));
-                }
+                json.begin_object();
+                json.string(STR("name"), function->GetName());
+                write_function_args(json, function);
+                json.end_object();
             }
+            json.end_array();
 
-            auto& properties = bp_class.new_array(STR("properties"));
+            json.begin_array(STR("properties"));
             for (FProperty* property : object_as_class->ForEachProperty())
             {
                 if (should_skip_property(property))
@@ -295,12 +292,14 @@ namespace RC::UEGenerator::JSONDumper
                     continue;
                 }
 
-                auto& bp_property = properties.new_object();
-                bp_property.new_string(STR("name"), property->GetName());
-                bp_property.new_string(STR("type"), generate_property_cxx_name(property, true, object_as_class));
+                json.begin_object();
+                json.string(STR("name"), property->GetName());
+                json.string(STR("type"), generate_property_cxx_name(property, true, object_as_class));
+                json.end_object();
             }
+            json.end_array();
 
-            auto& delegates = bp_class.new_array(STR("delegates"));
+            json.begin_array(STR("delegates"));
             for (UFunction* delegate_function : object_as_class->ForEachFunction())
             {
                 if (should_skip_general_function(delegate_function))
@@ -312,33 +311,19 @@ namespace RC::UEGenerator::JSONDumper
                     continue;
                 }
 
-                auto& bp_delegate = delegates.new_object();
-                bp_delegate.new_string(STR("name"), delegate_function->GetName());
-
-                auto& bp_delegate_args = bp_delegate.new_array(STR("args"));
-                for (FProperty* param : delegate_function->ForEachProperty())
-                {
-                    if (should_skip_property(param))
-                    {
-                        continue;
-                    }
-
-                    auto& bp_delegate_arg = bp_delegate_args.new_object();
-                    bp_delegate_arg.new_string(STR("name"), param->GetName());
-                    bp_delegate_arg.new_string(STR("type"), generate_property_cxx_name(param, true, delegate_function));
-                    bool is_out = param->HasAnyPropertyFlags(EPropertyFlags::CPF_OutParm) && !param->HasAnyPropertyFlags(EPropertyFlags::CPF_ConstParm);
-                    bp_delegate_arg.new_bool(STR("is_out"), is_out);
-                    bp_delegate_arg.new_bool(STR("is_return"), param->HasAnyPropertyFlags(Unreal::EPropertyFlags::CPF_ReturnParm));
-                }
+                json.begin_object();
+                json.string(STR("name"), delegate_function->GetName());
+                write_function_args(json, delegate_function);
+                json.end_object();
             }
+            json.end_array();
 
+            json.end_object();
             return LoopAction::Continue;
         });
 
-        auto json_file = File::open(file_name, File::OpenFor::Writing, File::OverwriteExistingFile::Yes, File::CreateIfNonExistent::Yes);
-        int32_t indent_level{};
-        json_file.write_string_to_file(json.serialize(JSON::ShouldFormat::Yes, &indent_level));
-        json_file.close();
+        json.end_array();
+        json.finish();
 
         Output::send(STR("Unloading all forcefully loaded assets\n"));
         UAssetRegistry::FreeAllForcefullyLoadedAssets();
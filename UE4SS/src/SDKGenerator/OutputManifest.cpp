@@ -0,0 +1,153 @@
+#include <algorithm>
+#include <charconv>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <DynamicOutput/DynamicOutput.hpp>
+#include <Helpers/String.hpp>
+#include <SDKGenerator/OutputManifest.hpp>
+
+#include <fmt/core.h>
+
+namespace RC::UEGenerator
+{
+    OutputManifest::OutputManifest(const std::filesystem::path& root_directory) : m_root_directory(root_directory)
+    {
+        load();
+    }
+
+    auto OutputManifest::hash_contents(File::StringViewType contents) -> uint64_t
+    {
+        // 64-bit FNV-1a over the raw bytes of the string
+        constexpr uint64_t fnv_offset_basis = 0xcbf29ce484222325;
+        constexpr uint64_t fnv_prime = 0x100000001b3;
+
+        uint64_t hash = fnv_offset_basis;
+        auto bytes = reinterpret_cast<const unsigned char*>(contents.data());
+        for (size_t i = 0; i < contents.size() * sizeof(File::CharType); ++i)
+        {
+            hash ^= bytes[i];
+            hash *= fnv_prime;
+        }
+        return hash;
+    }
+
+    auto OutputManifest::make_key(const std::filesystem::path& file_path) const -> std::string
+    {
+        auto key = to_utf8_string(file_path.lexically_normal());
+        auto root = to_utf8_string(m_root_directory.lexically_normal());
+        std::replace(key.begin(), key.end(), '\\', '/');
+        std::replace(root.begin(), root.end(), '\\', '/');
+
+        // Paths may be prefixed with '\\?\' to unlock long path support, which isn't part of the root directory
+        constexpr std::string_view long_path_prefix = "//?/";
+        if (key.starts_with(long_path_prefix) && !root.starts_with(long_path_prefix))
+        {
+            key.erase(0, long_path_prefix.size());
+        }
+
+        if (key.starts_with(root))
+        {
+            key.erase(0, root.size());
+            if (key.starts_with('/'))
+            {
+                key.erase(0, 1);
+            }
+        }
+        return key;
+    }
+
+    auto OutputManifest::load() -> void
+    {
+        std::ifstream manifest_stream{m_root_directory / manifest_file_name};
+        if (!manifest_stream.is_open())
+        {
+            return;
+        }
+
+        m_has_previous_manifest = true;
+
+        // Format: one '<16 hex digit hash> <relative path>' entry per line
+        std::string line;
+        while (std::getline(manifest_stream, line))
+        {
+            if (line.size() < 18 || line[16] != ' ')
+            {
+                continue;
+            }
+
+            uint64_t hash{};
+            auto [ptr, error] = std::from_chars(line.data(), line.data() + 16, hash, 16);
+            if (error != std::errc{})
+            {
+                continue;
+            }
+
+            m_previous_hashes.emplace(line.substr(17), hash);
+        }
+    }
+
+    auto OutputManifest::track_file(const std::filesystem::path& file_path, File::StringViewType contents) -> bool
+    {
+        auto key = make_key(file_path);
+        auto hash = hash_contents(contents);
+
+        // The previous hashes are never modified after loading so they can be read without holding the lock
+        auto previous = m_previous_hashes.find(key);
+        bool is_added = previous == m_previous_hashes.end();
+        bool is_changed = !is_added && (previous->second != hash || !std::filesystem::exists(m_root_directory / utf8_to_wpath(key)));
+
+        std::lock_guard<std::mutex> lock{m_current_hashes_mutex};
+        m_current_hashes.insert_or_assign(std::move(key), hash);
+        if (is_added)
+        {
+            ++m_num_added;
+        }
+        else if (is_changed)
+        {
+            ++m_num_changed;
+        }
+        else
+        {
+            ++m_num_unchanged;
+        }
+        return is_added || is_changed;
+    }
+
+    auto OutputManifest::finalize() -> void
+    {
+        for (const auto& [key, hash] : m_previous_hashes)
+        {
+            if (m_current_hashes.contains(key))
+            {
+                continue;
+            }
+
+            std::error_code ec{};
+            if (std::filesystem::remove(m_root_directory / utf8_to_wpath(key), ec))
+            {
+                ++m_num_removed;
+            }
+        }
+
+        std::filesystem::create_directories(m_root_directory);
+        std::ofstream manifest_stream{m_root_directory / manifest_file_name, std::ios::trunc};
+        if (!manifest_stream.is_open())
+        {
+            Output::send<LogLevel::Warning>(STR("Unable to write output manifest to '{}'\n"), ensure_str(m_root_directory / manifest_file_name));
+        }
+        else
+        {
+            // Sorted so that the manifest itself is stable between runs
+            std::vector<std::pair<std::string_view, uint64_t>> entries{m_current_hashes.begin(), m_current_hashes.end()};
+            std::sort(entries.begin(), entries.end());
+            for (const auto& [key, hash] : entries)
+            {
+                manifest_stream << fmt::format("{:016x} {}\n", hash, key);
+            }
+        }
+
+        Output::send(STR("Output summary: {} added, {} changed, {} unchanged, {} removed\n"), m_num_added, m_num_changed, m_num_unchanged, m_num_removed);
+    }
+} // namespace RC::UEGenerator
@@ -2,7 +2,7 @@
 #include <DynamicOutput/Output.hpp>
 #include <File/File.hpp>
 #include <File/Macros.hpp>
-#include <JSON/JSON.hpp>
+#include <JSON/StreamWriter.hpp>
 #include <SDKGenerator/TMapOverrideGen.hpp>
 #include <Unreal/Common.hpp>
 #include <Unreal/UObjectGlobals.hpp>
@@ -27,8 +27,11 @@ namespace RC::UEGenerator
     {
         Output::send(STR("Dumping TMap Property Overrides\n"));
 
-        auto fm_object = JSON::Object{};
-        auto uaapi_object = JSON::Object{};
+        // Both files are streamed to disk while the objects are being iterated
+        auto fm_json = JSON::StreamWriter{StringType{UE4SSProgram::get_program().get_working_directory()} + STR("\\FModelTMapOverrides.json")};
+        auto uaapi_json = JSON::StreamWriter{StringType{UE4SSProgram::get_program().get_working_directory()} + STR("\\UAssetAPITMapOverrides.json")};
+        fm_json.begin_object();
+        uaapi_json.begin_object();
         size_t num_objects_generated{};
 
         UObjectGlobals::ForEachUObject([&](void* untyped_object, [[maybe_unused]] int32_t chunk_index, [[maybe_unused]] int32_t object_index) {
@@ -69,33 +72,36 @@ namespace RC::UEGenerator
                         }
                         Output::send(STR("Found Relevant TMap Property: {} in Class: {}\n"), property_name, object->GetName());
 
-                        auto& fm_json_object = fm_object.new_object(property_name);
-                        auto& uaapi_array = uaapi_object.new_array(property_name);
+                        fm_json.begin_object(property_name);
+                        uaapi_json.begin_array(property_name);
 
                         if (is_key_valid)
                         {
                             auto key_name = key_as_struct_property->GetStruct()->GetName();
-                            fm_json_object.new_string(STR("Key"), key_name);
-                            uaapi_array.new_string(key_name);
+                            fm_json.string(STR("Key"), key_name);
+                            uaapi_json.string(key_name);
                         }
                         else
                         {
-                            fm_json_object.new_string(STR("Key"), STR(""));
-                            uaapi_array.new_null();
+                            fm_json.string(STR("Key"), STR(""));
+                            uaapi_json.null();
                         }
 
                         if (is_value_valid)
                         {
                             auto value_name = value_as_struct_property->GetStruct()->GetName();
-                            fm_json_object.new_string(STR("Value"), value_name);
-                            uaapi_array.new_string(value_name);
+                            fm_json.string(STR("Value"), value_name);
+                            uaapi_json.string(value_name);
                         }
                         else
                         {
-                            fm_json_object.new_string(STR("Value"), STR(""));
-                            uaapi_array.new_null();
+                            fm_json.string(STR("Value"), STR(""));
+                            uaapi_json.null();
                         }
 
+                        fm_json.end_object();
+                        uaapi_json.end_array();
+
                         ++num_objects_generated;
                     }
                 }
@@ -107,19 +113,10 @@ namespace RC::UEGenerator
             return LoopAction::Continue;
         });
 
-        // Retrieve JSON as a string.
-        int32_t indent_level{};
-
-        auto uaapifile = open(StringType{UE4SSProgram::get_program().get_working_directory()} + STR("\\UAssetAPITMapOverrides.json"),
-                              File::OpenFor::Writing,
-                              File::OverwriteExistingFile::Yes,
-                              File::CreateIfNonExistent::Yes);
-        auto fmodelfile = open(StringType{UE4SSProgram::get_program().get_working_directory()} + STR("\\FModelTMapOverrides.json"),
-                               File::OpenFor::Writing,
-                               File::OverwriteExistingFile::Yes,
-                               File::CreateIfNonExistent::Yes);
-        uaapifile.write_string_to_file(uaapi_object.serialize(JSON::ShouldFormat::Yes, &indent_level));
-        fmodelfile.write_string_to_file(fm_object.serialize(JSON::ShouldFormat::Yes, &indent_level));
+        fm_json.end_object();
+        uaapi_json.end_object();
+        fm_json.finish();
+        uaapi_json.finish();
         Output::send(STR("Finished Dumping {} TMap Properties\n"), num_objects_generated);
         MapProperties.clear();
     }
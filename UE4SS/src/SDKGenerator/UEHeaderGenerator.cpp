@@ -298,7 +298,7 @@ namespace RC::UEGenerator
         module_build_file.end_indent_level();
         module_build_file.append_line(STR("}"));
 
-        module_build_file.serialize_file_content_to_disk();
+        module_build_file.serialize_file_content_to_disk(m_manifest);
     }
 
     auto UEHeaderGenerator::generate_module_implementation_file(const StringType& module_name) -> void
@@ -317,7 +317,7 @@ namespace RC::UEGenerator
             module_impl_file.append_line(fmt::format(STR("IMPLEMENT_PRIMARY_GAME_MODULE(FDefaultGameModuleImpl, {}, {});"), module_name, module_name));
         }
 
-        module_impl_file.serialize_file_content_to_disk();
+        module_impl_file.serialize_file_content_to_disk(m_manifest);
     }
 
     auto UEHeaderGenerator::generate_interface_definition(UClass* uclass, GeneratedSourceFile& header_data) -> void
@@ -3529,7 +3529,7 @@ namespace RC::UEGenerator
         return package_name;
     }
 
-    UEHeaderGenerator::UEHeaderGenerator(const FFilePath& root_directory)
+    UEHeaderGenerator::UEHeaderGenerator(const FFilePath& root_directory) : m_manifest(root_directory)
     {
         this->m_root_directory = root_directory;
         this->m_primary_module_name = determine_primary_game_module_name();
@@ -3707,10 +3707,17 @@ namespace RC::UEGenerator
     {
         ignore_selected_modules();
 
-        Output::send(STR("Cleaning up previously generated SDK (if one exists)\n"));
-        if (std::filesystem::exists(m_root_directory))
+        if (m_manifest.has_previous_manifest())
         {
-            std::filesystem::remove_all(m_root_directory);
+            Output::send(STR("Found output manifest, only changed files will be written\n"));
+        }
+        else
+        {
+            Output::send(STR("Cleaning up previously generated SDK (if one exists)\n"));
+            if (std::filesystem::exists(m_root_directory))
+            {
+                std::filesystem::remove_all(m_root_directory);
+            }
         }
 
         Output::send(STR("Initializing native packages dump\n"));
@@ -3845,9 +3852,11 @@ namespace RC::UEGenerator
                     }
                 }
             }
-            header_file.serialize_file_content_to_disk();
+            header_file.serialize_file_content_to_disk(m_manifest);
         }
 
+        m_manifest.finalize();
+
         Output::send(STR("Done!\n"));
     }
 
@@ -3919,7 +3928,7 @@ namespace RC::UEGenerator
         {
             return false;
         }
-        implementation_file.serialize_file_content_to_disk();
+        implementation_file.serialize_file_content_to_disk(m_manifest);
 
         // This is necessary because header_file.serialize_file_content_to_disk() is not called anymore
         // so we need to call all the necessary internal code to generate the dependency list
@@ -4116,12 +4125,20 @@ namespace RC::UEGenerator
         }
     }
 
-    auto GeneratedFile::serialize_file_content_to_disk() -> bool
+    auto GeneratedFile::serialize_file_content_to_disk(OutputManifest& manifest) -> bool
     {
         if (!has_content_to_save())
         {
             return false;
         }
+
+        const StringType file_contents = generate_file_contents();
+        if (!manifest.track_file(m_full_file_path, file_contents))
+        {
+            // The file on disk is identical, leave it and its timestamp alone
+            return true;
+        }
+
         // TODO might be slow, maybe move it out into the header generator?
         std::filesystem::create_directories(this->m_full_file_path.parent_path());
 
@@ -4131,7 +4148,7 @@ namespace RC::UEGenerator
         {
             throw std::invalid_argument("Failed to open the header file");
         }
-        file_output_stream << generate_file_contents();
+        file_output_stream << file_contents;
         file_output_stream.close();
         return true;
     }
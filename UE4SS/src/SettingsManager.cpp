@@ -5,7 +5,7 @@
 #define REGISTER_STRING_SETTING(member_var, section_name, key)                                                                                                 \
     try                                                                                                                                                        \
     {                                                                                                                                                          \
-        (member_var) = parser.get_string(section_name, STR(#key));                                                                                             \
+        (member_var) = parser.get_string(Ini::Key{section_name, STR(#key)});                                                                                   \
     }                                                                                                                                                          \
     catch (std::exception&)                                                                                                                                    \
     {                                                                                                                                                          \
@@ -14,7 +14,7 @@
 #define REGISTER_INT64_SETTING(member_var, section_name, key)                                                                                                  \
     try                                                                                                                                                        \
     {                                                                                                                                                          \
-        (member_var) = parser.get_int64(section_name, STR(#key));                                                                                              \
+        (member_var) = parser.get_int64(Ini::Key{section_name, STR(#key)});                                                                                    \
     }                                                                                                                                                          \
     catch (std::exception&)                                                                                                                                    \
     {                                                                                                                                                          \
@@ -23,7 +23,7 @@
 #define REGISTER_BOOL_SETTING(member_var, section_name, key)                                                                                                   \
     try                                                                                                                                                        \
     {                                                                                                                                                          \
-        (member_var) = parser.get_bool(section_name, STR(#key));                                                                                               \
+        (member_var) = parser.get_bool(Ini::Key{section_name, STR(#key)});                                                                                     \
     }                                                                                                                                                          \
     catch (std::exception&)                                                                                                                                    \
     {                                                                                                                                                          \
@@ -32,7 +32,7 @@
 #define REGISTER_FLOAT_SETTING(member_var, section_name, key)                                                                                                  \
     try                                                                                                                                                        \
     {                                                                                                                                                          \
-        (member_var) = parser.get_float(section_name, STR(#key));                                                                                              \
+        (member_var) = parser.get_float(Ini::Key{section_name, STR(#key)});                                                                                    \
     }                                                                                                                                                          \
     catch (std::exception&)                                                                                                                                    \
     {                                                                                                                                                          \
@@ -40,11 +40,18 @@
 
 namespace RC
 {
-    auto SettingsManager::deserialize(std::filesystem::path& file_name) -> void
+    auto SettingsManager::deserialize(std::filesystem::path& file_name, const std::filesystem::path& snapshot_path) -> void
     {
         auto file = File::open(file_name, File::OpenFor::Reading, File::OverwriteExistingFile::No, File::CreateIfNonExistent::Yes);
         Ini::Parser parser;
-        parser.parse(file);
+        if (snapshot_path.empty())
+        {
+            parser.parse(file);
+        }
+        else
+        {
+            parser.parse(file, snapshot_path);
+        }
         file.close();
 
         constexpr static File::CharType section_overrides[] = STR("Overrides");
@@ -94,6 +101,24 @@ namespace RC
         REGISTER_BOOL_SETTING(UHTHeaderGenerator.MakeEnumClassesBlueprintType, section_uht_header_generator, MakeEnumClassesBlueprintType)
         REGISTER_BOOL_SETTING(UHTHeaderGenerator.MakeAllConfigsEngineConfig, section_uht_header_generator, MakeAllConfigsEngineConfig)
 
+        constexpr static File::CharType section_usmap_generator[] = STR("USMapGenerator");
+        StringType usmap_compression_method_string{};
+        REGISTER_STRING_SETTING(usmap_compression_method_string, section_usmap_generator, CompressionMethod)
+        if (String::iequal(usmap_compression_method_string, STR("None")))
+        {
+            USMapGenerator.CompressionMethod = OutTheShade::ECompressionMethod::None;
+        }
+        else if (String::iequal(usmap_compression_method_string, STR("ZStandard")) || String::iequal(usmap_compression_method_string, STR("Zstd")))
+        {
+            USMapGenerator.CompressionMethod = OutTheShade::ECompressionMethod::ZStandard;
+        }
+        else if (!usmap_compression_method_string.empty())
+        {
+            Warnings.emplace_back(fmt::format(STR("Unsupported [USMapGenerator] CompressionMethod '{}', expected None or ZStandard, .usmap files won't be compressed"),
+                                              usmap_compression_method_string));
+        }
+        REGISTER_INT64_SETTING(USMapGenerator.CompressionLevel, section_usmap_generator, CompressionLevel)
+
         constexpr static File::CharType section_debug[] = STR("Debug");
         REGISTER_BOOL_SETTING(Debug.SimpleConsoleEnabled, section_debug, ConsoleEnabled)
         REGISTER_BOOL_SETTING(Debug.DebugConsoleEnabled, section_debug, GuiConsoleEnabled)
@@ -123,6 +148,20 @@ namespace RC
         {
             Debug.RenderMode = GUI::RenderMode::GameViewportClientTick;
         }
+        REGISTER_BOOL_SETTING(Debug.TraceInputEvents, section_debug, TraceInputEvents)
+        StringType builtin_profiler_key{};
+        REGISTER_STRING_SETTING(builtin_profiler_key, section_debug, BuiltinProfilerKey)
+        if (!builtin_profiler_key.empty())
+        {
+            try
+            {
+                Debug.BuiltinProfilerKey = Input::string_to_key(builtin_profiler_key);
+            }
+            catch (...)
+            {
+                throw std::runtime_error{fmt::format("Invalid value for 'Debug.BuiltinProfilerKey': {}\n", to_string(builtin_profiler_key))};
+            }
+        }
 
         constexpr static File::CharType section_crash_dump[] = STR("CrashDump");
         REGISTER_BOOL_SETTING(CrashDump.EnableDumping, section_crash_dump, EnableDumping);
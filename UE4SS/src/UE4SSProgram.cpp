@@ -24,6 +24,7 @@
 #include <Helpers/Integer.hpp>
 #include <Helpers/String.hpp>
 #include <IniParser/Ini.hpp>
+#include <Input/Platform/QueueInputSource.hpp>
 #include <LuaLibrary.hpp>
 #include <LuaType/LuaCustomProperty.hpp>
 #include <LuaType/LuaUObject.hpp>
@@ -186,7 +187,20 @@ namespace RC
 
             try
             {
-                settings_manager.deserialize(m_settings_path_and_file);
+                // 'UseCache' lives in the settings file itself, so a settings snapshot is only read if one was left behind while it was enabled
+                // The snapshot is then created or removed to match the setting that was just read
+                auto settings_snapshot_path = get_ini_snapshot_path(m_settings_path_and_file);
+                std::error_code snapshot_error{};
+                auto has_settings_snapshot = std::filesystem::exists(settings_snapshot_path, snapshot_error);
+                settings_manager.deserialize(m_settings_path_and_file, has_settings_snapshot ? settings_snapshot_path : std::filesystem::path{});
+                if (settings_manager.General.UseCache && !has_settings_snapshot)
+                {
+                    settings_manager.deserialize(m_settings_path_and_file, settings_snapshot_path);
+                }
+                else if (!settings_manager.General.UseCache && has_settings_snapshot)
+                {
+                    std::filesystem::remove(settings_snapshot_path, snapshot_error);
+                }
             }
             catch (std::exception& e)
             {
@@ -294,6 +308,11 @@ namespace RC
 
             Output::send(STR("UE4SS Build Configuration: {} ({})\n"), ensure_str(UE4SS_CONFIGURATION), UE4SS_COMPILER);
 
+            for (const auto& warning : settings_manager.Warnings)
+            {
+                Output::send<LogLevel::Warning>(STR("{}\n"), warning);
+            }
+
             m_load_library_a_hook = std::make_unique<PLH::IatHook>("kernel32.dll",
                                                                    "LoadLibraryA",
                                                                    std::bit_cast<uint64_t>(&HookedLoadLibraryA),
@@ -557,16 +576,34 @@ namespace RC
         }
     }
 
+    auto UE4SSProgram::get_ini_snapshot_path(const std::filesystem::path& ini_file_path) const -> std::filesystem::path
+    {
+        // Files with the same name in different directories, like per-game overrides, must not share a snapshot
+        std::error_code error{};
+        auto absolute_path = std::filesystem::absolute(ini_file_path, error);
+        auto full_path = ensure_str((error ? ini_file_path : absolute_path).lexically_normal());
+        auto snapshot_file_name = ini_file_path.filename();
+        snapshot_file_name += fmt::format(STR(".{:016x}.snapshot"), Ini::Key::hash(full_path, {}));
+        return m_root_directory / "cache" / snapshot_file_name;
+    }
+
     auto UE4SSProgram::load_unreal_offsets_from_file() -> void
     {
         std::filesystem::path file_path = m_working_directory / "MemberVariableLayout.ini";
         if (std::filesystem::exists(file_path))
         {
             auto file = File::open(file_path);
-            if (auto file_contents = file.read_all(); !file_contents.empty())
+            if (auto file_view = file.read_all_view(); !file_view.empty())
             {
                 Ini::Parser parser;
-                parser.parse(file_contents);
+                if (settings_manager.General.UseCache)
+                {
+                    parser.parse(file_view, get_ini_snapshot_path(file_path));
+                }
+                else
+                {
+                    parser.parse(file_view);
+                }
                 file.close();
 
                 // The following code is auto-generated.
@@ -653,7 +690,14 @@ namespace RC
                 auto file =
                         File::open(virtual_function_offset_override_file, File::OpenFor::Reading, File::OverwriteExistingFile::No, File::CreateIfNonExistent::No);
                 Ini::Parser parser;
-                parser.parse(file);
+                if (settings_manager.General.UseCache)
+                {
+                    parser.parse(file, get_ini_snapshot_path(virtual_function_offset_override_file));
+                }
+                else
+                {
+                    parser.parse(file);
+                }
 
                 Output::send<Color::Blue>(STR("Getting ordered lists from ini file\n"));
 
@@ -1011,6 +1055,31 @@ namespace RC
         });
 #endif
 
+#if IS_BUILTIN && !DISABLE_PROFILER
+        register_keydown_event(settings_manager.Debug.BuiltinProfilerKey, {Input::ModifierKey::CONTROL}, [&]() {
+            auto& profiler = Profiler::BuiltinProfiler::get();
+            if (!profiler.is_recording())
+            {
+                profiler.clear();
+                profiler.start();
+                Output::send(STR("Builtin profiler started\n"));
+                return;
+            }
+
+            profiler.stop();
+            auto trace_path = m_working_directory / "UE4SS_Trace.json";
+            try
+            {
+                profiler.dump_chrome_trace(trace_path);
+                Output::send(STR("Builtin profiler stopped, trace written to {}\n"), ensure_str(trace_path));
+            }
+            catch (const std::exception& e)
+            {
+                Output::send<LogLevel::Error>(STR("Builtin profiler stopped, could not write trace: {}\n"), ensure_str(e.what()));
+            }
+        });
+#endif
+
         TRY([&] {
             ObjectDumper::init();
             if (settings_manager.General.EnableHotReloadSystem)
@@ -1046,6 +1115,13 @@ namespace RC
                     Output::send<LogLevel::Error>(STR("Failed to set input source to: {}\n"), settings_manager.General.InputSource);
                 }
             }
+            if (settings_manager.Debug.TraceInputEvents)
+            {
+                if (auto queue_input_source = std::dynamic_pointer_cast<Input::QueueInputSource>(Input::Handler::get_input_source("GLFW3")))
+                {
+                    queue_input_source->set_trace_events(true);
+                }
+            }
 #endif
 
             install_lua_mods();
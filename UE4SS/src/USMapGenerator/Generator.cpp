@@ -2,11 +2,14 @@
 
 // writer.h is missing includes and I'd like to keep it unchanged so I'll include the missing files here instead.
 #include <Unreal/Common.hpp>
+#include <cstring>
+#include <memory>
 #include <sstream>
 #include <string>
 
 #include <DynamicOutput/DynamicOutput.hpp>
 #include <USMapGenerator/Generator.hpp>
+#include <USMapGenerator/USMapFile.hpp>
 #include <USMapGenerator/writer.h>
 #include <Unreal/NameTypes.hpp>
 #include <Unreal/Property/FSetProperty.hpp>
@@ -218,7 +221,7 @@ namespace RC::OutTheShade
         Output::send(STR("Mappings Generator by OutTheShade\nAttempting to dump mappings...\nPort of https://github.com/OutTheShade/UnrealMappingsDumper "
                          "Commit SHA 4da8c66\n"));
 
-        StreamWriter Buffer;
+        BufferWriter Buffer;
         std::unordered_map<FName, int> NameMap;
         std::unordered_map<UObject*, FName> ModulePathsMap;
 
@@ -432,7 +435,7 @@ namespace RC::OutTheShade
         Buffer.Write<uint32_t>(0x48545050); // ext id
         Buffer.Write<uint32_t>(0);          // size; unknown for now
 
-        std::streampos extStartPos = Buffer.GetBuffer().tellp();
+        size_t extStartPos = Buffer.Tell();
         Buffer.Write<uint8_t>(0); // PPTH version; 0
         Buffer.Write<uint32_t>(static_cast<uint32_t>(Enums.size()));
         for (auto Enum : Enums)
@@ -444,18 +447,15 @@ namespace RC::OutTheShade
         {
             Buffer.Write(NameMap[ModulePathsMap[Struct]]);
         }
-        std::streampos extEndPos = Buffer.GetBuffer().tellp();
+        size_t extEndPos = Buffer.Tell();
 
-        Buffer.GetBuffer().seekp(extStartPos);
-        Buffer.GetBuffer().seekp(-(int32)sizeof(uint32), std::ios_base::cur);
-        Buffer.Write<uint32_t>(extEndPos - extStartPos);
-        Buffer.GetBuffer().seekp(extEndPos);
+        Buffer.WriteAt<uint32_t>(extStartPos - sizeof(uint32_t), static_cast<uint32_t>(extEndPos - extStartPos));
 
         // extension 2: EATR (extended attributes)
         Buffer.Write<uint32_t>(0x52544145); // ext id
         Buffer.Write<uint32_t>(0);          // size; unknown for now
 
-        extStartPos = Buffer.GetBuffer().tellp();
+        extStartPos = Buffer.Tell();
         Buffer.Write<uint8_t>(0); // EATR version; 0
         Buffer.Write<uint32_t>(static_cast<uint32_t>(Enums.size()));
         for (auto Enum : Enums)
@@ -488,18 +488,15 @@ namespace RC::OutTheShade
             for (uint64_t propFlag : propFlags)
                 Buffer.Write<uint64_t>(propFlag);
         }
-        extEndPos = Buffer.GetBuffer().tellp();
+        extEndPos = Buffer.Tell();
 
-        Buffer.GetBuffer().seekp(extStartPos);
-        Buffer.GetBuffer().seekp(-(int32)sizeof(uint32), std::ios_base::cur);
-        Buffer.Write<uint32_t>(extEndPos - extStartPos);
-        Buffer.GetBuffer().seekp(extEndPos);
+        Buffer.WriteAt<uint32_t>(extStartPos - sizeof(uint32_t), static_cast<uint32_t>(extEndPos - extStartPos));
 
         // extension 3: ENVP (enum name/value pairs)
         Buffer.Write<uint32_t>(0x50564E45); // ext id
         Buffer.Write<uint32_t>(0);          // size; unknown for now
 
-        extStartPos = Buffer.GetBuffer().tellp();
+        extStartPos = Buffer.Tell();
         Buffer.Write<uint8_t>(0); // ENVP version; 0
         Buffer.Write<uint32_t>(static_cast<uint32_t>(Enums.size()));
         for (auto Enum : Enums)
@@ -515,31 +512,23 @@ namespace RC::OutTheShade
                 Buffer.Write<int64_t>(val);
             }
         }
-        extEndPos = Buffer.GetBuffer().tellp();
+        extEndPos = Buffer.Tell();
 
-        Buffer.GetBuffer().seekp(extStartPos);
-        Buffer.GetBuffer().seekp(-(int32)sizeof(uint32), std::ios_base::cur);
-        Buffer.Write<uint32_t>(extEndPos - extStartPos);
-        Buffer.GetBuffer().seekp(extEndPos);
+        Buffer.WriteAt<uint32_t>(extStartPos - sizeof(uint32_t), static_cast<uint32_t>(extEndPos - extStartPos));
 
         // end of extensions //
 
-        std::vector<uint8_t> UsmapData;
-        std::string UncompressedStream = Buffer.GetBuffer().str();
-        UsmapData.resize(UncompressedStream.size());
-        memcpy(UsmapData.data(), UncompressedStream.data(), UsmapData.size());
-
-        auto filename = to_string(UE4SSProgram::get_program().get_working_directory()) + "//Mappings.usmap";
-        auto FileOutput = FileWriter(filename.c_str());
-
-        FileOutput.Write<uint16_t>(0x30C4); // magic
-        FileOutput.Write<uint8_t>(0);       // version
-        FileOutput.Write<uint8_t>(0);       // compression
-        // Warning: Converting size_t (uint64) to int.
-        FileOutput.Write<uint32_t>(static_cast<uint32_t>(UsmapData.size())); // compressed size
-        FileOutput.Write<uint32_t>(Buffer.Size());                           // decompressed size
-
-        FileOutput.Write(UsmapData.data(), UsmapData.size());
+        auto filename = std::filesystem::path{UE4SSProgram::get_program().get_working_directory()} / "Mappings.usmap";
+        try
+        {
+            const auto& settings = UE4SSProgram::settings_manager.USMapGenerator;
+            write_usmap_file(filename, std::span{Buffer.GetData(), Buffer.Size()}, settings.CompressionMethod, static_cast<int>(settings.CompressionLevel));
+        }
+        catch (const std::exception& e)
+        {
+            Output::send<LogLevel::Error>(STR("Failed to write mappings: {}\n"), ensure_str(e.what()));
+            return;
+        }
 
         Output::send(STR("Mappings Generation Completed Successfully!\n"));
     }
@@ -0,0 +1,143 @@
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+#include <USMapGenerator/USMapFile.hpp>
+
+#include <zstd.h>
+
+namespace RC::OutTheShade
+{
+    template <typename T>
+    static auto write_value(std::ofstream& stream, T value) -> void
+    {
+        stream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    template <typename T>
+    static auto read_value(std::ifstream& stream) -> T
+    {
+        T value{};
+        if (!stream.read(reinterpret_cast<char*>(&value), sizeof(T)))
+        {
+            throw std::runtime_error{"Unexpected end of .usmap header"};
+        }
+        return value;
+    }
+
+    auto write_usmap_file(const std::filesystem::path& path, std::span<const uint8_t> payload, ECompressionMethod compression_method, int compression_level)
+            -> void
+    {
+        if (compression_method != ECompressionMethod::None && compression_method != ECompressionMethod::ZStandard)
+        {
+            throw std::runtime_error{"Unsupported .usmap compression method: " + std::to_string(static_cast<int>(compression_method))};
+        }
+
+        std::ofstream stream{path, std::ios::binary};
+        if (!stream)
+        {
+            throw std::runtime_error{"Could not open '" + path.string() + "' for writing"};
+        }
+
+        write_value<uint16_t>(stream, usmap_magic);
+        write_value<uint8_t>(stream, 0); // version
+        write_value<uint8_t>(stream, static_cast<uint8_t>(compression_method));
+        write_value<uint32_t>(stream, 0); // compressed size; unknown for now
+        write_value<uint32_t>(stream, static_cast<uint32_t>(payload.size()));
+
+        uint32_t compressed_size{};
+        if (compression_method == ECompressionMethod::ZStandard)
+        {
+            auto context = std::unique_ptr<ZSTD_CCtx, decltype(&ZSTD_freeCCtx)>{ZSTD_createCCtx(), &ZSTD_freeCCtx};
+            ZSTD_CCtx_setParameter(context.get(), ZSTD_c_compressionLevel, compression_level);
+            ZSTD_CCtx_setPledgedSrcSize(context.get(), payload.size());
+
+            std::vector<char> out_chunk(ZSTD_CStreamOutSize());
+            ZSTD_inBuffer in_buffer{payload.data(), payload.size(), 0};
+            size_t remaining{};
+            do
+            {
+                ZSTD_outBuffer out_buffer{out_chunk.data(), out_chunk.size(), 0};
+                remaining = ZSTD_compressStream2(context.get(), &out_buffer, &in_buffer, ZSTD_e_end);
+                if (ZSTD_isError(remaining))
+                {
+                    throw std::runtime_error{std::string{"Failed to compress mappings: "} + ZSTD_getErrorName(remaining)};
+                }
+                stream.write(out_chunk.data(), static_cast<std::streamsize>(out_buffer.pos));
+                compressed_size += static_cast<uint32_t>(out_buffer.pos);
+            } while (remaining != 0);
+        }
+        else
+        {
+            stream.write(reinterpret_cast<const char*>(payload.data()), static_cast<std::streamsize>(payload.size()));
+            compressed_size = static_cast<uint32_t>(payload.size());
+        }
+
+        stream.seekp(4);
+        write_value<uint32_t>(stream, compressed_size);
+
+        if (!stream.flush())
+        {
+            throw std::runtime_error{"Could not write '" + path.string() + "'"};
+        }
+    }
+
+    auto read_usmap_file(const std::filesystem::path& path, USMapHeader* out_header) -> std::vector<uint8_t>
+    {
+        std::ifstream stream{path, std::ios::binary};
+        if (!stream)
+        {
+            throw std::runtime_error{"Could not open '" + path.string() + "' for reading"};
+        }
+
+        USMapHeader header{};
+        header.magic = read_value<uint16_t>(stream);
+        header.version = read_value<uint8_t>(stream);
+        header.compression_method = static_cast<ECompressionMethod>(read_value<uint8_t>(stream));
+        header.compressed_size = read_value<uint32_t>(stream);
+        header.decompressed_size = read_value<uint32_t>(stream);
+        if (header.magic != usmap_magic)
+        {
+            throw std::runtime_error{"'" + path.string() + "' is not a .usmap file"};
+        }
+        if (out_header)
+        {
+            *out_header = header;
+        }
+
+        std::vector<char> compressed(header.compressed_size);
+        if (!stream.read(compressed.data(), static_cast<std::streamsize>(compressed.size())) || stream.peek() != std::ifstream::traits_type::eof())
+        {
+            throw std::runtime_error{"Payload of '" + path.string() + "' doesn't match its compressed size"};
+        }
+
+        std::vector<uint8_t> payload(header.decompressed_size);
+        switch (header.compression_method)
+        {
+        case ECompressionMethod::None:
+            if (header.compressed_size != header.decompressed_size)
+            {
+                throw std::runtime_error{"Uncompressed payload of '" + path.string() + "' has mismatching sizes"};
+            }
+            std::memcpy(payload.data(), compressed.data(), payload.size());
+            break;
+        case ECompressionMethod::ZStandard: {
+            auto decompressed_size = ZSTD_decompress(payload.data(), payload.size(), compressed.data(), compressed.size());
+            if (ZSTD_isError(decompressed_size))
+            {
+                throw std::runtime_error{std::string{"Failed to decompress mappings: "} + ZSTD_getErrorName(decompressed_size)};
+            }
+            if (decompressed_size != payload.size())
+            {
+                throw std::runtime_error{"Decompressed payload of '" + path.string() + "' doesn't match its decompressed size"};
+            }
+            break;
+        }
+        default:
+            throw std::runtime_error{"Unsupported .usmap compression method: " + std::to_string(static_cast<int>(header.compression_method))};
+        }
+        return payload;
+    }
+} // namespace RC::OutTheShade
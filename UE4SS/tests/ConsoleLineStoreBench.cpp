@@ -0,0 +1,80 @@
+#include <format>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <GUI/ConsoleLineStore.hpp>
+#include <TestHarness/TestHarness.hpp>
+
+using namespace RC;
+using namespace RC::GUI;
+using namespace RC::TestHarness;
+
+// Same limits as the console
+constexpr size_t max_lines = 50000;
+constexpr size_t max_text_bytes = 8 * 1024 * 1024;
+
+// Cost of storing a line once the history is full and every append evicts the oldest line
+static auto bench_append() -> void
+{
+    constexpr size_t num_iterations = 1'000'000;
+    ConsoleLineStore store{max_lines, max_text_bytes};
+    std::string line = "[Lua] [BPModLoaderMod] Loaded mod 'ExampleMod' from '/Game/Mods/ExampleMod/ModActor.ModActor_C'";
+    for (size_t i = 0; i < max_lines; ++i)
+    {
+        store.append(line, Color::Default);
+    }
+
+    benchmark("ConsoleLineStore::append, full store", num_iterations, [&] {
+        store.append(line, Color::Default);
+    });
+    CHECK(store.size() == max_lines);
+    CHECK(store.get_line(max_lines - 1).text == line);
+}
+
+// Log threads pushing into the inbox while the GUI thread drains it into the store, the way Console does
+static auto bench_ingestion() -> void
+{
+    constexpr size_t num_producers = 4;
+    constexpr size_t lines_per_producer = 25'000;
+    constexpr size_t num_lines = num_producers * lines_per_producer;
+
+    std::vector<std::string> lines{};
+    for (size_t i = 0; i < lines_per_producer; ++i)
+    {
+        lines.emplace_back(std::format("[{}] Output from a log thread\n", i));
+    }
+
+    ConsoleLineStore store{max_lines, max_text_bytes};
+    benchmark("ConsoleInbox, 4 producers, 100k lines into the store", 1, [&] {
+        ConsoleInbox inbox{};
+        std::vector<std::jthread> producers{};
+        for (size_t producer = 0; producer < num_producers; ++producer)
+        {
+            producers.emplace_back([&] {
+                for (const auto& line : lines)
+                {
+                    inbox.push(line, Color::Default);
+                }
+            });
+        }
+
+        size_t num_consumed{};
+        while (num_consumed < num_lines)
+        {
+            num_consumed += inbox.consume([&](std::string_view text, Color::Color color) {
+                text.remove_suffix(1);
+                store.append(text, color);
+            });
+        }
+    });
+    CHECK(store.size() == max_lines);
+}
+
+int main()
+{
+    bench_append();
+    bench_ingestion();
+
+    return report();
+}
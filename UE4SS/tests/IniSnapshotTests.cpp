@@ -0,0 +1,117 @@
+#include <cmath>
+#include <cstdio>
+#include <filesystem>
+#include <vector>
+
+#include <IniParser/Ini.hpp>
+#include <TestHarness/TestHarness.hpp>
+
+using namespace RC;
+
+// Section names straight from the text, the parser has no way to list them
+static auto find_section_names(File::StringViewType text) -> std::vector<File::StringType>
+{
+    std::vector<File::StringType> section_names{};
+    size_t line_start{};
+    while (line_start < text.size())
+    {
+        auto line_end = text.find(STR('\n'), line_start);
+        auto line = text.substr(line_start, line_end == text.npos ? text.npos : line_end - line_start);
+        if (line.starts_with(STR('[')))
+        {
+            if (auto close = line.find(STR(']')); close != line.npos)
+            {
+                section_names.emplace_back(line.substr(1, close - 1));
+            }
+        }
+        line_start = line_end == text.npos ? text.size() : line_end + 1;
+    }
+    return section_names;
+}
+
+static auto floats_match(float a, float b) -> bool
+{
+    return a == b || (std::isnan(a) && std::isnan(b));
+}
+
+// Every key of every section must read back the same from both parsers, through every getter
+static auto check_parsers_agree(Ini::Parser& text_parser, Ini::Parser& snapshot_parser, const std::vector<File::StringType>& section_names) -> void
+{
+    const File::StringType missing{STR("<missing>")};
+    for (const auto& section_name : section_names)
+    {
+        auto text_list = text_parser.get_list(section_name);
+        auto snapshot_list = snapshot_parser.get_list(section_name);
+        CHECK(text_list.size() == snapshot_list.size());
+        std::vector<File::StringType> snapshot_ordered_list{};
+        snapshot_list.for_each([&](size_t, const File::StringType& item) {
+            snapshot_ordered_list.emplace_back(item);
+        });
+        text_list.for_each([&](size_t index, const File::StringType& item) {
+            CHECK(index < snapshot_ordered_list.size() && snapshot_ordered_list[index] == item);
+        });
+
+        size_t num_text_keys{};
+        text_list.for_each([&](const File::StringType& key, const Ini::Value&) {
+            ++num_text_keys;
+            const Ini::Key prehashed_key{section_name, key};
+            CHECK(text_parser.get_string(section_name, key, missing) == snapshot_parser.get_string(section_name, key, missing));
+            CHECK(text_parser.get_string(prehashed_key, missing) == snapshot_parser.get_string(prehashed_key, missing));
+            CHECK(text_parser.get_int64(prehashed_key, -1) == snapshot_parser.get_int64(prehashed_key, -1));
+            CHECK(floats_match(text_parser.get_float(prehashed_key, -1.0f), snapshot_parser.get_float(prehashed_key, -1.0f)));
+            CHECK(text_parser.get_bool(prehashed_key, false) == snapshot_parser.get_bool(prehashed_key, false));
+            CHECK(text_parser.get_bool(prehashed_key, true) == snapshot_parser.get_bool(prehashed_key, true));
+        });
+        size_t num_snapshot_keys{};
+        snapshot_list.for_each([&](const File::StringType&, const Ini::Value&) {
+            ++num_snapshot_keys;
+        });
+        CHECK(num_text_keys == num_snapshot_keys);
+    }
+}
+
+// Every ini file shipped in assets must give the same results when it's loaded from its snapshot
+int main()
+{
+    auto snapshot_directory = std::filesystem::temp_directory_path() / "IniSnapshotTests";
+    std::filesystem::create_directories(snapshot_directory);
+
+    size_t num_files{};
+    for (const auto& entry : std::filesystem::recursive_directory_iterator{UE4SS_ASSETS_DIRECTORY})
+    {
+        if (!entry.is_regular_file() || entry.path().extension() != ".ini")
+        {
+            continue;
+        }
+        ++num_files;
+
+        auto file = File::open(entry.path(), File::OpenFor::Reading, File::OverwriteExistingFile::No, File::CreateIfNonExistent::No);
+        auto text = file.read_all();
+        auto snapshot_path = snapshot_directory / entry.path().filename();
+        snapshot_path += ".snapshot";
+
+        Ini::Parser text_parser;
+        text_parser.parse(text);
+
+        // The first parse writes the snapshot, the second one reads it
+        Ini::Parser writing_parser;
+        writing_parser.parse(text, snapshot_path);
+        CHECK(!writing_parser.is_loaded_from_snapshot());
+        Ini::Parser snapshot_parser;
+        snapshot_parser.parse(text, snapshot_path);
+        CHECK(snapshot_parser.is_loaded_from_snapshot());
+
+        auto num_failures_before = RC::TestHarness::num_failures;
+        check_parsers_agree(text_parser, snapshot_parser, find_section_names(text));
+        if (RC::TestHarness::num_failures != num_failures_before)
+        {
+            std::printf("The snapshot of '%s' doesn't match its text\n", entry.path().string().c_str());
+        }
+    }
+    CHECK(num_files > 0);
+    std::printf("Compared %zu ini files\n", num_files);
+
+    std::filesystem::remove_all(snapshot_directory);
+
+    return RC::TestHarness::report();
+}
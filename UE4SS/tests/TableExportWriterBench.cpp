@@ -0,0 +1,59 @@
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include <ObjectDumper/TableExportWriter.hpp>
+#include <TestHarness/TestHarness.hpp>
+
+using namespace RC;
+using namespace RC::ObjectDumper;
+using namespace RC::TestHarness;
+
+// Cost of writing a table shaped like a gameplay DataTable, the values are what ExportTextItem produces for them
+int main()
+{
+    constexpr size_t num_rows = 10'000;
+    const std::vector<StringType> column_names{STR("DisplayName"), STR("Damage"), STR("Location"), STR("Mesh"), STR("Tags")};
+    const std::vector<StringType> values{STR("NSLOCTEXT(\"\", \"Sword\", \"Sword\")"),
+                                         STR("12.500000"),
+                                         STR("(X=100.000000,Y=-250.000000,Z=32.000000)"),
+                                         STR("/Script/Engine.StaticMesh'\"/Game/Meshes/SM_Sword.SM_Sword\"'"),
+                                         STR("(GameplayTags=((TagName=\"Item.Weapon\")))")};
+    std::vector<StringType> row_names{};
+    for (size_t i = 0; i < num_rows; ++i)
+    {
+        row_names.emplace_back(STR("Row_") + std::to_wstring(i));
+    }
+
+    auto directory = std::filesystem::temp_directory_path() / "TableExportWriterBench";
+    std::filesystem::create_directories(directory);
+    auto path = directory / "table";
+
+    auto write_table = [&](TableExportFormat format) {
+        TableExportWriter writer{path, format};
+        writer.begin(column_names);
+        for (const auto& row_name : row_names)
+        {
+            writer.begin_row(row_name);
+            for (size_t i = 0; i < column_names.size(); ++i)
+            {
+                writer.write_value(column_names[i], values[i]);
+            }
+            writer.end_row();
+        }
+        writer.end();
+    };
+
+    write_table(TableExportFormat::CSV);
+    benchmark_throughput("TableExportWriter, 10k rows, CSV", static_cast<size_t>(std::filesystem::file_size(path)), 3, [&] {
+        write_table(TableExportFormat::CSV);
+    });
+    write_table(TableExportFormat::JSON);
+    benchmark_throughput("TableExportWriter, 10k rows, JSON", static_cast<size_t>(std::filesystem::file_size(path)), 3, [&] {
+        write_table(TableExportFormat::JSON);
+    });
+
+    std::filesystem::remove_all(directory);
+
+    return report();
+}
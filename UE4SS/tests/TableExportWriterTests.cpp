@@ -0,0 +1,87 @@
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include <ObjectDumper/TableExportWriter.hpp>
+#include <TestHarness/TestHarness.hpp>
+
+using namespace RC;
+using namespace RC::ObjectDumper;
+
+static auto read_file(const std::filesystem::path& path) -> std::string
+{
+    std::ifstream stream{path, std::ios::binary};
+    return {std::istreambuf_iterator<char>{stream}, std::istreambuf_iterator<char>{}};
+}
+
+// A 'Name' column next to the row name, which used to produce duplicate keys in JSON rows
+static auto write_table(const std::filesystem::path& path, TableExportFormat format) -> size_t
+{
+    const std::vector<StringType> column_names{STR("Name"), STR("Description")};
+
+    TableExportWriter writer{path, format};
+    writer.begin(column_names);
+    writer.begin_row(STR("Row_0"));
+    writer.write_value(column_names[0], STR("Sword"));
+    writer.write_value(column_names[1], STR("A \"sharp\" blade"));
+    writer.end_row();
+    writer.begin_row(STR("Row_1"));
+    writer.write_value(column_names[0], STR("Shield"));
+    writer.write_value(column_names[1], STR(""));
+    writer.end_row();
+    writer.end();
+    return writer.get_num_rows();
+}
+
+static auto test_csv(const std::filesystem::path& path) -> void
+{
+    CHECK(write_table(path, TableExportFormat::CSV) == 2);
+    CHECK(read_file(path) == "---,\"Name\",\"Description\"\n"
+                             "\"Row_0\",\"Sword\",\"A \"\"sharp\"\" blade\"\n"
+                             "\"Row_1\",\"Shield\",\"\"\n");
+}
+
+static auto test_json(const std::filesystem::path& path) -> void
+{
+    CHECK(write_table(path, TableExportFormat::JSON) == 2);
+    CHECK(read_file(path) == "{\n"
+                             "  \"Row_0\":{\"Name\":\"Sword\",\"Description\":\"A \\\"sharp\\\" blade\"},\n"
+                             "  \"Row_1\":{\"Name\":\"Shield\",\"Description\":\"\"}\n"
+                             "}\n");
+}
+
+static auto test_empty_table(const std::filesystem::path& path) -> void
+{
+    {
+        TableExportWriter writer{path, TableExportFormat::JSON};
+        writer.begin({});
+        writer.begin_row(STR("Row_0"));
+        writer.end_row();
+        writer.end();
+    }
+    CHECK(read_file(path) == "{\n  \"Row_0\":{}\n}\n");
+
+    {
+        TableExportWriter writer{path, TableExportFormat::JSON};
+        writer.begin({});
+        writer.end();
+    }
+    CHECK(read_file(path) == "{\n}\n");
+}
+
+int main()
+{
+    auto directory = std::filesystem::temp_directory_path() / "TableExportWriterTests";
+    std::filesystem::create_directories(directory);
+    auto path = directory / "table";
+
+    test_csv(path);
+    test_json(path);
+    test_empty_table(path);
+
+    std::filesystem::remove_all(directory);
+
+    return RC::TestHarness::report();
+}
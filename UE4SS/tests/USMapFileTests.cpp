@@ -0,0 +1,99 @@
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <TestHarness/TestHarness.hpp>
+#include <USMapGenerator/USMapFile.hpp>
+
+using namespace RC::OutTheShade;
+using RC::TestHarness::throws;
+
+// Same layout as the name table at the start of the payload built by 'generate_usmap'
+static auto make_payload(const std::vector<std::string>& names, size_t num_padding_bytes) -> std::vector<uint8_t>
+{
+    auto num_names = static_cast<uint32_t>(names.size());
+    std::vector<uint8_t> payload(sizeof(num_names));
+    std::memcpy(payload.data(), &num_names, sizeof(num_names));
+    for (const auto& name : names)
+    {
+        payload.emplace_back(static_cast<uint8_t>(name.size()));
+        payload.insert(payload.end(), name.begin(), name.end());
+    }
+    for (size_t i = 0; i < num_padding_bytes; ++i)
+    {
+        payload.emplace_back(static_cast<uint8_t>((i * 7) % 13));
+    }
+    return payload;
+}
+
+static auto parse_names(const std::vector<uint8_t>& payload) -> std::vector<std::string>
+{
+    uint32_t num_names{};
+    std::memcpy(&num_names, payload.data(), sizeof(num_names));
+    size_t pos = sizeof(num_names);
+
+    std::vector<std::string> names{};
+    for (uint32_t i = 0; i < num_names; ++i)
+    {
+        auto length = payload.at(pos++);
+        names.emplace_back(reinterpret_cast<const char*>(&payload.at(pos)), length);
+        pos += length;
+    }
+    return names;
+}
+
+static auto test_round_trip(const std::filesystem::path& path, ECompressionMethod compression_method) -> void
+{
+    const std::vector<std::string> names{"None", "ByteProperty", "Engine", "/Script/CoreUObject", "Object"};
+    const auto payload = make_payload(names, 1 << 20);
+    write_usmap_file(path, payload, compression_method, 19);
+
+    USMapHeader header{};
+    auto read_payload = read_usmap_file(path, &header);
+    CHECK(header.magic == usmap_magic);
+    CHECK(header.version == 0);
+    CHECK(header.compression_method == compression_method);
+    CHECK(header.decompressed_size == payload.size());
+    CHECK(std::filesystem::file_size(path) == sizeof(uint16_t) + 2 * sizeof(uint8_t) + 2 * sizeof(uint32_t) + header.compressed_size);
+    if (compression_method == ECompressionMethod::ZStandard)
+    {
+        CHECK(header.compressed_size < header.decompressed_size / 10);
+    }
+    CHECK(read_payload == payload);
+    CHECK(parse_names(read_payload) == names);
+}
+
+int main()
+{
+    auto directory = std::filesystem::temp_directory_path() / "USMapFileTests";
+    std::filesystem::create_directories(directory);
+    auto path = directory / "Mappings.usmap";
+
+    test_round_trip(path, ECompressionMethod::None);
+    test_round_trip(path, ECompressionMethod::ZStandard);
+    CHECK(throws([&] {
+        write_usmap_file(path, make_payload({}, 16), ECompressionMethod::Brotli, 0);
+    }));
+
+    // Truncated payload
+    write_usmap_file(path, make_payload({"Truncated"}, 4096), ECompressionMethod::ZStandard, 3);
+    std::filesystem::resize_file(path, std::filesystem::file_size(path) - 1);
+    CHECK(throws([&] {
+        read_usmap_file(path);
+    }));
+
+    // Wrong magic
+    {
+        std::ofstream stream{path, std::ios::binary};
+        stream << "not a usmap file";
+    }
+    CHECK(throws([&] {
+        read_usmap_file(path);
+    }));
+
+    std::filesystem::remove_all(directory);
+
+    return RC::TestHarness::report();
+}
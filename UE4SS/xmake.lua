@@ -9,6 +9,7 @@ add_requires("glfw 3.3.9", { debug = is_mode_debug() , configs = {runtimes = get
 add_requires("opengl", { debug = is_mode_debug(), configs = {runtimes = get_mode_runtimes()} })
 add_requires("glaze v2.9.5", { debug = is_mode_debug(), configs = {runtimes = get_mode_runtimes()} })
 add_requires("fmt 11.2.0", { debug = is_mode_debug(), configs = {runtimes = get_mode_runtimes()} })
+add_requires("zstd 1.5.6", { debug = is_mode_debug(), configs = {runtimes = get_mode_runtimes()} })
 
 option("ue4ssBetaIsStarted")
     set_default(true)
@@ -81,6 +82,8 @@ target(projectName)
 
     add_packages("glaze", "polyhook_2", { public = true })
 
+    add_packages("zstd")
+
     add_links("dbghelp", "psapi", "d3d11", { public = true })
 
     after_load(function (target)
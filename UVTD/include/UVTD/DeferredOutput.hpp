@@ -0,0 +1,39 @@
+#pragma once
+
+#include <vector>
+
+#include <DynamicOutput/DynamicOutput.hpp>
+#include <File/File.hpp>
+
+namespace RC::UVTD
+{
+    // Holds on to log messages until 'flush' is called
+    // The default output devices aren't thread safe, dumpers running on worker threads log here and the main thread flushes in PDB order
+    class DeferredOutput
+    {
+      private:
+        std::vector<File::StringType> messages{};
+
+      public:
+        template <typename... FmtArgs>
+        auto send(File::StringViewType content, FmtArgs... fmt_args) -> void
+        {
+            messages.emplace_back(fmt::vformat(fmt::detail::to_string_view(content), RC_STD_MAKE_FORMAT_ARGS(fmt_args...)));
+        }
+
+        auto append(DeferredOutput& other) -> void
+        {
+            messages.insert(messages.end(), std::make_move_iterator(other.messages.begin()), std::make_move_iterator(other.messages.end()));
+            other.messages.clear();
+        }
+
+        auto flush() -> void
+        {
+            for (const auto& message : messages)
+            {
+                Output::send(STR("{}"), message);
+            }
+            messages.clear();
+        }
+    };
+} // namespace RC::UVTD
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdio>
 #include <stdexcept>
 
 #include <DynamicOutput/DynamicOutput.hpp>
@@ -24,7 +25,11 @@ namespace RC
             }
             else
             {
+#ifdef _WIN32
                 printf_s("Internal Error: %s\n", e.what());
+#else
+                printf("Internal Error: %s\n", e.what());
+#endif
             }
         }
     }
@@ -8,10 +8,6 @@
 #include <File/File.hpp>
 #include <UVTD/Symbols.hpp>
 
-#define NOMINMAX
-#include <Windows.h>
-#undef NOMINMAX
-
 namespace RC::UVTD
 {
     // Output paths for generated files
@@ -35,4 +31,7 @@ namespace RC::UVTD
 
     // Workaround that lets us have a unified 'TUObjectArray' struct regardless if the engine version uses a chunked or non-chunked variant of TUObjectArray.
     auto unify_uobject_array_if_needed(StringType& out_variable_type) -> bool;
+
+    // Highest amount of physical memory used by the process so far, in bytes
+    auto get_peak_memory_usage() -> size_t;
 } // namespace RC::UVTD
@@ -3,6 +3,7 @@
 #include <unordered_map>
 
 #include <File/File.hpp>
+#include <UVTD/DeferredOutput.hpp>
 #include <UVTD/Symbols.hpp>
 #include <UVTD/TypeContainer.hpp>
 
@@ -11,12 +12,13 @@ namespace RC::UVTD
     class MemberVarsDumper
     {
       private:
-        Symbols symbols;
+        const Symbols& symbols;
         TypeContainer type_container;
+        DeferredOutput output;
 
       public:
         MemberVarsDumper() = delete;
-        explicit MemberVarsDumper(Symbols symbols) : symbols(std::move(symbols))
+        explicit MemberVarsDumper(const Symbols& symbols) : symbols(symbols)
         {
         }
 
@@ -25,7 +27,7 @@ namespace RC::UVTD
                            const PDB::CodeView::TPI::Record* class_record,
                            const File::StringType& class_name,
                            const SymbolNameInfo& name_info) -> void;
-        auto process_member(const PDB::TPIStream& tpi_stream, const PDB::CodeView::TPI::FieldList* field_record, Class& class_entry) -> void;
+        auto process_member(const PDB::TPIStream& tpi_stream, const PDB::CodeView::TPI::FieldList* field_record, uint32_t class_index) -> void;
 
       private:
         auto dump_member_variable_layouts(std::unordered_map<File::StringType, SymbolNameInfo>& names) -> void;
@@ -40,6 +42,11 @@ namespace RC::UVTD
             return type_container;
         }
 
+        auto get_output() -> DeferredOutput&
+        {
+            return output;
+        }
+
       public:
         static auto output_cleanup() -> void;
     };
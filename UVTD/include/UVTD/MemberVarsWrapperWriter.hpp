@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include <File/Macros.hpp>
+
+namespace RC::UVTD
+{
+    struct WrappedMemberVariable
+    {
+        File::StringType name;
+        File::StringType type;
+        bool is_private;
+    };
+
+    using MemberRenameMap = std::unordered_map<File::StringType, File::StringType>;
+
+    // Text of the generated member variable wrappers, kept apart from the PDB walk so that the output can be compiled and tested on its own
+    // 'class_name' is the name the accessors are defined on, after 'unify_uobject_array_if_needed'
+    auto write_member_vars_header_wrapper(File::StringType& out, const std::vector<WrappedMemberVariable>& wrapped_variables) -> void;
+    auto write_member_vars_src_wrapper(File::StringType& out,
+                                       const File::StringType& class_name,
+                                       const std::vector<WrappedMemberVariable>& wrapped_variables) -> void;
+    auto write_member_vars_macro_setter(File::StringType& out,
+                                        const File::StringType& class_name,
+                                        const std::vector<WrappedMemberVariable>& wrapped_variables,
+                                        const MemberRenameMap& rename_map) -> void;
+    auto write_member_vars_default_setter(File::StringType& out,
+                                          const File::StringType& class_name,
+                                          const File::StringType& variable_name,
+                                          int32_t offset) -> void;
+} // namespace RC::UVTD
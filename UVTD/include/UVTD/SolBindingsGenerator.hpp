@@ -3,6 +3,7 @@
 #include <unordered_map>
 
 #include <File/File.hpp>
+#include <UVTD/DeferredOutput.hpp>
 #include <UVTD/Symbols.hpp>
 #include <UVTD/TypeContainer.hpp>
 
@@ -11,13 +12,14 @@ namespace RC::UVTD
     class SolBindingsGenerator
     {
       private:
-        Symbols symbols;
+        const Symbols& symbols;
         TypeContainer type_container;
+        DeferredOutput output;
 
       public:
         SolBindingsGenerator() = delete;
 
-        explicit SolBindingsGenerator(Symbols symbols) : symbols(std::move(symbols))
+        explicit SolBindingsGenerator(const Symbols& symbols) : symbols(symbols)
         {
         }
 
@@ -25,6 +27,12 @@ namespace RC::UVTD
         auto generate_code() -> void;
         auto generate_files() -> void;
 
+      public:
+        auto get_output() -> DeferredOutput&
+        {
+            return output;
+        }
+
       public:
         static auto output_cleanup() -> void;
     };
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <shared_mutex>
+#include <unordered_map>
+#include <vector>
+
+#include <File/File.hpp>
+
+namespace RC::UVTD
+{
+    // Handle to a string in the StringPool, equal strings always have equal ids
+    using StringId = uint32_t;
+
+    /*
+        Deduplicated storage for the class, member, type and function names of every PDB
+
+        Characters are appended to fixed size chunks that are never moved or freed, views returned by 'view' stay valid for the lifetime of the pool
+        Interning and viewing are thread safe, dumpers on worker threads intern while the main thread writes files
+    */
+    class StringPool
+    {
+      public:
+        constexpr static size_t chars_per_chunk = 1 << 16;
+        // Interned by the constructor, so a value initialized StringId is the empty string
+        constexpr static StringId empty_string = 0;
+
+      private:
+        mutable std::shared_mutex mutex;
+        std::vector<std::unique_ptr<File::CharType[]>> chunks;
+        File::CharType* current_chunk{};
+        size_t num_chars_in_chunk{chars_per_chunk};
+        size_t num_chars{};
+        std::vector<File::StringViewType> strings;
+        std::unordered_map<File::StringViewType, StringId> ids_by_string;
+
+      public:
+        StringPool();
+        StringPool(const StringPool&) = delete;
+        StringPool& operator=(const StringPool&) = delete;
+
+      public:
+        // Every TypeContainer interns into this pool, names repeat across PDBs so one pool is shared by all of them
+        auto static shared() -> StringPool&;
+
+      public:
+        auto intern(File::StringViewType string) -> StringId;
+        auto view(StringId id) const -> File::StringViewType;
+
+        auto get_num_strings() const -> size_t;
+        // Bytes held by the characters, the id table and the lookup map, not counting allocator overhead
+        auto get_memory_usage() const -> size_t;
+
+      private:
+        auto store(File::StringViewType string) -> File::StringViewType;
+    };
+} // namespace RC::UVTD
@@ -1,7 +1,6 @@
 #pragma once
 
 #include <format>
-#include <map>
 #include <unordered_map>
 #include <vector>
 
@@ -42,13 +41,6 @@ namespace RC::UVTD
         }
     };
 
-    struct MemberVariable
-    {
-        File::StringType type;
-        File::StringType name;
-        int32_t offset;
-    };
-
     struct FunctionParam
     {
         File::StringType type;
@@ -80,52 +72,14 @@ namespace RC::UVTD
         }
     };
 
-    struct MethodBody
-    {
-        File::StringType name;
-        MethodSignature signature;
-        uint32_t offset;
-        bool is_overload;
-    };
-
-    struct Class
-    {
-        File::StringType class_name;
-        File::StringType class_name_clean;
-        std::map<uint32_t, MethodBody> functions;
-        // Key: Variable name
-        std::map<File::StringType, MemberVariable> variables;
-        uint32_t last_virtual_offset{};
-        ValidForVTable valid_for_vtable{ValidForVTable::No};
-        ValidForMemberVars valid_for_member_vars{ValidForMemberVars::No};
-    };
-
     class Symbols
     {
       public:
-        struct MemberVariable
-        {
-            File::StringType type;
-            int32_t offset;
-        };
-
-        struct EnumEntry
+        // A complete (non forward declared) LF_CLASS or LF_STRUCTURE record
+        struct ClassRecord
         {
             File::StringType name;
-            File::StringType name_clean;
-            std::map<File::StringType, MemberVariable> variables;
-        };
-
-        struct Class
-        {
-            File::StringType class_name;
-            File::StringType class_name_clean;
-            std::map<uint32_t, MethodBody> functions;
-            // Key: Variable name
-            std::map<File::StringType, MemberVariable> variables;
-            uint32_t last_virtual_offset;
-            ValidForVTable valid_for_vtable{ValidForVTable::No};
-            ValidForMemberVars valid_for_member_vars{ValidForMemberVars::No};
+            const PDB::CodeView::TPI::Record* record;
         };
 
       public:
@@ -135,26 +89,23 @@ namespace RC::UVTD
 
         PDB::RawFile pdb_file;
         PDB::DBIStream dbi_stream;
+        PDB::TPIStream tpi_stream;
         bool is_425_plus;
 
-        std::unordered_map<File::StringType, EnumEntry> enum_entries;
-        std::unordered_map<File::StringType, Class> class_entries;
+        // Every class and struct in the TPI stream, in record order
+        std::vector<ClassRecord> class_records;
 
       public:
         Symbols() = delete;
 
+        // Maps and parses the PDB, the result is immutable and meant to be shared by every dumper for this PDB
         explicit Symbols(std::filesystem::path pdb_file_path);
 
-        Symbols(const Symbols& other);
-
-        Symbols& operator=(const Symbols& other);
+        Symbols(const Symbols&) = delete;
+        Symbols& operator=(const Symbols&) = delete;
 
       public:
-        auto get_or_create_enum_entry(const File::StringType& symbol_name, const File::StringType& symbol_name_clean) -> EnumEntry&;
-        auto get_or_create_class_entry(const File::StringType& symbol_name, const File::StringType& symbol_name_clean, const SymbolNameInfo& name_info) -> Class&;
-
-        auto generate_method_signature(const PDB::TPIStream& tpi_stream, const PDB::CodeView::TPI::Record* function_record, File::StringType method_name)
-                -> MethodSignature;
+        auto generate_method_signature(const PDB::CodeView::TPI::Record* function_record, File::StringType method_name) const -> MethodSignature;
 
       public:
         auto static get_type_name(const PDB::TPIStream& tpi_stream, uint32_t record_index, bool check_valid = false) -> File::StringType;
@@ -164,8 +115,5 @@ namespace RC::UVTD
         auto static clean_name(File::StringType name) -> File::StringType;
 
         auto static is_virtual(PDB::CodeView::TPI::MemberAttributes attributes) -> bool;
-
-      private:
-        auto setup_symbol_loader() -> void;
     };
 } // namespace RC::UVTD
\ No newline at end of file
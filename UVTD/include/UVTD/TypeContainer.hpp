@@ -1,29 +1,105 @@
 #pragma once
 
+#include <cstdint>
+#include <span>
 #include <unordered_map>
+#include <vector>
 
 #include <File/File.hpp>
+#include <UVTD/StringPool.hpp>
 #include <UVTD/Symbols.hpp>
 
 namespace RC::UVTD
 {
+    struct MemberVariable
+    {
+        StringId type;
+        StringId name;
+        int32_t offset;
+    };
+
+    struct MethodBody
+    {
+        StringId name;
+        // Result of MethodSignature::to_string
+        StringId signature;
+        uint32_t offset;
+        bool is_overload;
+    };
+
+    struct Class
+    {
+        StringId class_name;
+        StringId class_name_clean;
+        ValidForVTable valid_for_vtable{ValidForVTable::No};
+        ValidForMemberVars valid_for_member_vars{ValidForMemberVars::No};
+        // Position of this class's rows in the container's function and variable tables
+        uint32_t first_function{};
+        uint32_t num_functions{};
+        uint32_t first_variable{};
+        uint32_t num_variables{};
+    };
+
+    /*
+        Classes dumped from one or more PDBs along with their virtual functions and member variables
+
+        Names are StringPool handles, and the functions and variables of every class are stored contiguously in two tables owned by the container
+        Setting a function or variable that a class already has replaces it, functions are ordered by vtable offset and variables by name
+        Tables are only in order after 'compact', 'join' calls it by itself
+    */
     class TypeContainer
     {
       private:
-        using ClassEntries = std::unordered_map<File::StringType, Class>;
+        std::vector<Class> classes;
+        // Key: Clean class name, Value: Index in 'classes'
+        std::unordered_map<StringId, uint32_t> class_index_by_name;
 
-        ClassEntries class_entries;
+        std::vector<MethodBody> functions;
+        std::vector<uint32_t> function_class_indices;
+        std::vector<MemberVariable> variables;
+        std::vector<uint32_t> variable_class_indices;
+        bool is_compact{true};
 
       public:
+        // Merges by handle, nothing is copied apart from the table rows, rows from 'other' replace existing ones
         auto join(const TypeContainer& other) -> void;
 
+        // Sorts the tables, drops replaced rows and updates the ranges in every Class
+        auto compact() -> void;
+
       public:
-        constexpr auto get_class_entries() const -> const ClassEntries&
+        auto get_classes() const -> const std::vector<Class>&
+        {
+            return classes;
+        }
+
+        auto get_functions(const Class& class_entry) const -> std::span<const MethodBody>
+        {
+            return std::span{functions}.subspan(class_entry.first_function, class_entry.num_functions);
+        }
+
+        auto get_variables(const Class& class_entry) const -> std::span<const MemberVariable>
+        {
+            return std::span{variables}.subspan(class_entry.first_variable, class_entry.num_variables);
+        }
+
+        auto get_num_functions() const -> size_t
+        {
+            return functions.size();
+        }
+
+        auto get_num_variables() const -> size_t
         {
-            return class_entries;
+            return variables.size();
         }
 
       public:
-        auto get_or_create_class_entry(const File::StringType& symbol_name, const File::StringType& symbol_name_clean, const SymbolNameInfo& name_info) -> Class&;
+        // Returns the index of the class, pass it to 'set_function' and 'set_variable'
+        auto get_or_create_class_entry(const File::StringType& symbol_name, const File::StringType& symbol_name_clean, const SymbolNameInfo& name_info)
+                -> uint32_t;
+        auto get_or_create_class_entry(StringId symbol_name, StringId symbol_name_clean, const SymbolNameInfo& name_info) -> uint32_t;
+
+        auto set_function(uint32_t class_index, const MethodBody& function) -> void;
+        auto set_variable(uint32_t class_index, const MemberVariable& variable) -> void;
     };
-} // namespace RC::UVTD
\ No newline at end of file
+} // namespace RC::UVTD
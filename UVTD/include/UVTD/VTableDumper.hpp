@@ -4,6 +4,7 @@
 #include <unordered_map>
 
 #include <File/File.hpp>
+#include <UVTD/DeferredOutput.hpp>
 #include <UVTD/Symbols.hpp>
 #include <UVTD/TypeContainer.hpp>
 
@@ -14,14 +15,17 @@ namespace RC::UVTD
     class VTableDumper
     {
       private:
-        Symbols symbols;
+        const Symbols& symbols;
         TypeContainer type_container;
+        DeferredOutput output;
+        // Key: Class name, Value: Method name -> Number of overloads
+        std::unordered_map<File::StringType, std::unordered_map<File::StringType, uint32_t>> functions_already_dumped;
 
         bool are_symbols_cached{};
 
       public:
         VTableDumper() = delete;
-        explicit VTableDumper(Symbols symbols) : symbols(std::move(symbols))
+        explicit VTableDumper(const Symbols& symbols) : symbols(symbols)
         {
         }
 
@@ -35,14 +39,19 @@ namespace RC::UVTD
             return type_container;
         }
 
+        auto get_output() -> DeferredOutput&
+        {
+            return output;
+        }
+
       private:
         auto process_class(const PDB::TPIStream& tpi_stream,
                            const PDB::CodeView::TPI::Record* class_record,
                            const File::StringType& class_name,
                            const SymbolNameInfo& name_info) -> void;
 
-        auto process_method_overload_list(const PDB::TPIStream& tpi_stream, const PDB::CodeView::TPI::FieldList* method_record, Class& class_entry) -> void;
-        auto process_onemethod(const PDB::TPIStream& tpi_stream, const PDB::CodeView::TPI::FieldList* onemethod_record, Class& class_entry) -> void;
+        auto process_method_overload_list(const PDB::TPIStream& tpi_stream, const PDB::CodeView::TPI::FieldList* method_record, uint32_t class_index) -> void;
+        auto process_onemethod(const PDB::TPIStream& tpi_stream, const PDB::CodeView::TPI::FieldList* onemethod_record, uint32_t class_index) -> void;
 
       private:
         auto dump_vtable_for_symbol(std::unordered_map<File::StringType, SymbolNameInfo>& names) -> void;
@@ -1,9 +1,19 @@
+#include <cstdlib>
+#include <cstring>
 #include <format>
 
 #include <Helpers/String.hpp>
 #include <UVTD/ConfigUtil.hpp>
 #include <UVTD/Helpers.hpp>
 
+#ifdef _WIN32
+#define NOMINMAX
+#include <Windows.h>
+#include <Psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
 namespace RC::UVTD
 {
     auto to_string_type(const char* c_str) -> File::StringType
@@ -14,8 +24,12 @@ namespace RC::UVTD
         size_t count = strlen(c_str) + 1;
         wchar_t* converted_method_name = new wchar_t[count];
 
+#ifdef _WIN32
         size_t num_of_char_converted = 0;
         mbstowcs_s(&num_of_char_converted, converted_method_name, count, c_str, count);
+#else
+        std::mbstowcs(converted_method_name, c_str, count);
+#endif
 
         auto converted = File::StringType(converted_method_name);
 
@@ -60,4 +74,28 @@ namespace RC::UVTD
             return false;
         }
     }
-} // namespace RC::UVTD
\ No newline at end of file
+
+    auto get_peak_memory_usage() -> size_t
+    {
+#ifdef _WIN32
+        PROCESS_MEMORY_COUNTERS memory_counters{};
+        if (!GetProcessMemoryInfo(GetCurrentProcess(), &memory_counters, sizeof(memory_counters)))
+        {
+            return 0;
+        }
+        return memory_counters.PeakWorkingSetSize;
+#else
+        rusage usage{};
+        if (getrusage(RUSAGE_SELF, &usage) != 0)
+        {
+            return 0;
+        }
+#ifdef __APPLE__
+        return static_cast<size_t>(usage.ru_maxrss);
+#else
+        // Linux reports kilobytes
+        return static_cast<size_t>(usage.ru_maxrss) * 1024;
+#endif
+#endif
+    }
+} // namespace RC::UVTD
@@ -5,6 +5,7 @@
 #include <UVTD/ConfigUtil.hpp>
 #include <UVTD/Helpers.hpp>
 #include <UVTD/MemberVarsDumper.hpp>
+#include <UVTD/MemberVarsWrapperWriter.hpp>
 
 namespace RC::UVTD
 {
@@ -18,7 +19,7 @@ namespace RC::UVTD
 
         File::StringType class_name = *changed;
         File::StringType class_name_clean = Symbols::clean_name(class_name);
-        auto& class_entry = type_container.get_or_create_class_entry(class_name, class_name_clean, name_info);
+        auto class_index = type_container.get_or_create_class_entry(class_name, class_name_clean, name_info);
 
         auto fields = tpi_stream.GetTypeRecord(class_record->data.LF_CLASS.field);
 
@@ -29,12 +30,12 @@ namespace RC::UVTD
 
             if (field_record->kind == PDB::CodeView::TPI::TypeRecordKind::LF_MEMBER)
             {
-                process_member(tpi_stream, field_record, class_entry);
+                process_member(tpi_stream, field_record, class_index);
             }
         }
     }
 
-    auto MemberVarsDumper::process_member(const PDB::TPIStream& tpi_stream, const PDB::CodeView::TPI::FieldList* field_record, Class& class_entry) -> void
+    auto MemberVarsDumper::process_member(const PDB::TPIStream& tpi_stream, const PDB::CodeView::TPI::FieldList* field_record, uint32_t class_index) -> void
     {
         File::StringType member_name = Symbols::get_leaf_name(field_record->data.LF_STMEMBER.name, field_record->data.LF_MEMBER.lfEasy.kind);
         auto changed = change_prefix(Symbols::get_type_name(tpi_stream, field_record->data.LF_MEMBER.index), symbols.is_425_plus);
@@ -52,36 +53,28 @@ namespace RC::UVTD
             }
         }
 
-        auto& variable = class_entry.variables[member_name];
-        variable.type = type_name;
-        variable.name = member_name;
-        variable.offset = *(uint16_t*)field_record->data.LF_MEMBER.offset;
+        auto& string_pool = StringPool::shared();
+        type_container.set_variable(class_index,
+                                    MemberVariable{.type = string_pool.intern(type_name),
+                                                   .name = string_pool.intern(member_name),
+                                                   .offset = *(uint16_t*)field_record->data.LF_MEMBER.offset});
     }
 
     auto MemberVarsDumper::dump_member_variable_layouts(std::unordered_map<File::StringType, SymbolNameInfo>& names) -> void
     {
-        Output::send(STR("Dumping {} symbols for {}\n"), names.size(), symbols.pdb_file_path.filename().stem().wstring());
+        output.send(STR("Dumping {} symbols for {}\n"), names.size(), symbols.pdb_file_path.filename().stem().wstring());
 
-        const PDB::TPIStream tpi_stream = PDB::CreateTPIStream(symbols.pdb_file);
+        const PDB::TPIStream& tpi_stream = symbols.tpi_stream;
 
-        for (const PDB::CodeView::TPI::Record* type_record : tpi_stream.GetTypeRecords())
+        for (const auto& [class_name, type_record] : symbols.class_records)
         {
-            if (type_record->header.kind == PDB::CodeView::TPI::TypeRecordKind::LF_CLASS ||
-                type_record->header.kind == PDB::CodeView::TPI::TypeRecordKind::LF_STRUCTURE)
-            {
-                if (type_record->data.LF_CLASS.property.fwdref) continue;
-
-                const File::StringType class_name = Symbols::get_leaf_name(type_record->data.LF_CLASS.data, type_record->data.LF_CLASS.lfEasy.kind);
-                if (!names.contains(class_name)) continue;
+            const auto name_info = names.find(class_name);
+            if (name_info == names.end()) continue;
 
-                const auto name_info = names.find(class_name);
-                if (name_info == names.end()) continue;
-
-                process_class(tpi_stream, type_record, class_name, name_info->second);
-            }
+            process_class(tpi_stream, type_record, class_name, name_info->second);
         }
 
-        return;
+        type_container.compact();
     }
 
     auto MemberVarsDumper::generate_code() -> void
@@ -100,7 +93,7 @@ namespace RC::UVTD
 
     auto MemberVarsDumper::generate_files() -> void
     {
-        File::StringType pdb_name = symbols.pdb_file_path.filename().stem();
+        File::StringType pdb_name = symbols.pdb_file_path.filename().stem().wstring();
 
         auto default_template_file = std::filesystem::path{STR("MemberVariableLayout.ini")};
 
@@ -124,18 +117,23 @@ namespace RC::UVTD
             return File::StringType{string};
         });
 
+        const auto& string_pool = StringPool::shared();
+
         auto pdb_name_no_underscore = pdb_name;
         pdb_name_no_underscore.replace(pdb_name_no_underscore.find(STR('_')), 1, STR(""));
+        File::StringType default_setter_text{};
 
-        for (const auto& [class_name, class_entry] : type_container.get_class_entries())
+        for (const auto& class_entry : type_container.get_classes())
         {
-            if (class_entry.variables.empty())
+            if (class_entry.num_variables == 0)
             {
                 continue;
             }
 
+            auto class_name = string_pool.view(class_entry.class_name);
+
             auto default_setter_src_file = member_variable_layouts_gen_function_bodies_path /
-                                           std::format(STR("{}_MemberVariableLayout_DefaultSetter_{}.cpp"), pdb_name, class_entry.class_name_clean);
+                                           std::format(STR("{}_MemberVariableLayout_DefaultSetter_{}.cpp"), pdb_name, string_pool.view(class_entry.class_name_clean));
 
             Output::send(STR("Generating file '{}'\n"), default_setter_src_file.wstring());
 
@@ -146,31 +144,29 @@ namespace RC::UVTD
                 return File::StringType{string};
             });
 
-            ini_dumper.send(STR("[{}]\n"), class_entry.class_name);
-            default_ini_dumper.send(STR("[{}]\n"), class_entry.class_name);
+            ini_dumper.send(STR("[{}]\n"), class_name);
+            default_ini_dumper.send(STR("[{}]\n"), class_name);
 
-            for (const auto& [variable_name, variable] : class_entry.variables)
+            for (const auto& variable : type_container.get_variables(class_entry))
             {
-                ini_dumper.send(STR("{} = 0x{:X}\n"), variable.name, variable.offset);
-                default_ini_dumper.send(STR("{} = -1\n"), variable.name);
+                auto variable_name = string_pool.view(variable.name);
+
+                ini_dumper.send(STR("{} = 0x{:X}\n"), variable_name, variable.offset);
+                default_ini_dumper.send(STR("{} = -1\n"), variable_name);
 
-                File::StringType final_variable_name = variable.name;
-                File::StringType final_class_name = class_entry.class_name;
+                File::StringType final_variable_name{variable_name};
+                File::StringType final_class_name{class_name};
 
-                if (variable.name == STR("EnumFlags"))
+                if (variable_name == STR("EnumFlags"))
                 {
                     final_variable_name = STR("EnumFlags_Internal");
                 }
 
                 unify_uobject_array_if_needed(final_class_name);
 
-                default_setter_src_dumper.send(STR("if (auto it = {}::MemberOffsets.find(STR(\"{}\")); it == {}::MemberOffsets.end())\n"),
-                                               final_class_name,
-                                               final_variable_name,
-                                               final_class_name);
-                default_setter_src_dumper.send(STR("{\n"));
-                default_setter_src_dumper.send(STR("    {}::MemberOffsets.emplace(STR(\"{}\"), 0x{:X});\n"), final_class_name, final_variable_name, variable.offset);
-                default_setter_src_dumper.send(STR("}\n\n"));
+                default_setter_text.clear();
+                write_member_vars_default_setter(default_setter_text, final_class_name, final_variable_name, variable.offset);
+                default_setter_src_dumper.send(STR("{}"), default_setter_text);
             }
 
             ini_dumper.send(STR("\n"));
@@ -1,12 +1,70 @@
 #include <format>
+#include <vector>
 
 #include <DynamicOutput/DynamicOutput.hpp>
 #include <UVTD/ConfigUtil.hpp>
 #include <UVTD/Helpers.hpp>
 #include <UVTD/MemberVarsWrapperGenerator.hpp>
+#include <UVTD/MemberVarsWrapperWriter.hpp>
 
 namespace RC::UVTD
 {
+    // The member variables that get an accessor, in the order of their offset cache entries
+    static auto collect_wrapped_member_variables(const TypeContainer& type_container, const Class& class_entry) -> std::vector<WrappedMemberVariable>
+    {
+        std::vector<WrappedMemberVariable> wrapped_variables{};
+        const auto& string_pool = StringPool::shared();
+
+        // Use configuration instead of hardcoded values
+        const auto& private_variables_map = ConfigUtil::GetPrivateVariables();
+        auto private_variables_for_class = private_variables_map.find(File::StringType{string_pool.view(class_entry.class_name)});
+
+        for (const auto& variable : type_container.get_variables(class_entry))
+        {
+            auto variable_name = string_pool.view(variable.name);
+            auto variable_type = string_pool.view(variable.type);
+
+            if (variable_type.find(STR("TBaseDelegate")) != variable_type.npos)
+            {
+                continue;
+            }
+            if (variable_type.find(STR("FUniqueNetIdRepl")) != variable_type.npos)
+            {
+                continue;
+            }
+            if (variable_type.find(STR("FPlatformUserId")) != variable_type.npos)
+            {
+                continue;
+            }
+            if (variable_type.find(STR("FVector2D")) != variable_type.npos)
+            {
+                continue;
+            }
+            if (variable_type.find(STR("FReply")) != variable_type.npos)
+            {
+                continue;
+            }
+
+            bool is_private = private_variables_for_class != private_variables_map.end() &&
+                              private_variables_for_class->second.find(File::StringType{variable_name}) != private_variables_for_class->second.end();
+
+            File::StringType final_variable_name{variable_name};
+            File::StringType final_type_name{variable_type};
+
+            if (variable_name == STR("EnumFlags"))
+            {
+                final_variable_name = STR("EnumFlags_Internal");
+                is_private = true;
+            }
+
+            unify_uobject_array_if_needed(final_type_name);
+
+            wrapped_variables.emplace_back(WrappedMemberVariable{std::move(final_variable_name), std::move(final_type_name), is_private});
+        }
+
+        return wrapped_variables;
+    }
+
     auto MemberVarsWrapperGenerator::generate_files() -> void
     {
         auto macro_setter_file = std::filesystem::path{STR("MacroSetter.hpp")};
@@ -20,15 +78,22 @@ namespace RC::UVTD
             return File::StringType{string};
         });
 
-        for (const auto& [class_name, class_entry] : type_container.get_class_entries())
+        const auto& string_pool = StringPool::shared();
+        const auto& rename_map = ConfigUtil::GetMemberRenameMap();
+        File::StringType text{};
+
+        for (const auto& class_entry : type_container.get_classes())
         {
-            if (class_entry.variables.empty())
+            if (class_entry.num_variables == 0)
             {
                 continue;
             }
 
+            File::StringType class_name{string_pool.view(class_entry.class_name)};
+            auto class_name_clean = string_pool.view(class_entry.class_name_clean);
+
             auto wrapper_header_file = member_variable_layouts_gen_output_include_path /
-                                       std::format(STR("MemberVariableLayout_HeaderWrapper_{}.hpp"), class_entry.class_name_clean);
+                                       std::format(STR("MemberVariableLayout_HeaderWrapper_{}.hpp"), class_name_clean);
 
             Output::send(STR("Generating file '{}'\n"), wrapper_header_file.wstring());
 
@@ -40,7 +105,7 @@ namespace RC::UVTD
             });
 
             auto wrapper_src_file =
-                    member_variable_layouts_gen_output_include_path / std::format(STR("MemberVariableLayout_SrcWrapper_{}.hpp"), class_entry.class_name_clean);
+                    member_variable_layouts_gen_output_include_path / std::format(STR("MemberVariableLayout_SrcWrapper_{}.hpp"), class_name_clean);
 
             Output::send(STR("Generating file '{}'\n"), wrapper_src_file.wstring());
 
@@ -51,123 +116,21 @@ namespace RC::UVTD
                 return File::StringType{string};
             });
 
-            auto final_class_name = class_entry.class_name;
+            auto wrapped_variables = collect_wrapped_member_variables(type_container, class_entry);
+            auto final_class_name = class_name;
             unify_uobject_array_if_needed(final_class_name);
-            header_wrapper_dumper.send(STR("static std::unordered_map<File::StringType, int32_t> MemberOffsets;\n\n"));
-            wrapper_src_dumper.send(STR("std::unordered_map<File::StringType, int32_t> {}::MemberOffsets{{}};\n\n"), final_class_name);
-
-            // Use configuration instead of hardcoded values
-            const auto& private_variables_map = ConfigUtil::GetPrivateVariables();
-            auto private_variables_for_class = private_variables_map.find(class_entry.class_name);
 
-            for (const auto& [variable_name, variable] : class_entry.variables)
-            {
-                if (variable.type.find(STR("TBaseDelegate")) != variable.type.npos)
-                {
-                    continue;
-                }
-                if (variable.type.find(STR("FUniqueNetIdRepl")) != variable.type.npos)
-                {
-                    continue;
-                }
-                if (variable.type.find(STR("FPlatformUserId")) != variable.type.npos)
-                {
-                    continue;
-                }
-                if (variable.type.find(STR("FVector2D")) != variable.type.npos)
-                {
-                    continue;
-                }
-                if (variable.type.find(STR("FReply")) != variable.type.npos)
-                {
-                    continue;
-                }
-
-                bool is_private = private_variables_for_class != private_variables_map.end() &&
-                                  private_variables_for_class->second.find(variable.name) != private_variables_for_class->second.end();
+            text.clear();
+            write_member_vars_header_wrapper(text, wrapped_variables);
+            header_wrapper_dumper.send(STR("{}"), text);
 
-                File::StringType final_variable_name = variable.name;
-                File::StringType final_type_name = variable.type;
+            text.clear();
+            write_member_vars_src_wrapper(text, final_class_name, wrapped_variables);
+            wrapper_src_dumper.send(STR("{}"), text);
 
-                if (variable.name == STR("EnumFlags"))
-                {
-                    final_variable_name = STR("EnumFlags_Internal");
-                    is_private = true;
-                }
-
-                unify_uobject_array_if_needed(final_type_name);
-
-                if (is_private)
-                {
-                    header_wrapper_dumper.send(STR("private:\n"));
-                }
-                else
-                {
-                    header_wrapper_dumper.send(STR("public:\n"));
-                }
-
-                header_wrapper_dumper.send(STR("    {}& Get{}();\n"), final_type_name, final_variable_name);
-                header_wrapper_dumper.send(STR("    const {}& Get{}() const;\n\n"), final_type_name, final_variable_name);
-                wrapper_src_dumper.send(STR("{}& {}::Get{}()\n"), final_type_name, final_class_name, final_variable_name);
-                if (class_entry.class_name == STR("FArchive") || class_entry.class_name == STR("FArchiveState"))
-                {
-                    wrapper_src_dumper.send(STR("{\n"));
-                    wrapper_src_dumper.send(
-                            STR("    static auto& offsets = Version::IsBelow(4, 25) ? FArchive::MemberOffsets : FArchiveState::MemberOffsets;\n"));
-                    wrapper_src_dumper.send(STR("    static auto offset = offsets.find(STR(\"{}\"));\n"), final_variable_name);
-                    wrapper_src_dumper.send(STR("    if (offset == offsets.end()) {{ throw std::runtime_error{{\"Tried getting member variable '{}::{}' that "
-                                                "doesn't exist in this engine version.\"}}; }}\n"),
-                                            final_class_name,
-                                            final_variable_name);
-                    wrapper_src_dumper.send(STR("    return *Helper::Casting::ptr_cast<{}*>(this, offset->second);\n"), final_type_name);
-                    wrapper_src_dumper.send(STR("}\n"));
-                    wrapper_src_dumper.send(STR("const {}& {}::Get{}() const\n"), final_type_name, final_class_name, final_variable_name);
-                    wrapper_src_dumper.send(STR("{\n"));
-                    wrapper_src_dumper.send(
-                            STR("    static auto& offsets = Version::IsBelow(4, 25) ? FArchive::MemberOffsets : FArchiveState::MemberOffsets;\n"));
-                    wrapper_src_dumper.send(STR("    static auto offset = offsets.find(STR(\"{}\"));\n"), final_variable_name);
-                    wrapper_src_dumper.send(STR("    if (offset == offsets.end()) {{ throw std::runtime_error{{\"Tried getting member variable '{}::{}' that "
-                                                "doesn't exist in this engine version.\"}}; }}\n"),
-                                            final_class_name,
-                                            final_variable_name);
-                    wrapper_src_dumper.send(STR("    return *Helper::Casting::ptr_cast<const {}*>(this, offset->second);\n"), final_type_name);
-                    wrapper_src_dumper.send(STR("}\n\n"));
-                }
-                else
-                {
-                    wrapper_src_dumper.send(STR("{\n"));
-                    wrapper_src_dumper.send(STR("    static auto offset = MemberOffsets.find(STR(\"{}\"));\n"), final_variable_name);
-                    wrapper_src_dumper.send(STR("    if (offset == MemberOffsets.end()) {{ throw std::runtime_error{{\"Tried getting member variable '{}::{}' "
-                                                "that doesn't exist in this engine version.\"}}; }}\n"),
-                                            final_class_name,
-                                            final_variable_name);
-                    wrapper_src_dumper.send(STR("    return *Helper::Casting::ptr_cast<{}*>(this, offset->second);\n"), final_type_name);
-                    wrapper_src_dumper.send(STR("}\n"));
-                    wrapper_src_dumper.send(STR("const {}& {}::Get{}() const\n"), final_type_name, final_class_name, final_variable_name);
-                    wrapper_src_dumper.send(STR("{\n"));
-                    wrapper_src_dumper.send(STR("    static auto offset = MemberOffsets.find(STR(\"{}\"));\n"), final_variable_name);
-                    wrapper_src_dumper.send(STR("    if (offset == MemberOffsets.end()) {{ throw std::runtime_error{{\"Tried getting member variable '{}::{}' "
-                                                "that doesn't exist in this engine version.\"}}; }}\n"),
-                                            final_class_name,
-                                            final_variable_name);
-                    wrapper_src_dumper.send(STR("    return *Helper::Casting::ptr_cast<const {}*>(this, offset->second);\n"), final_type_name);
-                    wrapper_src_dumper.send(STR("}\n\n"));
-                }
-
-                macro_setter_dumper.send(STR("if (auto val = parser.get_int64(STR(\"{}\"), STR(\"{}\"), -1); val != -1)\n"),
-                                         final_class_name,
-                                         final_variable_name);
-                macro_setter_dumper.send(STR("    Unreal::{}::MemberOffsets.emplace(STR(\"{}\"), static_cast<int32_t>(val));\n"),
-                                         final_class_name,
-                                         final_variable_name);
-                if (final_variable_name == STR("EnumFlags_Internal"))
-                {
-                    macro_setter_dumper.send(STR("if (auto val = parser.get_int64(STR(\"{}\"), STR(\"EnumFlags\"), -1); val != -1)\n"),
-                                             final_class_name);
-                    macro_setter_dumper.send(STR("    Unreal::{}::MemberOffsets.emplace(STR(\"EnumFlags_Internal\"), static_cast<int32_t>(val));\n"),
-                                             final_class_name);
-                }
-            }
+            text.clear();
+            write_member_vars_macro_setter(text, final_class_name, wrapped_variables, rename_map);
+            macro_setter_dumper.send(STR("{}"), text);
         }
     }
 
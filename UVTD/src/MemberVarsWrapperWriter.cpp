@@ -0,0 +1,133 @@
+#include <format>
+#include <iterator>
+
+#include <UVTD/MemberVarsWrapperWriter.hpp>
+
+namespace RC::UVTD
+{
+    auto write_member_vars_header_wrapper(File::StringType& out, const std::vector<WrappedMemberVariable>& wrapped_variables) -> void
+    {
+        auto it = std::back_inserter(out);
+
+        out.append(STR("static std::unordered_map<File::StringType, int32_t> MemberOffsets;\n"));
+        if (!wrapped_variables.empty())
+        {
+            // Offsets found in 'MemberOffsets' by the accessors below, -1 until the first successful lookup
+            std::format_to(it, STR("static int32_t MemberOffsetCache[{}];\n"), wrapped_variables.size());
+        }
+        out.append(STR("\n"));
+
+        for (const auto& wrapped_variable : wrapped_variables)
+        {
+            out.append(wrapped_variable.is_private ? STR("private:\n") : STR("public:\n"));
+            std::format_to(it, STR("    {}& Get{}();\n"), wrapped_variable.type, wrapped_variable.name);
+            std::format_to(it, STR("    const {}& Get{}() const;\n\n"), wrapped_variable.type, wrapped_variable.name);
+        }
+    }
+
+    auto write_member_vars_src_wrapper(File::StringType& out,
+                                       const File::StringType& class_name,
+                                       const std::vector<WrappedMemberVariable>& wrapped_variables) -> void
+    {
+        auto it = std::back_inserter(out);
+
+        std::format_to(it, STR("std::unordered_map<File::StringType, int32_t> {}::MemberOffsets{{}};\n"), class_name);
+        if (!wrapped_variables.empty())
+        {
+            std::format_to(it, STR("int32_t {}::MemberOffsetCache[{}]{{"), class_name, wrapped_variables.size());
+            for (size_t i = 0; i < wrapped_variables.size(); ++i)
+            {
+                out.append(i == 0 ? STR("-1") : STR(", -1"));
+            }
+            out.append(STR("};\n"));
+        }
+        out.append(STR("\n"));
+
+        // Before 4.25 the FArchiveState members were part of FArchive, both classes look their offsets up in whichever one the engine has
+        const auto offsets =
+                class_name == STR("FArchive") || class_name == STR("FArchiveState")
+                        ? File::StringType{STR("Version::IsBelow(4, 25) ? FArchive::MemberOffsets : FArchiveState::MemberOffsets")}
+                        : File::StringType{STR("MemberOffsets")};
+
+        for (size_t slot = 0; slot < wrapped_variables.size(); ++slot)
+        {
+            const auto& wrapped_variable = wrapped_variables[slot];
+
+            for (const auto is_const : {false, true})
+            {
+                if (is_const)
+                {
+                    std::format_to(it, STR("const {}& {}::Get{}() const\n"), wrapped_variable.type, class_name, wrapped_variable.name);
+                }
+                else
+                {
+                    std::format_to(it, STR("{}& {}::Get{}()\n"), wrapped_variable.type, class_name, wrapped_variable.name);
+                }
+                out.append(STR("{\n"));
+                std::format_to(it, STR("    auto offset = MemberOffsetCache[{}];\n"), slot);
+                // Misses aren't cached, an access before the offsets are loaded doesn't hide them from later accesses
+                // 'MemberOffsets' is only written with emplace so an offset that was found never changes
+                out.append(STR("    if (offset == -1)\n    {\n"));
+                std::format_to(it, STR("        auto& offsets = {};\n"), offsets);
+                std::format_to(it, STR("        auto it = offsets.find(STR(\"{}\"));\n"), wrapped_variable.name);
+                std::format_to(it,
+                               STR("        if (it == offsets.end()) {{ throw std::runtime_error{{\"Tried getting member variable '{}::{}' that doesn't "
+                                   "exist in this engine version.\"}}; }}\n"),
+                               class_name,
+                               wrapped_variable.name);
+                std::format_to(it, STR("        offset = MemberOffsetCache[{}] = it->second;\n"), slot);
+                out.append(STR("    }\n"));
+                std::format_to(it,
+                               STR("    return *Helper::Casting::ptr_cast<{}{}*>(this, offset);\n"),
+                               is_const ? STR("const ") : STR(""),
+                               wrapped_variable.type);
+                out.append(is_const ? STR("}\n\n") : STR("}\n"));
+            }
+        }
+    }
+
+    static auto write_macro_setter_entry(File::StringType& out,
+                                         const File::StringType& class_name,
+                                         File::StringViewType ini_name,
+                                         const File::StringType& variable_name) -> void
+    {
+        auto it = std::back_inserter(out);
+        std::format_to(it, STR("if (auto val = parser.get_int64(Ini::Key{{STR(\"{}\"), STR(\"{}\")}}, -1); val != -1)\n"), class_name, ini_name);
+        std::format_to(it, STR("    Unreal::{}::MemberOffsets.emplace(STR(\"{}\"), static_cast<int32_t>(val));\n"), class_name, variable_name);
+    }
+
+    auto write_member_vars_macro_setter(File::StringType& out,
+                                        const File::StringType& class_name,
+                                        const std::vector<WrappedMemberVariable>& wrapped_variables,
+                                        const MemberRenameMap& rename_map) -> void
+    {
+        for (const auto& wrapped_variable : wrapped_variables)
+        {
+            // Members that were renamed in the PDB can still be overridden with their original name, the original name takes precedence
+            for (const auto& [original_name, renamed_name] : rename_map)
+            {
+                if (renamed_name != wrapped_variable.name)
+                {
+                    continue;
+                }
+                write_macro_setter_entry(out, class_name, original_name, wrapped_variable.name);
+                out.append(STR("// Also support using the renamed version in the INI file\n"));
+            }
+            if (wrapped_variable.name == STR("EnumFlags_Internal"))
+            {
+                write_macro_setter_entry(out, class_name, STR("EnumFlags"), wrapped_variable.name);
+                out.append(STR("// Also support using the renamed version in the INI file\n"));
+            }
+            write_macro_setter_entry(out, class_name, wrapped_variable.name, wrapped_variable.name);
+        }
+    }
+
+    auto write_member_vars_default_setter(File::StringType& out,
+                                          const File::StringType& class_name,
+                                          const File::StringType& variable_name,
+                                          int32_t offset) -> void
+    {
+        // Only inserts when the layout file didn't provide an offset
+        std::format_to(std::back_inserter(out), STR("{}::MemberOffsets.emplace(STR(\"{}\"), 0x{:X});\n\n"), class_name, variable_name, offset);
+    }
+} // namespace RC::UVTD
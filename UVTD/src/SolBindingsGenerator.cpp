@@ -10,21 +10,24 @@ namespace RC::UVTD
         MemberVarsDumper member_vars_dumper{symbols};
         member_vars_dumper.generate_code();
         type_container = member_vars_dumper.get_type_container();
+        output.append(member_vars_dumper.get_output());
     }
 
     static std::filesystem::path sol_bindings_output_path = "SolBindings";
 
     auto SolBindingsGenerator::generate_files() -> void
     {
-        for (const auto& [class_name, class_entry] : type_container.get_class_entries())
+        const auto& string_pool = StringPool::shared();
+
+        for (const auto& class_entry : type_container.get_classes())
         {
-            if (class_entry.variables.empty()) continue;
+            if (class_entry.num_variables == 0) continue;
 
-            auto final_class_name_clean = class_entry.class_name_clean;
+            auto final_class_name_clean = string_pool.view(class_entry.class_name_clean);
             // Skipping UObject/UObjectBase because it needs to be manually implemented.
             if (final_class_name_clean == STR("UObjectBase")) continue;
 
-            auto final_class_name = class_name;
+            auto final_class_name = final_class_name_clean;
 
             auto wrapper_header_file = sol_bindings_output_path / std::format(STR("SolBindings_{}.hpp"), final_class_name_clean);
 
@@ -40,43 +43,46 @@ namespace RC::UVTD
 
             header_wrapper_dumper.send(STR("auto sol_class_{} = sol().new_usertype<{}>(\"{}\""), final_class_name, final_class_name, final_class_name);
 
-            for (const auto& [variable_name, variable] : class_entry.variables)
+            for (const auto& variable : type_container.get_variables(class_entry))
             {
-                if (variable.type.find(STR("TBaseDelegate")) != variable.type.npos)
+                auto variable_name = string_pool.view(variable.name);
+                auto variable_type = string_pool.view(variable.type);
+
+                if (variable_type.find(STR("TBaseDelegate")) != variable_type.npos)
                 {
                     continue;
                 }
-                if (variable.type.find(STR("FUniqueNetIdRepl")) != variable.type.npos)
+                if (variable_type.find(STR("FUniqueNetIdRepl")) != variable_type.npos)
                 {
                     continue;
                 }
-                if (variable.type.find(STR("FPlatformUserId")) != variable.type.npos)
+                if (variable_type.find(STR("FPlatformUserId")) != variable_type.npos)
                 {
                     continue;
                 }
-                if (variable.type.find(STR("FVector2D")) != variable.type.npos)
+                if (variable_type.find(STR("FVector2D")) != variable_type.npos)
                 {
                     continue;
                 }
-                if (variable.type.find(STR("FReply")) != variable.type.npos)
+                if (variable_type.find(STR("FReply")) != variable_type.npos)
                 {
                     continue;
                 }
-                if (variable.type.find(STR("FUObjectCppClassStaticFunctions")) != variable.type.npos)
+                if (variable_type.find(STR("FUObjectCppClassStaticFunctions")) != variable_type.npos)
                 {
                     continue;
                 }
 
-                File::StringType final_variable_name = variable.name;
+                File::StringType final_variable_name{variable_name};
 
-                if (variable.name == STR("EnumFlags"))
+                if (variable_name == STR("EnumFlags"))
                 {
                     final_variable_name = STR("EnumFlags_Internal");
                 }
 
                 header_wrapper_dumper.send(STR(",\n    \"Get{}\", static_cast<{}&({}::*)()>(&{}::Get{})"),
                                            final_variable_name,
-                                           variable.type,
+                                           variable_type,
                                            final_class_name,
                                            final_class_name,
                                            final_variable_name);
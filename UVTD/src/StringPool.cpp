@@ -0,0 +1,87 @@
+#include <algorithm>
+#include <mutex>
+
+#include <UVTD/StringPool.hpp>
+
+namespace RC::UVTD
+{
+    StringPool::StringPool()
+    {
+        strings.emplace_back();
+        ids_by_string.emplace(File::StringViewType{}, empty_string);
+    }
+
+    auto StringPool::shared() -> StringPool&
+    {
+        static StringPool pool;
+        return pool;
+    }
+
+    auto StringPool::intern(File::StringViewType string) -> StringId
+    {
+        {
+            std::shared_lock lock(mutex);
+            if (auto it = ids_by_string.find(string); it != ids_by_string.end())
+            {
+                return it->second;
+            }
+        }
+
+        std::unique_lock lock(mutex);
+        // Another thread may have interned the same string between the two locks
+        if (auto it = ids_by_string.find(string); it != ids_by_string.end())
+        {
+            return it->second;
+        }
+
+        auto id = static_cast<StringId>(strings.size());
+        auto stored_string = store(string);
+        strings.emplace_back(stored_string);
+        ids_by_string.emplace(stored_string, id);
+        return id;
+    }
+
+    auto StringPool::view(StringId id) const -> File::StringViewType
+    {
+        std::shared_lock lock(mutex);
+        return strings[id];
+    }
+
+    auto StringPool::get_num_strings() const -> size_t
+    {
+        std::shared_lock lock(mutex);
+        return strings.size();
+    }
+
+    auto StringPool::get_memory_usage() const -> size_t
+    {
+        std::shared_lock lock(mutex);
+        auto map_node_size = sizeof(std::pair<const File::StringViewType, StringId>) + sizeof(void*);
+        return num_chars * sizeof(File::CharType) + strings.capacity() * sizeof(File::StringViewType) + ids_by_string.size() * map_node_size +
+               ids_by_string.bucket_count() * sizeof(void*);
+    }
+
+    auto StringPool::store(File::StringViewType string) -> File::StringViewType
+    {
+        if (string.size() > chars_per_chunk)
+        {
+            // Too long to share a chunk, gets one of its own and leaves the current chunk alone
+            auto& chunk = chunks.emplace_back(std::make_unique<File::CharType[]>(string.size()));
+            std::ranges::copy(string, chunk.get());
+            num_chars += string.size();
+            return File::StringViewType{chunk.get(), string.size()};
+        }
+
+        if (num_chars_in_chunk + string.size() > chars_per_chunk)
+        {
+            current_chunk = chunks.emplace_back(std::make_unique<File::CharType[]>(chars_per_chunk)).get();
+            num_chars_in_chunk = 0;
+        }
+
+        auto stored_string = current_chunk + num_chars_in_chunk;
+        std::ranges::copy(string, stored_string);
+        num_chars_in_chunk += string.size();
+        num_chars += string.size();
+        return File::StringViewType{stored_string, string.size()};
+    }
+} // namespace RC::UVTD
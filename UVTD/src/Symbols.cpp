@@ -11,6 +11,14 @@
 
 namespace RC::UVTD
 {
+    // Lets a debugger stop on type kinds that get_type_name doesn't handle yet, elsewhere the placeholder name is used as is
+    static auto break_on_unknown_type() -> void
+    {
+#ifdef _WIN32
+        __debugbreak();
+#endif
+    }
+
     Symbols::Symbols(std::filesystem::path pdb_file_path)
         : pdb_file_path(pdb_file_path), pdb_file_handle(std::move(File::open(pdb_file_path))), pdb_file_map(std::move(pdb_file_handle.memory_map())),
           pdb_file(pdb_file_map.data())
@@ -36,29 +44,22 @@ namespace RC::UVTD
         }
 
         dbi_stream = PDB::CreateDBIStream(pdb_file);
-    }
-
-    Symbols::Symbols(const Symbols& other)
-        : pdb_file_path(other.pdb_file_path), pdb_file_handle(std::move(File::open(pdb_file_path))), pdb_file_map(std::move(pdb_file_handle.memory_map())),
-          pdb_file(pdb_file_map.data()), is_425_plus(other.is_425_plus)
-    {
-        dbi_stream = PDB::CreateDBIStream(pdb_file);
-    }
+        tpi_stream = PDB::CreateTPIStream(pdb_file);
 
-    Symbols& Symbols::operator=(const Symbols& other)
-    {
-        pdb_file_path = other.pdb_file_path;
-        pdb_file_handle = std::move(File::open(pdb_file_path));
-        pdb_file_map = std::move(pdb_file_handle.memory_map());
-        pdb_file = PDB::RawFile(pdb_file_map.data());
-        is_425_plus = other.is_425_plus;
-        dbi_stream = PDB::CreateDBIStream(pdb_file);
+        for (const PDB::CodeView::TPI::Record* type_record : tpi_stream.GetTypeRecords())
+        {
+            if (type_record->header.kind != PDB::CodeView::TPI::TypeRecordKind::LF_CLASS &&
+                type_record->header.kind != PDB::CodeView::TPI::TypeRecordKind::LF_STRUCTURE)
+            {
+                continue;
+            }
+            if (type_record->data.LF_CLASS.property.fwdref) continue;
 
-        return *this;
+            class_records.emplace_back(ClassRecord{get_leaf_name(type_record->data.LF_CLASS.data, type_record->data.LF_CLASS.lfEasy.kind), type_record});
+        }
     }
 
-    auto Symbols::generate_method_signature(const PDB::TPIStream& tpi_stream, const PDB::CodeView::TPI::Record* function_record, File::StringType method_name)
-            -> MethodSignature
+    auto Symbols::generate_method_signature(const PDB::CodeView::TPI::Record* function_record, File::StringType method_name) const -> MethodSignature
     {
         MethodSignature signature{};
 
@@ -202,7 +203,7 @@ namespace RC::UVTD
             case PDB::CodeView::TPI::TypeIndexKind::T_PUINT4:
                 return STR("uint32*");
             default:
-                __debugbreak();
+                break_on_unknown_type();
                 return STR("<UNKNOWN TYPE>");
                 break;
             }
@@ -265,7 +266,7 @@ namespace RC::UVTD
         case PDB::CodeView::TPI::TypeRecordKind::LF_BITFIELD:
             return get_type_name(tpi_stream, record->data.LF_BITFIELD.type, check_valid);
         default:
-            __debugbreak();
+            break_on_unknown_type();
             return STR("<UNKNOWN TYPE>");
         }
     }
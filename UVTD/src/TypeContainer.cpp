@@ -1,45 +1,163 @@
+#include <algorithm>
+#include <numeric>
+
 #include <UVTD/TypeContainer.hpp>
 
 namespace RC::UVTD
 {
+    // 'order' must be sorted by class and then by key, with rows of equal keys in the order they were set
+    template <typename Row, typename IsSameKey>
+    static auto keep_last_rows(std::vector<Row>& rows, std::vector<uint32_t>& class_indices, const std::vector<uint32_t>& order, IsSameKey is_same_key)
+            -> void
+    {
+        std::vector<Row> kept_rows{};
+        std::vector<uint32_t> kept_class_indices{};
+        kept_rows.reserve(rows.size());
+        kept_class_indices.reserve(rows.size());
+
+        for (size_t i = 0; i < order.size(); ++i)
+        {
+            auto row = order[i];
+            if (i + 1 < order.size())
+            {
+                auto next_row = order[i + 1];
+                if (class_indices[next_row] == class_indices[row] && is_same_key(rows[next_row], rows[row]))
+                {
+                    continue;
+                }
+            }
+            kept_rows.emplace_back(rows[row]);
+            kept_class_indices.emplace_back(class_indices[row]);
+        }
+
+        rows = std::move(kept_rows);
+        class_indices = std::move(kept_class_indices);
+    }
+
     auto TypeContainer::join(const TypeContainer& other) -> void
     {
-        for (const auto& [_, class_entry] : other.class_entries)
+        std::vector<uint32_t> class_index_remap(other.classes.size());
+        for (size_t i = 0; i < other.classes.size(); ++i)
         {
+            const auto& class_entry = other.classes[i];
             SymbolNameInfo name_info = SymbolNameInfo{class_entry.valid_for_vtable, class_entry.valid_for_member_vars};
-            Class& this_entry = get_or_create_class_entry(class_entry.class_name, class_entry.class_name_clean, name_info);
+            class_index_remap[i] = get_or_create_class_entry(class_entry.class_name, class_entry.class_name_clean, name_info);
+        }
+
+        functions.insert(functions.end(), other.functions.begin(), other.functions.end());
+        for (auto class_index : other.function_class_indices)
+        {
+            function_class_indices.emplace_back(class_index_remap[class_index]);
+        }
+
+        variables.insert(variables.end(), other.variables.begin(), other.variables.end());
+        for (auto class_index : other.variable_class_indices)
+        {
+            variable_class_indices.emplace_back(class_index_remap[class_index]);
+        }
+
+        is_compact = false;
+        compact();
+    }
+
+    auto TypeContainer::compact() -> void
+    {
+        if (is_compact)
+        {
+            return;
+        }
+
+        std::vector<uint32_t> function_order(functions.size());
+        std::iota(function_order.begin(), function_order.end(), 0);
+        std::ranges::stable_sort(function_order, [&](uint32_t a, uint32_t b) {
+            if (function_class_indices[a] != function_class_indices[b])
+            {
+                return function_class_indices[a] < function_class_indices[b];
+            }
+            return functions[a].offset < functions[b].offset;
+        });
+        keep_last_rows(functions, function_class_indices, function_order, [](const MethodBody& a, const MethodBody& b) {
+            return a.offset == b.offset;
+        });
+
+        // Names are looked up once up front so that the comparisons don't go through the pool's lock
+        const auto& string_pool = StringPool::shared();
+        std::vector<File::StringViewType> variable_names(variables.size());
+        for (size_t i = 0; i < variables.size(); ++i)
+        {
+            variable_names[i] = string_pool.view(variables[i].name);
+        }
 
-            for (const auto& [vtable_offset, function] : class_entry.functions)
+        std::vector<uint32_t> variable_order(variables.size());
+        std::iota(variable_order.begin(), variable_order.end(), 0);
+        std::ranges::stable_sort(variable_order, [&](uint32_t a, uint32_t b) {
+            if (variable_class_indices[a] != variable_class_indices[b])
             {
-                this_entry.functions[vtable_offset] = function;
+                return variable_class_indices[a] < variable_class_indices[b];
             }
+            return variable_names[a] < variable_names[b];
+        });
+        keep_last_rows(variables, variable_class_indices, variable_order, [](const MemberVariable& a, const MemberVariable& b) {
+            return a.name == b.name;
+        });
 
-            for (const auto& [variable_name, variable] : class_entry.variables)
+        for (auto& class_entry : classes)
+        {
+            class_entry.num_functions = 0;
+            class_entry.num_variables = 0;
+        }
+        for (size_t i = 0; i < functions.size(); ++i)
+        {
+            auto& class_entry = classes[function_class_indices[i]];
+            if (class_entry.num_functions++ == 0)
             {
-                this_entry.variables[variable_name] = variable;
+                class_entry.first_function = static_cast<uint32_t>(i);
             }
         }
+        for (size_t i = 0; i < variables.size(); ++i)
+        {
+            auto& class_entry = classes[variable_class_indices[i]];
+            if (class_entry.num_variables++ == 0)
+            {
+                class_entry.first_variable = static_cast<uint32_t>(i);
+            }
+        }
+
+        is_compact = true;
     }
 
     auto TypeContainer::get_or_create_class_entry(const File::StringType& symbol_name, const File::StringType& symbol_name_clean, const SymbolNameInfo& name_info)
-            -> Class&
+            -> uint32_t
     {
-        auto& class_entry = [&]() -> auto&
+        auto& string_pool = StringPool::shared();
+        return get_or_create_class_entry(string_pool.intern(symbol_name), string_pool.intern(symbol_name_clean), name_info);
+    }
+
+    auto TypeContainer::get_or_create_class_entry(StringId symbol_name, StringId symbol_name_clean, const SymbolNameInfo& name_info) -> uint32_t
+    {
+        auto [it, was_inserted] = class_index_by_name.try_emplace(symbol_name_clean, static_cast<uint32_t>(classes.size()));
+        if (was_inserted)
         {
-            if (auto it = class_entries.find(symbol_name); it != class_entries.end())
-            {
-                return it->second;
-            }
-            else
-            {
-                return class_entries.emplace(symbol_name_clean, Class{.class_name = File::StringType{symbol_name}, .class_name_clean = symbol_name_clean})
-                        .first->second;
-            }
+            classes.emplace_back(Class{.class_name = symbol_name, .class_name_clean = symbol_name_clean});
         }
-        ();
 
+        auto& class_entry = classes[it->second];
         class_entry.valid_for_member_vars = name_info.valid_for_member_vars;
         class_entry.valid_for_vtable = name_info.valid_for_vtable;
-        return class_entry;
+        return it->second;
+    }
+
+    auto TypeContainer::set_function(uint32_t class_index, const MethodBody& function) -> void
+    {
+        functions.emplace_back(function);
+        function_class_indices.emplace_back(class_index);
+        is_compact = false;
+    }
+
+    auto TypeContainer::set_variable(uint32_t class_index, const MemberVariable& variable) -> void
+    {
+        variables.emplace_back(variable);
+        variable_class_indices.emplace_back(class_index);
+        is_compact = false;
     }
-} // namespace RC::UVTD
\ No newline at end of file
+} // namespace RC::UVTD
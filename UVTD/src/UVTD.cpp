@@ -1,14 +1,21 @@
 #define NOMINMAX
 
+#include <algorithm>
+#include <condition_variable>
+#include <exception>
 #include <format>
+#include <future>
+#include <memory>
+#include <mutex>
 #include <numeric>
+#include <optional>
 #include <stdexcept>
 #include <thread>
 #include <unordered_set>
 
 #include <DynamicOutput/DynamicOutput.hpp>
 #include <Helpers/String.hpp>
-#include <Input/Handler.hpp>
+#include <Timer/ScopedTimer.hpp>
 #include <UVTD/Config.hpp>
 #include <UVTD/ConfigUtil.hpp>
 #include <UVTD/ExceptionHandling.hpp>
@@ -20,15 +27,144 @@
 #include <UVTD/UnrealVirtualGenerator.hpp>
 #include <UVTD/VTableDumper.hpp>
 
-#include <Psapi.h>
-#include <Windows.h>
-#include <dbghelp.h>
-
 #include <String/StringType.hpp>
 
 namespace RC::UVTD
 {
-    bool processing_events{false};
+    // Everything produced for one PDB by a worker thread, files are written from it on the main thread in PDB order
+    struct PDBRun
+    {
+        std::unique_ptr<Symbols> symbols{};
+        // Only engaged when the dumper's 'generate_code' finished
+        std::optional<VTableDumper> vtable_dumper{};
+        std::optional<MemberVarsDumper> member_vars_dumper{};
+        std::optional<SolBindingsGenerator> sol_bindings_generator{};
+        std::exception_ptr error{};
+
+        double parse_duration{};
+        double vtable_duration{};
+        double member_vars_duration{};
+        double sol_bindings_duration{};
+    };
+
+    auto static generate_code_for_pdb(const std::filesystem::path& pdb, const DumpSettings& dump_settings, PDBRun& run) -> void
+    {
+        try
+        {
+            {
+                ScopedTimer parse_timer{&run.parse_duration};
+                run.symbols = std::make_unique<Symbols>(pdb);
+            }
+
+            if (dump_settings.should_dump_vtable)
+            {
+                ScopedTimer vtable_timer{&run.vtable_duration};
+
+                VTableDumper dumper{*run.symbols};
+                dumper.generate_code();
+                run.vtable_dumper.emplace(std::move(dumper));
+            }
+
+            if (dump_settings.should_dump_member_vars)
+            {
+                ScopedTimer member_vars_timer{&run.member_vars_duration};
+
+                MemberVarsDumper dumper{*run.symbols};
+                dumper.generate_code();
+                run.member_vars_dumper.emplace(std::move(dumper));
+            }
+
+            if (dump_settings.should_dump_sol_bindings)
+            {
+                ScopedTimer sol_bindings_timer{&run.sol_bindings_duration};
+
+                SolBindingsGenerator generator{*run.symbols};
+                generator.generate_code();
+                run.sol_bindings_generator.emplace(std::move(generator));
+            }
+        }
+        catch (...)
+        {
+            run.error = std::current_exception();
+        }
+    }
+
+    // Adds the time spent joining to 'total_duration'
+    auto static timed_join(TypeContainer& container, const TypeContainer& other, double& total_duration) -> void
+    {
+        double duration{};
+        {
+            ScopedTimer join_timer{&duration};
+            container.join(other);
+        }
+        total_duration += duration;
+    }
+
+    // Output is identical to processing every PDB from start to finish one after the other
+    // Some files, like MemberVariableLayout.ini and the sol bindings, are rewritten by every PDB so the last PDB must always win
+    auto static write_files_for_pdb(const std::filesystem::path& pdb, PDBRun& run, TypeContainer& shared_container, double& join_duration) -> void
+    {
+        File::StringType pdb_name = pdb.filename().stem().wstring();
+        double files_duration{};
+        double virtual_generator_duration{};
+
+        TypeContainer run_container{};
+
+        if (run.vtable_dumper)
+        {
+            ScopedTimer files_timer{&files_duration};
+
+            run.vtable_dumper->get_output().flush();
+            run.vtable_dumper->generate_files();
+            timed_join(run_container, run.vtable_dumper->get_type_container(), join_duration);
+        }
+        run.vtable_duration += files_duration;
+        files_duration = 0.0;
+
+        if (run.member_vars_dumper)
+        {
+            ScopedTimer files_timer{&files_duration};
+
+            run.member_vars_dumper->get_output().flush();
+            run.member_vars_dumper->generate_files();
+            timed_join(run_container, run.member_vars_dumper->get_type_container(), join_duration);
+        }
+        run.member_vars_duration += files_duration;
+        files_duration = 0.0;
+
+        if (run.sol_bindings_generator)
+        {
+            ScopedTimer files_timer{&files_duration};
+
+            run.sol_bindings_generator->get_output().flush();
+            run.sol_bindings_generator->generate_files();
+        }
+        run.sol_bindings_duration += files_duration;
+
+        if (run.error)
+        {
+            std::rethrow_exception(run.error);
+        }
+
+        {
+            ScopedTimer virtual_generator_timer{&virtual_generator_duration};
+
+            UnrealVirtualGenerator virtual_generator(pdb_name, run_container);
+            virtual_generator.generate_files();
+        }
+
+        timed_join(shared_container, run_container, join_duration);
+
+        Output::send(STR("Code generated.\n"));
+        Output::send(STR("{} took {:.3f}s: parse {:.3f}s, vtables {:.3f}s, member variables {:.3f}s, sol bindings {:.3f}s, virtuals {:.3f}s\n"),
+                     pdb_name,
+                     run.parse_duration + run.vtable_duration + run.member_vars_duration + run.sol_bindings_duration + virtual_generator_duration,
+                     run.parse_duration,
+                     run.vtable_duration,
+                     run.member_vars_duration,
+                     run.sol_bindings_duration,
+                     virtual_generator_duration);
+    }
 
     auto main(DumpSettings dump_settings) -> void
     {
@@ -48,54 +184,98 @@ namespace RC::UVTD
             return;
         }
 
-        for (const std::filesystem::path& pdb : pdbs_to_dump)
-        {
-            TRY([&] {
-                {
-                    TypeContainer run_container{};
+        double total_duration{};
+        double join_duration{};
+        ScopedTimer total_timer{&total_duration};
 
-                    if (dump_settings.should_dump_vtable)
-                    {
-                        Symbols symbols{pdb};
+        // PDBs are parsed and dumped on worker threads while the main thread writes files for finished PDBs in order
+        // Workers don't get more than 'max_runs_in_flight' PDBs ahead of the writer because every run keeps its PDB mapped
+        size_t num_threads = std::clamp<size_t>(std::thread::hardware_concurrency(), 1, pdbs_to_dump.size());
+        size_t max_runs_in_flight = num_threads * 2;
 
-                        VTableDumper dumper{std::move(symbols)};
-                        dumper.generate_code();
-                        dumper.generate_files();
+        std::vector<std::unique_ptr<PDBRun>> runs(pdbs_to_dump.size());
+        std::vector<bool> is_run_done(pdbs_to_dump.size());
+        std::mutex runs_mutex{};
+        std::condition_variable runs_condition{};
+        size_t next_pdb_index{};
+        size_t num_runs_written{};
 
-                        run_container.join(dumper.get_type_container());
-                    }
-
-                    if (dump_settings.should_dump_member_vars)
+        auto worker = [&] {
+            while (true)
+            {
+                size_t pdb_index{};
+                {
+                    std::unique_lock lock(runs_mutex);
+                    runs_condition.wait(lock, [&] {
+                        return next_pdb_index >= runs.size() || next_pdb_index < num_runs_written + max_runs_in_flight;
+                    });
+                    if (next_pdb_index >= runs.size())
                     {
-                        Symbols symbols{pdb};
-
-                        MemberVarsDumper dumper{std::move(symbols)};
-                        dumper.generate_code();
-                        dumper.generate_files();
-
-                        run_container.join(dumper.get_type_container());
+                        return;
                     }
+                    pdb_index = next_pdb_index++;
+                }
 
-                    if (dump_settings.should_dump_sol_bindings)
-                    {
-                        Symbols symbols{pdb};
+                auto run = std::make_unique<PDBRun>();
+                generate_code_for_pdb(pdbs_to_dump[pdb_index], dump_settings, *run);
 
-                        SolBindingsGenerator generator{std::move(symbols)};
-                        generator.generate_code();
-                        generator.generate_files();
-                    }
+                {
+                    std::lock_guard lock(runs_mutex);
+                    runs[pdb_index] = std::move(run);
+                    is_run_done[pdb_index] = true;
+                }
+                runs_condition.notify_all();
+            }
+        };
 
-                    File::StringType pdb_name = pdb.filename().stem();
-                    UnrealVirtualGenerator virtual_generator(pdb_name, run_container);
-                    virtual_generator.generate_files();
+        std::vector<std::future<void>> worker_threads;
+        for (size_t thread_id = 0; thread_id < num_threads; ++thread_id)
+        {
+            worker_threads.emplace_back(std::async(std::launch::async, worker));
+        }
 
-                    shared_container.join(run_container);
+        for (size_t pdb_index = 0; pdb_index < pdbs_to_dump.size(); ++pdb_index)
+        {
+            std::unique_ptr<PDBRun> run{};
+            {
+                std::unique_lock lock(runs_mutex);
+                runs_condition.wait(lock, [&] {
+                    return is_run_done[pdb_index];
+                });
+                run = std::move(runs[pdb_index]);
+            }
 
-                    Output::send(STR("Code generated.\n"));
-                }
+            TRY([&] {
+                write_files_for_pdb(pdbs_to_dump[pdb_index], *run, shared_container, join_duration);
             });
+            run.reset();
+
+            {
+                std::lock_guard lock(runs_mutex);
+                ++num_runs_written;
+            }
+            runs_condition.notify_all();
+        }
+
+        for (auto& worker_thread : worker_threads)
+        {
+            worker_thread.get();
         }
 
+        total_timer.stop_timer();
+        Output::send(STR("Processed {} PDBs on {} threads in {:.3f}s\n"), pdbs_to_dump.size(), num_threads, total_duration);
+
+        const auto& string_pool = StringPool::shared();
+        Output::send(STR("Joined type containers in {:.3f}s, {} classes, {} functions, {} member variables\n"),
+                     join_duration,
+                     shared_container.get_classes().size(),
+                     shared_container.get_num_functions(),
+                     shared_container.get_num_variables());
+        Output::send(STR("Interned {} strings in {:.2f} MiB, peak memory {:.2f} MiB\n"),
+                     string_pool.get_num_strings(),
+                     string_pool.get_memory_usage() / (1024.0 * 1024.0),
+                     get_peak_memory_usage() / (1024.0 * 1024.0));
+
         if (dump_settings.should_dump_member_vars)
         {
             MemberVarsWrapperGenerator::output_cleanup();
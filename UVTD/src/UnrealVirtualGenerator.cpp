@@ -67,11 +67,15 @@ namespace RC::UVTD
             virtual_src_dumper.send(STR("    {\n"));
         }
 
-        for (const auto& [class_name, class_entry] : type_container.get_class_entries())
+        const auto& string_pool = StringPool::shared();
+
+        for (const auto& class_entry : type_container.get_classes())
         {
-            if (!class_entry.functions.empty() && class_entry.valid_for_vtable == ValidForVTable::Yes && !is_case_preserving_pdb)
+            if (class_entry.num_functions != 0 && class_entry.valid_for_vtable == ValidForVTable::Yes && !is_case_preserving_pdb)
             {
-                virtual_src_dumper.send(STR("#include <FunctionBodies/{}_VTableOffsets_{}_FunctionBody.cpp>\n"), pdb_name, class_name);
+                virtual_src_dumper.send(STR("#include <FunctionBodies/{}_VTableOffsets_{}_FunctionBody.cpp>\n"),
+                                        pdb_name,
+                                        string_pool.view(class_entry.class_name_clean));
             }
         }
 
@@ -83,31 +87,35 @@ namespace RC::UVTD
             if (is_non_case_preserving_pdb)
             {
                 virtual_src_dumper.send(STR("#ifdef WITH_CASE_PRESERVING_NAME\n"));
-                for (const auto& [class_name, class_entry] : type_container.get_class_entries())
+                for (const auto& class_entry : type_container.get_classes())
                 {
-                    if (class_entry.variables.empty())
+                    if (class_entry.num_variables == 0)
                     {
                         continue;
                     }
 
                     if (class_entry.valid_for_member_vars == ValidForMemberVars::Yes)
                     {
-                        virtual_src_dumper.send(STR("#include <FunctionBodies/{}_CasePreserving_MemberVariableLayout_DefaultSetter_{}.cpp>\n"), pdb_name, class_name);
+                        virtual_src_dumper.send(STR("#include <FunctionBodies/{}_CasePreserving_MemberVariableLayout_DefaultSetter_{}.cpp>\n"),
+                                                pdb_name,
+                                                string_pool.view(class_entry.class_name_clean));
                     }
                 }
                 virtual_src_dumper.send(STR("#else\n"));
             }
 
-            for (const auto& [class_name, class_entry] : type_container.get_class_entries())
+            for (const auto& class_entry : type_container.get_classes())
             {
-                if (class_entry.variables.empty())
+                if (class_entry.num_variables == 0)
                 {
                     continue;
                 }
 
                 if (class_entry.valid_for_member_vars == ValidForMemberVars::Yes)
                 {
-                    virtual_src_dumper.send(STR("#include <FunctionBodies/{}_MemberVariableLayout_DefaultSetter_{}.cpp>\n"), pdb_name, class_name);
+                    virtual_src_dumper.send(STR("#include <FunctionBodies/{}_MemberVariableLayout_DefaultSetter_{}.cpp>\n"),
+                                            pdb_name,
+                                            string_pool.view(class_entry.class_name_clean));
                 }
             }
 
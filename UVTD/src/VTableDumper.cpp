@@ -12,8 +12,6 @@
 #include <UVTD/Symbols.hpp>
 #include <UVTD/VTableDumper.hpp>
 
-#include <Windows.h>
-
 #include <PDB_CoalescedMSFStream.h>
 #include <PDB_GlobalSymbolStream.h>
 #include <PDB_IPIStream.h>
@@ -35,7 +33,7 @@ namespace RC::UVTD
         File::StringType class_name = *changed;
         File::StringType class_name_clean = Symbols::clean_name(class_name);
 
-        auto& class_entry = type_container.get_or_create_class_entry(class_name, class_name_clean, name_info);
+        auto class_index = type_container.get_or_create_class_entry(class_name, class_name_clean, name_info);
 
         auto fields = tpi_stream.GetTypeRecord(class_record->data.LF_CLASS.field);
 
@@ -47,10 +45,10 @@ namespace RC::UVTD
             switch (field_record->kind)
             {
             case PDB::CodeView::TPI::TypeRecordKind::LF_METHOD:
-                process_method_overload_list(tpi_stream, field_record, class_entry);
+                process_method_overload_list(tpi_stream, field_record, class_index);
                 break;
             case PDB::CodeView::TPI::TypeRecordKind::LF_ONEMETHOD:
-                process_onemethod(tpi_stream, field_record, class_entry);
+                process_onemethod(tpi_stream, field_record, class_index);
                 break;
             }
         }
@@ -62,9 +60,10 @@ namespace RC::UVTD
         uint32_t vftable_offset;
     };
 
-    auto VTableDumper::process_method_overload_list(const PDB::TPIStream& tpi_stream, const PDB::CodeView::TPI::FieldList* method_record, Class& class_entry) -> void
+    auto VTableDumper::process_method_overload_list(const PDB::TPIStream& tpi_stream, const PDB::CodeView::TPI::FieldList* method_record, uint32_t class_index) -> void
     {
         auto list = tpi_stream.GetTypeRecord(method_record->data.LF_METHOD.mList);
+        auto& string_pool = StringPool::shared();
 
         File::StringType method_name = Symbols::get_method_name(method_record);
         File::StringType method_name_clean = Symbols::clean_name(method_name);
@@ -95,29 +94,30 @@ namespace RC::UVTD
             }
             overload_index++;
 
-            auto& function = class_entry.functions[vtable_offset];
-            function.name = overload_name;
-            function.signature = symbols.generate_method_signature(tpi_stream, function_record, overload_name);
-            function.offset = vtable_offset;
-            function.is_overload = true;
+            type_container.set_function(class_index,
+                                        MethodBody{.name = string_pool.intern(overload_name),
+                                                   .signature = string_pool.intern(symbols.generate_method_signature(function_record, overload_name).to_string()),
+                                                   .offset = static_cast<uint32_t>(vtable_offset),
+                                                   .is_overload = true});
         }
     }
 
-    auto VTableDumper::process_onemethod(const PDB::TPIStream& tpi_stream, const PDB::CodeView::TPI::FieldList* method_record, Class& class_entry) -> void
+    auto VTableDumper::process_onemethod(const PDB::TPIStream& tpi_stream, const PDB::CodeView::TPI::FieldList* method_record, uint32_t class_index) -> void
     {
-        static std::unordered_map<File::StringType, std::unordered_map<File::StringType, uint32_t>> functions_already_dumped{};
-
         const auto is_virtual = method_record->data.LF_ONEMETHOD.attributes.mprop == (uint16_t)PDB::CodeView::TPI::MethodProperty::Intro ||
                                 method_record->data.LF_ONEMETHOD.attributes.mprop == (uint16_t)PDB::CodeView::TPI::MethodProperty::PureIntro;
         if (!is_virtual) return;
 
+        auto& string_pool = StringPool::shared();
+
         File::StringType method_name = Symbols::get_method_name(method_record);
         int32_t vtable_offset = method_record->data.LF_ONEMETHOD.vbaseoff[0];
         auto function_record = tpi_stream.GetTypeRecord(method_record->data.LF_ONEMETHOD.index);
 
         bool is_overload{};
 
-        if (auto it = functions_already_dumped.find(class_entry.class_name); it != functions_already_dumped.end())
+        File::StringType class_name{string_pool.view(type_container.get_classes()[class_index].class_name)};
+        if (auto it = functions_already_dumped.find(class_name); it != functions_already_dumped.end())
         {
             if (auto it2 = it->second.find(method_name); it2 != it->second.end())
             {
@@ -126,41 +126,32 @@ namespace RC::UVTD
             }
         }
 
-        Output::send(STR("  method {} offset {}\n"), method_name, vtable_offset);
+        output.send(STR("  method {} offset {}\n"), method_name, vtable_offset);
 
         File::StringType method_name_clean = Symbols::clean_name(method_name);
 
-        auto& function = class_entry.functions[vtable_offset];
-        function.name = method_name_clean;
-        function.signature = symbols.generate_method_signature(tpi_stream, function_record, method_name);
-        function.offset = vtable_offset;
-        function.is_overload = is_overload;
+        type_container.set_function(class_index,
+                                    MethodBody{.name = string_pool.intern(method_name_clean),
+                                               .signature = string_pool.intern(symbols.generate_method_signature(function_record, method_name).to_string()),
+                                               .offset = static_cast<uint32_t>(vtable_offset),
+                                               .is_overload = is_overload});
         functions_already_dumped.emplace(method_name, 1);
     }
 
     auto VTableDumper::dump_vtable_for_symbol(std::unordered_map<File::StringType, SymbolNameInfo>& names) -> void
     {
-        Output::send(STR("Dumping {} struct symbols for {}\n"), names.size(), symbols.pdb_file_path.filename().stem().wstring());
+        output.send(STR("Dumping {} struct symbols for {}\n"), names.size(), symbols.pdb_file_path.filename().stem().wstring());
 
-        const PDB::TPIStream tpi_stream = PDB::CreateTPIStream(symbols.pdb_file);
+        const PDB::TPIStream& tpi_stream = symbols.tpi_stream;
 
-        for (const PDB::CodeView::TPI::Record* type_record : tpi_stream.GetTypeRecords())
+        for (const auto& [class_name, type_record] : symbols.class_records)
         {
-            if (type_record->header.kind == PDB::CodeView::TPI::TypeRecordKind::LF_CLASS ||
-                type_record->header.kind == PDB::CodeView::TPI::TypeRecordKind::LF_STRUCTURE)
-            {
-                if (type_record->data.LF_CLASS.property.fwdref) continue;
+            const auto name_info = names.find(class_name);
+            if (name_info == names.end()) continue;
 
-                const File::StringType class_name = Symbols::get_leaf_name(type_record->data.LF_CLASS.data, type_record->data.LF_CLASS.lfEasy.kind);
-                if (!names.contains(class_name)) continue;
-
-                const auto name_info = names.find(class_name);
-                if (name_info == names.end()) continue;
-
-                process_class(tpi_stream, type_record, class_name, name_info->second);
-            }
+            process_class(tpi_stream, type_record, class_name, name_info->second);
         }
-        return;
+        type_container.compact();
     }
 
     auto VTableDumper::generate_code() -> void
@@ -180,22 +171,27 @@ namespace RC::UVTD
 
     auto VTableDumper::generate_files() -> void
     {
-        File::StringType pdb_name = symbols.pdb_file_path.filename().stem();
+        File::StringType pdb_name = symbols.pdb_file_path.filename().stem().wstring();
+        const auto& string_pool = StringPool::shared();
 
-        for (const auto& [class_name, class_entry] : type_container.get_class_entries())
+        for (const auto& class_entry : type_container.get_classes())
         {
-            Output::send(STR("Generating file '{}_VTableOffsets_{}_FunctionBody.cpp'\n"), pdb_name, class_entry.class_name_clean);
+            auto class_name = string_pool.view(class_entry.class_name);
+            auto class_name_clean = string_pool.view(class_entry.class_name_clean);
+
+            Output::send(STR("Generating file '{}_VTableOffsets_{}_FunctionBody.cpp'\n"), pdb_name, class_name_clean);
             Output::Targets<Output::NewFileDevice> function_body_dumper;
             auto& function_body_file_device = function_body_dumper.get_device<Output::NewFileDevice>();
             function_body_file_device.set_file_name_and_path(vtable_gen_output_function_bodies_path /
-                                                             std::format(STR("{}_VTableOffsets_{}_FunctionBody.cpp"), pdb_name, class_name));
+                                                             std::format(STR("{}_VTableOffsets_{}_FunctionBody.cpp"), pdb_name, class_name_clean));
             function_body_file_device.set_formatter([](File::StringViewType string) {
                 return File::StringType{string};
             });
 
-            for (const auto& [function_index, function_entry] : class_entry.functions)
+            for (const auto& function_entry : type_container.get_functions(class_entry))
             {
-                auto local_class_name = class_entry.class_name;
+                auto function_name = string_pool.view(function_entry.name);
+                auto local_class_name = File::StringType{class_name};
                 if (auto pos = local_class_name.find(STR("Property")); pos != local_class_name.npos)
                 {
                     local_class_name.replace(0, 1, STR("F"));
@@ -203,10 +199,10 @@ namespace RC::UVTD
 
                 function_body_dumper.send(STR("if (auto it = {}::VTableLayoutMap.find(STR(\"{}\")); it == {}::VTableLayoutMap.end())\n"),
                                           local_class_name,
-                                          function_entry.name,
+                                          function_name,
                                           local_class_name);
                 function_body_dumper.send(STR("{\n"));
-                function_body_dumper.send(STR("    {}::VTableLayoutMap.emplace(STR(\"{}\"), 0x{:X});\n"), local_class_name, function_entry.name, function_entry.offset);
+                function_body_dumper.send(STR("    {}::VTableLayoutMap.emplace(STR(\"{}\"), 0x{:X});\n"), local_class_name, function_name, function_entry.offset);
                 function_body_dumper.send(STR("}\n\n"));
             }
         }
@@ -220,17 +216,17 @@ namespace RC::UVTD
             return File::StringType{string};
         });
 
-        for (const auto& [class_name, class_entry] : type_container.get_class_entries())
+        for (const auto& class_entry : type_container.get_classes())
         {
-            ini_dumper.send(STR("[{}]\n"), class_entry.class_name);
+            ini_dumper.send(STR("[{}]\n"), string_pool.view(class_entry.class_name));
 
-            for (const auto& [function_index, function_entry] : class_entry.functions)
+            for (const auto& function_entry : type_container.get_functions(class_entry))
             {
                 if (function_entry.is_overload)
                 {
-                    ini_dumper.send(STR("; {}\n"), function_entry.signature.to_string());
+                    ini_dumper.send(STR("; {}\n"), string_pool.view(function_entry.signature));
                 }
-                ini_dumper.send(STR("{}\n"), function_entry.name);
+                ini_dumper.send(STR("{}\n"), string_pool.view(function_entry.name));
             }
 
             ini_dumper.send(STR("\n"));
@@ -6,8 +6,10 @@
 #include <UVTD/Config.hpp>
 #include <UVTD/UVTD.hpp>
 
+#ifdef _WIN32
 #define NOMINMAX
 #include <Windows.h>
+#endif
 
 using namespace RC;
 
@@ -35,10 +37,12 @@ auto static get_user_selection() -> int32_t
 }
 
 // We're outside DllMain here
-auto thread_dll_start([[maybe_unused]] LPVOID thread_param) -> unsigned long
+// 'thread_param' is the module handle when loaded as a DLL, config and logs are then next to the DLL instead of in the working directory
+auto thread_dll_start([[maybe_unused]] void* thread_param) -> unsigned long
 {
     std::filesystem::path module_path{};
 
+#ifdef _WIN32
     if (thread_param)
     {
         auto module_handle = reinterpret_cast<HMODULE>(thread_param);
@@ -47,6 +51,7 @@ auto thread_dll_start([[maybe_unused]] LPVOID thread_param) -> unsigned long
         module_path = module_filename_buffer;
         module_path = module_path.parent_path();
     }
+#endif
 
     Output::set_default_devices<Output::DebugConsoleDevice, Output::NewFileDevice>();
     auto& file_device = Output::get_device<Output::NewFileDevice>();
@@ -117,6 +122,13 @@ auto thread_dll_start([[maybe_unused]] LPVOID thread_param) -> unsigned long
     return 0;
 }
 
+auto main() -> int
+{
+    thread_dll_start(nullptr);
+    return 0;
+}
+
+#ifdef _WIN32
 // We're still inside DllMain so be careful what you do here
 auto dll_process_attached(HMODULE moduleHandle) -> void
 {
@@ -126,12 +138,6 @@ auto dll_process_attached(HMODULE moduleHandle) -> void
     }
 }
 
-auto main() -> int
-{
-    thread_dll_start(nullptr);
-    return 0;
-}
-
 auto DllMain(HMODULE hModule, DWORD ul_reason_for_call, [[maybe_unused]] LPVOID lpReserved) -> BOOL
 {
     switch (ul_reason_for_call)
@@ -148,3 +154,4 @@ auto DllMain(HMODULE hModule, DWORD ul_reason_for_call, [[maybe_unused]] LPVOID
     }
     return TRUE;
 }
+#endif
@@ -0,0 +1,73 @@
+#include <filesystem>
+#include <format>
+#include <vector>
+
+#include <File/File.hpp>
+#include <UVTD/MemberVarsWrapperWriter.hpp>
+
+// Writes the member variable wrappers of a few sample classes the way UVTD writes them for the Unreal submodule
+// MemberVarsWrapperTests and MemberVarsWrapperBench compile the output, the output directory is the only argument
+using namespace RC;
+using namespace RC::UVTD;
+
+struct SampleClass
+{
+    File::StringType name;
+    std::vector<WrappedMemberVariable> variables;
+};
+
+static auto write_file(const std::filesystem::path& path, const File::StringType& text) -> void
+{
+    auto file = File::open(path, File::OpenFor::Writing, File::OverwriteExistingFile::Yes, File::CreateIfNonExistent::Yes);
+    file.write_string_to_file(text);
+    file.close();
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc != 2)
+    {
+        return 1;
+    }
+    std::filesystem::path output_directory{argv[1]};
+    std::filesystem::create_directories(output_directory);
+
+    const std::vector<SampleClass> sample_classes{
+            {STR("FSample"),
+             {
+                     {STR("Count"), STR("int32_t"), false},
+                     {STR("ClassPrivate"), STR("void*"), false},
+                     {STR("Scale"), STR("double"), true},
+                     {STR("EnumFlags_Internal"), STR("uint8_t"), true},
+             }},
+            {STR("FArchive"), {{STR("ArIsLoading"), STR("uint8_t"), false}}},
+            {STR("FArchiveState"), {{STR("ArIsLoading"), STR("uint8_t"), false}}},
+            {STR("FEmpty"), {}},
+    };
+    const MemberRenameMap rename_map{{STR("Class"), STR("ClassPrivate")}};
+
+    File::StringType macro_setter{};
+    File::StringType default_setter{};
+    for (const auto& [class_name, variables] : sample_classes)
+    {
+        File::StringType text{};
+        write_member_vars_header_wrapper(text, variables);
+        write_file(output_directory / std::format(STR("MemberVariableLayout_HeaderWrapper_{}.hpp"), class_name), text);
+
+        text.clear();
+        write_member_vars_src_wrapper(text, class_name, variables);
+        write_file(output_directory / std::format(STR("MemberVariableLayout_SrcWrapper_{}.hpp"), class_name), text);
+
+        write_member_vars_macro_setter(macro_setter, class_name, variables, rename_map);
+
+        // Defaults that differ from every offset the tests put in the layout file
+        for (int32_t i = 0; i < static_cast<int32_t>(variables.size()); ++i)
+        {
+            write_member_vars_default_setter(default_setter, class_name, variables[i].name, 0x40 + i * 8);
+        }
+    }
+    write_file(output_directory / "MacroSetter.hpp", macro_setter);
+    write_file(output_directory / "DefaultSetter.hpp", default_setter);
+
+    return 0;
+}
@@ -0,0 +1,34 @@
+#include <bit>
+#include <cstddef>
+
+#include <Helpers/Casting.hpp>
+#include <TestHarness/TestHarness.hpp>
+
+#include "MemberVarsWrapperSamples.hpp"
+
+using namespace RC;
+using namespace RC::Unreal;
+using RC::TestHarness::benchmark;
+
+int main()
+{
+    alignas(16) std::byte data[0x80]{};
+    auto sample = std::bit_cast<FSample*>(&data[0]);
+    FSample::MemberOffsets.emplace(STR("Count"), 0x8);
+    FArchiveState::MemberOffsets.emplace(STR("ArIsLoading"), 0x10);
+
+    constexpr size_t num_iterations = 1'000'000;
+    benchmark("Generated accessor, cached offset", num_iterations, [&] {
+        RC::TestHarness::do_not_optimize(sample->GetCount());
+    });
+    benchmark("Generated accessor, FArchive version switch", num_iterations, [&] {
+        RC::TestHarness::do_not_optimize(std::bit_cast<FArchive*>(sample)->GetArIsLoading());
+    });
+    // What every access would cost without the cache
+    benchmark("MemberOffsets lookup per access", num_iterations, [&] {
+        auto it = FSample::MemberOffsets.find(STR("Count"));
+        RC::TestHarness::do_not_optimize(*Helper::Casting::ptr_cast<int32_t*>(sample, it->second));
+    });
+
+    return RC::TestHarness::report();
+}
@@ -0,0 +1,9 @@
+#include "MemberVarsWrapperSamples.hpp"
+
+namespace RC::Unreal
+{
+#include <MemberVariableLayout_SrcWrapper_FSample.hpp>
+#include <MemberVariableLayout_SrcWrapper_FArchiveState.hpp>
+#include <MemberVariableLayout_SrcWrapper_FArchive.hpp>
+#include <MemberVariableLayout_SrcWrapper_FEmpty.hpp>
+} // namespace RC::Unreal
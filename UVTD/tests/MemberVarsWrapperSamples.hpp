@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstdint>
+#include <stdexcept>
+#include <unordered_map>
+
+#include <File/Macros.hpp>
+#include <Helpers/Casting.hpp>
+
+// The sample classes written by GenerateMemberVarsWrapperSamples, declared the way the Unreal submodule declares the classes UVTD wraps
+namespace RC::Unreal
+{
+    namespace Version
+    {
+        inline bool is_below_425{};
+
+        inline auto IsBelow(int32_t, int32_t) -> bool
+        {
+            return is_below_425;
+        }
+    } // namespace Version
+
+    struct FSample
+    {
+#include <MemberVariableLayout_HeaderWrapper_FSample.hpp>
+    };
+
+    struct FArchiveState
+    {
+#include <MemberVariableLayout_HeaderWrapper_FArchiveState.hpp>
+    };
+
+    struct FArchive
+    {
+#include <MemberVariableLayout_HeaderWrapper_FArchive.hpp>
+    };
+
+    struct FEmpty
+    {
+#include <MemberVariableLayout_HeaderWrapper_FEmpty.hpp>
+
+        int32_t declared_after_the_wrapper{};
+    };
+} // namespace RC::Unreal
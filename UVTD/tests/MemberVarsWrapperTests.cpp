@@ -0,0 +1,149 @@
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include <IniParser/Ini.hpp>
+#include <TestHarness/TestHarness.hpp>
+#include <UVTD/MemberVarsWrapperWriter.hpp>
+
+#include "MemberVarsWrapperSamples.hpp"
+
+using namespace RC;
+using namespace RC::Unreal;
+using RC::TestHarness::throws;
+
+namespace RC
+{
+    // Same context as the generated code in UE4SSProgram::load_unreal_offsets_from_file and the per-PDB default setters
+    static auto load_offsets(StringType layout) -> void
+    {
+        Ini::Parser parser;
+        parser.parse(layout);
+#include <MacroSetter.hpp>
+    }
+
+    namespace Unreal
+    {
+        static auto set_default_offsets() -> void
+        {
+#include <DefaultSetter.hpp>
+        }
+    } // namespace Unreal
+} // namespace RC
+
+static auto reset_offsets() -> void
+{
+    FSample::MemberOffsets.clear();
+    FArchive::MemberOffsets.clear();
+    FArchiveState::MemberOffsets.clear();
+    std::ranges::fill(FSample::MemberOffsetCache, -1);
+    std::ranges::fill(FArchive::MemberOffsetCache, -1);
+    std::ranges::fill(FArchiveState::MemberOffsetCache, -1);
+}
+
+struct alignas(16) SampleObject
+{
+    std::byte data[0x80]{};
+
+    template <typename T>
+    auto as() -> T*
+    {
+        return std::bit_cast<T*>(&data[0]);
+    }
+};
+
+static auto test_access_before_load() -> void
+{
+    reset_offsets();
+    SampleObject object{};
+    auto sample = object.as<FSample>();
+
+    // The miss isn't cached, the offset loaded afterwards is used by the next access
+    CHECK(throws([&] {
+        sample->GetCount();
+    }));
+    load_offsets(STR("[FSample]\nCount = 0x8\n"));
+    CHECK(&sample->GetCount() == std::bit_cast<int32_t*>(&object.data[8]));
+    CHECK(&std::as_const(*sample).GetCount() == std::bit_cast<const int32_t*>(&object.data[8]));
+    CHECK(FSample::MemberOffsetCache[0] == 8);
+}
+
+static auto test_layout_file_wins_over_defaults() -> void
+{
+    reset_offsets();
+    SampleObject object{};
+    auto sample = object.as<FSample>();
+
+    load_offsets(STR("[FSample]\nCount = 0x10\n"));
+    set_default_offsets();
+    CHECK(&sample->GetCount() == std::bit_cast<int32_t*>(&object.data[0x10]));
+    // Members missing from the layout file get their default, 'ClassPrivate' is the second member of the sample
+    CHECK(&sample->GetClassPrivate() == std::bit_cast<void**>(&object.data[0x48]));
+    CHECK(FSample::MemberOffsets.at(STR("Scale")) == 0x50);
+}
+
+static auto test_renamed_members() -> void
+{
+    reset_offsets();
+    // The original name takes precedence over the renamed one
+    load_offsets(STR("[FSample]\nClass = 0x18\nClassPrivate = 0x20\nEnumFlags = 0x28\n"));
+    CHECK(FSample::MemberOffsets.at(STR("ClassPrivate")) == 0x18);
+    CHECK(FSample::MemberOffsets.at(STR("EnumFlags_Internal")) == 0x28);
+
+    reset_offsets();
+    load_offsets(STR("[FSample]\nClassPrivate = 0x20\nEnumFlags_Internal = 0x30\n"));
+    CHECK(FSample::MemberOffsets.at(STR("ClassPrivate")) == 0x20);
+    CHECK(FSample::MemberOffsets.at(STR("EnumFlags_Internal")) == 0x30);
+}
+
+static auto test_archive_version_switch() -> void
+{
+    SampleObject object{};
+
+    // From 4.25 both classes use the FArchiveState offsets
+    reset_offsets();
+    Version::is_below_425 = false;
+    load_offsets(STR("[FArchive]\nArIsLoading = 0x8\n[FArchiveState]\nArIsLoading = 0x10\n"));
+    CHECK(&object.as<FArchive>()->GetArIsLoading() == std::bit_cast<uint8_t*>(&object.data[0x10]));
+    CHECK(&object.as<FArchiveState>()->GetArIsLoading() == std::bit_cast<uint8_t*>(&object.data[0x10]));
+
+    // Before 4.25 both classes use the FArchive offsets
+    reset_offsets();
+    Version::is_below_425 = true;
+    load_offsets(STR("[FArchive]\nArIsLoading = 0x8\n[FArchiveState]\nArIsLoading = 0x10\n"));
+    CHECK(&object.as<FArchive>()->GetArIsLoading() == std::bit_cast<uint8_t*>(&object.data[0x8]));
+    CHECK(&object.as<FArchiveState>()->GetArIsLoading() == std::bit_cast<uint8_t*>(&object.data[0x8]));
+    Version::is_below_425 = false;
+}
+
+static auto test_generated_text() -> void
+{
+    // The Unreal submodule only has 'MemberOffsets', the generated code mustn't need anything else from it
+    std::vector<UVTD::WrappedMemberVariable> variables{{STR("Count"), STR("int32_t"), false}};
+    StringType text{};
+    UVTD::write_member_vars_header_wrapper(text, variables);
+    UVTD::write_member_vars_src_wrapper(text, STR("FSample"), variables);
+    UVTD::write_member_vars_macro_setter(text, STR("FSample"), variables, {});
+    UVTD::write_member_vars_default_setter(text, STR("FSample"), STR("Count"), 8);
+    CHECK(text.find(STR("MemberOffsets.emplace(")) != text.npos);
+    CHECK(text.find(STR("EmplaceMemberOffset")) == text.npos);
+    CHECK(text.find(STR("MemberSlot")) == text.npos);
+    CHECK(text.find(STR("static auto")) == text.npos);
+
+    // An empty class leaves the access of what follows the header wrapper alone
+    FEmpty empty{};
+    CHECK(empty.declared_after_the_wrapper == 0);
+}
+
+int main()
+{
+    test_access_before_load();
+    test_layout_file_wins_over_defaults();
+    test_renamed_members();
+    test_archive_version_switch();
+    test_generated_text();
+
+    return RC::TestHarness::report();
+}
@@ -12,6 +12,6 @@ target(projectName)
 
     add_files("src/**.cpp")
 
-    add_deps("File", "Input", "DynamicOutput", "Helpers")
+    add_deps("File", "DynamicOutput", "Helpers", "ScopedTimer")
 
     add_packages("glaze", "raw_pdb")
@@ -1212,6 +1212,20 @@ function UDataTable:GetRowNames() end
 ---@return table[]
 function UDataTable:GetAllRows() end
 
+---Gets multiple rows in one call as a table with row names as keys
+---Rows that don't exist are left out of the result
+---@param RowNames string[]? # Names of the rows to get, all rows are returned if omitted
+---@return table<string, any>
+function UDataTable:GetRows(RowNames) end
+
+---Exports all rows in the DataTable to a CSV or JSON file
+---Each property is exported as text, the same way the engine exports it
+---JSON files hold one object with row names as keys, like the table returned by GetRows
+---@param FilePath string
+---@param Format "CSV"|"JSON"? # Defaults to "CSV"
+---@return integer # Number of rows exported
+function UDataTable:ExportRows(FilePath, Format) end
+
 ---Iterates through all rows in the DataTable
 ---The callback has two params: string RowName, table RowData
 ---@param Callback fun(RowName: string, RowData: any)
@@ -5,7 +5,12 @@
 include(Utilities)  # For string manipulation functions
 
 # Project structure configuration
-set(UE4SS_PROJECTS "UE4SS" "UVTD" CACHE STRING "List of main project targets")
+# Both projects are only built and supported on Windows, elsewhere only the portable first party libraries and their tests are built
+if(WIN32)
+    set(UE4SS_PROJECTS "UE4SS" "UVTD" CACHE STRING "List of main project targets")
+else()
+    set(UE4SS_PROJECTS "" CACHE STRING "List of main project targets")
+endif()
 set(UE4SS_TARGET_TYPES "Game" "CasePreserving" "LessEqual421" CACHE STRING "UE4-style target types")
 set(UE4SS_CONFIGURATION_TYPES "Debug" "Dev" "Shipping" "Test" CACHE STRING "UE4-style configuration types")
 set(UE4SS_PLATFORM_TYPES "Win64" CACHE STRING "Supported platform types")
@@ -17,10 +22,17 @@ option(UE4SS_INPUT_ENABLED "Enable the input system" ON)
 option(ENABLE_IDE_SOURCE_VISIBILITY "Enable IDE visibility for source files" ON)
 option(UE4SS_SUPPRESS_THIRD_PARTY_WARNINGS "Suppress warnings from third-party libraries" ON)
 option(UE4SS_VERSION_CHECK "Enable compiler version checking" ON)
+option(UE4SS_BUILD_TESTS "Build the tests, run them with ctest" ON)
+option(UE4SS_BUILD_BENCHMARKS "Build the benchmarks, run them with ctest -L benchmark" OFF)
 
 # Profiler configuration
-set(RC_PROFILER_FLAVOR "Tracy" CACHE STRING "Select profiler: Tracy, Superluminal, or None")
-set_property(CACHE RC_PROFILER_FLAVOR PROPERTY STRINGS Tracy Superluminal None)
+# Tracy and Superluminal are Windows only, the builtin profiler works everywhere
+if(WIN32)
+    set(RC_PROFILER_FLAVOR "Tracy" CACHE STRING "Select profiler: Tracy, Superluminal, Builtin, or None")
+else()
+    set(RC_PROFILER_FLAVOR "Builtin" CACHE STRING "Select profiler: Tracy, Superluminal, Builtin, or None")
+endif()
+set_property(CACHE RC_PROFILER_FLAVOR PROPERTY STRINGS Tracy Superluminal Builtin None)
 
 # Proxy configuration
 set(UE4SS_PROXY_PATH "" CACHE FILEPATH "Path to DLL for proxy generation (empty = use default dwmapi.dll)")
@@ -126,4 +126,46 @@ function(setup_build_configuration)
         set_property(CACHE CMAKE_BUILD_TYPE PROPERTY HELPSTRING "Choose build type")
         set_property(CACHE CMAKE_BUILD_TYPE PROPERTY STRINGS ${BUILD_CONFIGS})
     endif()
-endfunction()
\ No newline at end of file
+endfunction()
+
+# Adds a test executable and registers it with ctest
+# Tests return non-zero when a check fails, see deps/first/TestHarness
+#
+# Arguments:
+#   NAME - Name of the executable and the test
+#   SOURCES - Source files
+#   INCLUDES - Private include directories
+#   LIBRARIES - Libraries to link, TestHarness is always linked
+#   DEFINITIONS - Private compile definitions
+#   LABELS - ctest labels
+#
+# Example usage:
+#   ue4ss_add_test(NAME JSONTests SOURCES JSONTests.cpp LIBRARIES JSON)
+#
+function(ue4ss_add_test)
+    cmake_parse_arguments(ARG "" "NAME" "SOURCES;INCLUDES;LIBRARIES;DEFINITIONS;LABELS" ${ARGN})
+    if(NOT UE4SS_BUILD_TESTS AND NOT "benchmark" IN_LIST ARG_LABELS)
+        return()
+    endif()
+    add_executable(${ARG_NAME} ${ARG_SOURCES})
+    target_compile_features(${ARG_NAME} PRIVATE cxx_std_23)
+    target_include_directories(${ARG_NAME} PRIVATE ${ARG_INCLUDES})
+    target_link_libraries(${ARG_NAME} PRIVATE TestHarness ${ARG_LIBRARIES})
+    target_compile_definitions(${ARG_NAME} PRIVATE ${ARG_DEFINITIONS})
+    add_test(NAME ${ARG_NAME} COMMAND ${ARG_NAME})
+    if(ARG_LABELS)
+        set_tests_properties(${ARG_NAME} PROPERTIES LABELS "${ARG_LABELS}")
+    endif()
+endfunction()
+
+# Same as ue4ss_add_test() for benchmarks, they're only added with UE4SS_BUILD_BENCHMARKS and labeled 'benchmark'
+# Benchmarks print their timings, run them in an optimized build
+#
+# Example usage:
+#   ue4ss_add_benchmark(NAME JSONBench SOURCES JSONBench.cpp LIBRARIES JSON)
+#
+function(ue4ss_add_benchmark)
+    if(UE4SS_BUILD_BENCHMARKS)
+        ue4ss_add_test(${ARGN} LABELS benchmark)
+    endif()
+endfunction()
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <Unreal/UObjectArray.hpp>
+
+namespace RC::Unreal
+{
+    class UFunction;
+}
+
+namespace RC::GUI::KismetDebuggerMod
+{
+    using namespace RC::Unreal;
+
+    /*
+        Searchable list of every UFunction, used by the navigation bar
+
+        Built once with ForEachUObject the first time it's needed and kept up to date by UObject create/delete listeners
+        Listeners only queue the objects, names are resolved on the thread that calls 'update' so the game threads never pay for them
+        Filter results are only recomputed when the query or the set of functions changes
+    */
+    class FunctionIndex
+    {
+    public:
+        // Past this many queued changes the index is rebuilt from scratch instead
+        constexpr static size_t max_pending_changes = 1 << 16;
+
+        struct Entry
+        {
+            UFunction* function{};
+            std::string full_name{};
+            std::string lowercase_full_name{};
+        };
+
+    private:
+        struct CreateListener : public FUObjectCreateListener
+        {
+            FunctionIndex* index{};
+
+            void NotifyUObjectCreated(const UObjectBase* object, int32 object_index) override;
+            void OnUObjectArrayShutdown() override;
+        };
+
+        struct DeleteListener : public FUObjectDeleteListener
+        {
+            FunctionIndex* index{};
+
+            void NotifyUObjectDeleted(const UObjectBase* object, int32 object_index) override;
+            void OnUObjectArrayShutdown() override;
+        };
+
+        struct PendingChange
+        {
+            UFunction* function{};
+            bool is_created{};
+        };
+
+    private:
+        std::vector<Entry> m_entries{};
+        std::unordered_map<UFunction*, size_t> m_entry_index_by_function{};
+        bool m_is_built{};
+
+        CreateListener m_create_listener{};
+        DeleteListener m_delete_listener{};
+        bool m_create_listener_registered{};
+        bool m_delete_listener_registered{};
+        std::mutex m_pending_changes_mutex{};
+        std::vector<PendingChange> m_pending_changes{};
+        bool m_needs_rebuild{};
+
+        std::string m_query{};
+        std::vector<uint32_t> m_matches{};
+        bool m_matches_are_stale{true};
+
+    public:
+        FunctionIndex();
+        FunctionIndex(const FunctionIndex&) = delete;
+        auto operator=(const FunctionIndex&) -> FunctionIndex& = delete;
+        ~FunctionIndex();
+
+    public:
+        // Builds the index on first use and applies every create/delete seen since the last call
+        auto update() -> void;
+
+        // Case insensitive substring match, returns indices into 'get_entries'
+        auto filter(std::string_view query) -> const std::vector<uint32_t>&;
+
+        auto get_entries() const -> const std::vector<Entry>&
+        {
+            return m_entries;
+        }
+
+    private:
+        auto build() -> void;
+        auto add(UFunction* function) -> void;
+        auto remove(UFunction* function) -> void;
+        auto queue_change(UFunction* function, bool is_created) -> void;
+    };
+} // namespace RC::GUI::KismetDebuggerMod
@@ -1,11 +1,23 @@
 #pragma once
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
+#include <FunctionIndex.hpp>
+#include <ResolvedBreakpoints.hpp>
+#include <VMProfiler.hpp>
 #include <Unreal/FFrame.hpp>
 #include <Unreal/UStruct.hpp>
 #include <Unreal/UObject.hpp>
+#include <Unreal/UObjectArray.hpp>
 
 namespace RC::GUI::KismetDebuggerMod
 {
@@ -22,23 +34,86 @@ namespace RC::GUI::KismetDebuggerMod
 
     class BreakpointStore
     {
+    private:
+        // Created functions only raise a flag, looking them up by name is left to 'update'
+        struct CreateListener : public FUObjectCreateListener
+        {
+            BreakpointStore* store{};
+
+            void NotifyUObjectCreated(const UObjectBase* object, int32 object_index) override;
+            void OnUObjectArrayShutdown() override;
+        };
+
+        // Drops deleted functions from the resolved table before their address can be reused
+        struct DeleteListener : public FUObjectDeleteListener
+        {
+            BreakpointStore* store{};
+
+            void NotifyUObjectDeleted(const UObjectBase* object, int32 object_index) override;
+            void OnUObjectArrayShutdown() override;
+        };
+
     public:
         BreakpointStore();
+        BreakpointStore(const BreakpointStore&) = delete;
+        auto operator=(const BreakpointStore&) -> BreakpointStore& = delete;
         ~BreakpointStore();
 
         auto load(std::filesystem::path& path) -> void;
         auto save() -> void;
 
-        auto has_breakpoint(UFunction* fn, size_t index) -> bool;
+        // Cheap enough to check on every instruction, lets the hook skip the per-function lookup while nothing is armed
+        auto has_any_breakpoints() const -> bool
+        {
+            return m_num_breakpoints.load(std::memory_order_relaxed) != 0;
+        }
+        // Pointer probe and bit test, never allocates or touches names
+        auto has_breakpoint(UFunction* fn, size_t index) const -> bool
+        {
+            return m_resolved.load(std::memory_order_acquire)->test(fn, index);
+        }
         auto add_breakpoint(UFunction* fn, size_t index) -> void;
         auto add_breakpoint(const StringType& fn, size_t index) -> void;
         auto remove_breakpoint(UFunction* fn, size_t index) -> void;
 
+        // Called from the mod update loop so breakpoints resolve while the debugger tab is closed
+        // Only looks functions up by name if any were created since the last attempt
+        auto update() -> void;
+
+    private:
+        // Looks up functions that had breakpoints added by name (e.g. from the save file) but weren't loaded at the time
+        auto resolve_pending_functions() -> void;
+        auto forget_function(UFunction* fn) -> void;
+        // Expects 'm_mutex' to be held
+        auto register_listeners() -> void;
+        // Expects 'm_mutex' to be held
+        auto publish_resolved() -> void;
+        // Expects 'm_mutex' to be held
+        auto save_locked() -> void;
+
     private:
         typedef std::unordered_set<size_t> FunctionBreakpoints;
 
-        std::unordered_map<UFunction*, std::shared_ptr<FunctionBreakpoints> > m_breakpoints_by_function{};
-        std::unordered_map<StringType, std::shared_ptr<FunctionBreakpoints> > m_breakpoints_by_name{};
+        // Guards everything below except the atomics, taken by the GUI thread, the update thread and the delete listener
+        std::mutex m_mutex{};
+        std::unordered_map<StringType, FunctionBreakpoints> m_breakpoints_by_name{};
+        std::unordered_map<StringType, UFunction*> m_functions_by_name{};
+        CreateListener m_create_listener{};
+        DeleteListener m_delete_listener{};
+        bool m_create_listener_registered{};
+        bool m_delete_listener_registered{};
+
+        std::atomic<bool> m_has_pending_functions{};
+        std::atomic<bool> m_functions_created{};
+        // Bumped for every deleted UFunction, a name lookup that raced with a deletion is retried instead of cached
+        std::atomic<uint64_t> m_num_deleted_functions{};
+        std::atomic<size_t> m_num_breakpoints{};
+
+        // Readers use the table they loaded without taking a reference, a reference count costs more than the lookup itself
+        // Tables are only replaced when breakpoints or their functions change, so replaced ones are kept until the store is destroyed
+        std::atomic<const ResolvedBreakpoints*> m_resolved{};
+        // Guarded by 'm_mutex', owns the current table and every table it replaced
+        std::vector<std::unique_ptr<const ResolvedBreakpoints>> m_resolved_tables{};
     };
 
     class Debugger
@@ -50,8 +125,10 @@ namespace RC::GUI::KismetDebuggerMod
         auto enable() -> void;
         auto disable() -> void;
 
+        auto update() -> void;
         auto render() -> void;
         auto render_nav_bar(float width) -> void;
+        auto render_profiler() -> void;
 
         auto nav_to_function(UFunction* fn) -> void;
         auto nav_to_function(std::string full_name) -> void;
@@ -64,6 +141,7 @@ namespace RC::GUI::KismetDebuggerMod
         std::vector<std::string> m_nav_history{};
         int m_nav_history_index{-1};
         std::string m_nav_function{""};
+        FunctionIndex m_function_index{};
 
         // layout
         float m_split_right{400.0};
@@ -71,6 +149,12 @@ namespace RC::GUI::KismetDebuggerMod
 
         uint8_t* m_last_code{nullptr}; // pointer to last stack instruction, used to know if it's advanced since last frame
         BreakpointStore& m_breakpoints;
+        std::chrono::steady_clock::time_point m_last_breakpoint_resolve_time{};
+
+        VMProfiler::Results m_profiler_results{};
+        std::chrono::steady_clock::time_point m_last_profiler_refresh_time{};
+        bool m_profiler_functions_need_sort{};
+        bool m_profiler_opcodes_need_sort{};
     
     public:
         static inline std::filesystem::path m_save_path;
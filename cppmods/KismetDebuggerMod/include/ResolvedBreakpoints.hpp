@@ -0,0 +1,82 @@
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace RC::Unreal
+{
+    class UFunction;
+}
+
+namespace RC::GUI::KismetDebuggerMod
+{
+    using namespace RC::Unreal;
+
+    // Breakpoints of every function that has at least one, each resolved to a bitset indexed by script offset
+    // Open addressed on the function pointer so a check is a probe or two and a bit test
+    // Never modified once built so the hook can read it without locking
+    class ResolvedBreakpoints
+    {
+    public:
+        typedef std::unordered_map<UFunction*, std::vector<uint64_t>> BitsByFunction;
+
+        ResolvedBreakpoints() = default;
+        explicit ResolvedBreakpoints(const BitsByFunction& bits_by_function)
+        {
+            if (bits_by_function.empty()) return;
+
+            size_t num_slots = 1;
+            while (num_slots < bits_by_function.size() * 2) num_slots *= 2;
+            m_slots.resize(num_slots);
+            m_slot_mask = num_slots - 1;
+
+            for (const auto& [fn, bits] : bits_by_function)
+            {
+                auto slot = hash(fn) & m_slot_mask;
+                while (m_slots[slot].fn) slot = (slot + 1) & m_slot_mask;
+                m_slots[slot] = {fn, static_cast<uint32_t>(m_words.size()), static_cast<uint32_t>(bits.size())};
+                m_words.insert(m_words.end(), bits.begin(), bits.end());
+            }
+        }
+
+        static auto set(BitsByFunction& bits_by_function, UFunction* fn, size_t index) -> void
+        {
+            auto& bits = bits_by_function[fn];
+            auto num_words = (index + 1 + 63) / 64;
+            if (bits.size() < num_words) bits.resize(num_words);
+            bits[index / 64] |= uint64_t{1} << (index % 64);
+        }
+
+        auto test(UFunction* fn, size_t index) const -> bool
+        {
+            if (m_slots.empty()) return false;
+            for (auto slot = hash(fn) & m_slot_mask; m_slots[slot].fn; slot = (slot + 1) & m_slot_mask)
+            {
+                const auto& entry = m_slots[slot];
+                if (entry.fn != fn) continue;
+                return index / 64 < entry.num_words && (m_words[entry.first_word + index / 64] >> (index % 64)) & 1;
+            }
+            return false;
+        }
+
+    private:
+        static auto hash(UFunction* fn) -> size_t
+        {
+            // Objects are at least 16 byte aligned, mix the pointer so the low bits are usable
+            auto value = reinterpret_cast<uintptr_t>(fn);
+            return static_cast<size_t>((value >> 4) * 0x9E3779B97F4A7C15ull >> 32);
+        }
+
+        struct Slot
+        {
+            UFunction* fn{};
+            uint32_t first_word{};
+            uint32_t num_words{};
+        };
+
+        std::vector<Slot> m_slots{};
+        size_t m_slot_mask{};
+        std::vector<uint64_t> m_words{};
+    };
+} // namespace RC::GUI::KismetDebuggerMod
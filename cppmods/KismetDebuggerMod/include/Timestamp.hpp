@@ -0,0 +1,56 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#define KISMET_DEBUGGER_USE_TSC 1
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define KISMET_DEBUGGER_USE_TSC 1
+#else
+#define KISMET_DEBUGGER_USE_TSC 0
+#endif
+
+namespace RC::GUI::KismetDebuggerMod
+{
+    // Raw TSC reads where available, the OS clock would cost more than the per-opcode work that's being timed
+    auto inline read_timestamp() -> int64_t
+    {
+#if KISMET_DEBUGGER_USE_TSC
+        return static_cast<int64_t>(__rdtsc());
+#else
+        return std::chrono::steady_clock::now().time_since_epoch().count();
+#endif
+    }
+
+    // Converts read_timestamp() ticks to seconds by measuring them against the OS clock since start() was first called
+    class TimestampCalibration
+    {
+    private:
+        std::chrono::steady_clock::time_point m_start_time{};
+        int64_t m_start_timestamp{};
+
+    public:
+        auto start() -> void
+        {
+            if (m_start_timestamp == 0)
+            {
+                m_start_time = std::chrono::steady_clock::now();
+                m_start_timestamp = read_timestamp();
+            }
+        }
+
+        auto get_seconds_per_tick() const -> double
+        {
+#if KISMET_DEBUGGER_USE_TSC
+            auto elapsed_ticks = read_timestamp() - m_start_timestamp;
+            auto elapsed_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - m_start_time).count();
+            return m_start_timestamp != 0 && elapsed_ticks > 0 ? elapsed_seconds / static_cast<double>(elapsed_ticks) : 0.0;
+#else
+            return static_cast<double>(std::chrono::steady_clock::period::num) / static_cast<double>(std::chrono::steady_clock::period::den);
+#endif
+        }
+    };
+} // namespace RC::GUI::KismetDebuggerMod
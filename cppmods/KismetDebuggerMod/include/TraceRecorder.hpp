@@ -0,0 +1,121 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include <Timestamp.hpp>
+
+namespace RC::Unreal
+{
+    class UFunction;
+}
+
+namespace RC::GUI::KismetDebuggerMod
+{
+    using namespace RC::Unreal;
+
+    /*
+        Non-blocking bytecode trace
+
+        While recording, every executed opcode appends one TraceRecord to a ring buffer owned by the executing thread
+        Recording never locks or allocates after a thread's first record, old records are overwritten once a buffer wraps
+        Snapshots can be taken at any time and written to a .ktrace file, see tools/print_trace.py for the format
+        Function names are captured the first time a thread records a function, so dumps never touch functions that may have been unloaded
+
+        File layout (little endian):
+            u32 magic 'KTRC', u32 version, f64 seconds per timestamp tick
+            u32 opcode name count, then per opcode:     u16 length, UTF-8 name
+            u32 function count, then per function:      u64 address, u32 length, UTF-8 full name
+            u32 thread count, then per thread:          u64 thread id, u64 record count, TraceRecord[record count]
+    */
+    struct TraceRecord
+    {
+        const UFunction* function;
+        int64_t timestamp;
+        uint32_t code_offset;
+        uint8_t opcode;
+        uint8_t padding[3];
+    };
+    static_assert(sizeof(TraceRecord) == 24, "TraceRecord is written to trace files as is");
+
+    class TraceRecorder
+    {
+    public:
+        constexpr static size_t records_per_thread = 1 << 17;
+
+    private:
+        struct ThreadBuffer
+        {
+            uint64_t thread_id{};
+            std::unique_ptr<TraceRecord[]> records{std::make_unique<TraceRecord[]>(records_per_thread)};
+            // Total number of records ever written, the newest record is at (write_count - 1) % records_per_thread
+            std::atomic<uint64_t> write_count{};
+            // Value of 'write_count' when the buffer was last cleared, older records aren't part of snapshots
+            std::atomic<uint64_t> cleared_count{};
+
+            // Owning thread only, lets 'record' skip the name lookup while execution stays in the same function
+            const UFunction* last_function{};
+            std::unordered_set<const UFunction*> named_functions{};
+            // Names are captured while the function is executing, a dump may outlive the function itself
+            std::mutex function_names_mutex{};
+            std::vector<std::pair<const UFunction*, std::string>> function_names{};
+        };
+
+        struct ThreadSnapshot
+        {
+            uint64_t thread_id{};
+            std::vector<TraceRecord> records{};
+        };
+
+    private:
+        std::atomic<bool> m_is_recording{};
+        TimestampCalibration m_calibration{};
+        std::mutex m_buffers_mutex{};
+        std::vector<std::unique_ptr<ThreadBuffer>> m_buffers{};
+
+    public:
+        auto is_recording() const -> bool
+        {
+            return m_is_recording.load(std::memory_order_relaxed);
+        }
+        auto start() -> void;
+        auto stop() -> void;
+        auto clear() -> void;
+
+        auto record(const UFunction* function, uint32_t code_offset, uint8_t opcode) -> void
+        {
+            thread_local ThreadBuffer* buffer = register_thread();
+            if (function != buffer->last_function)
+            {
+                buffer->last_function = function;
+                if (function && !buffer->named_functions.contains(function))
+                {
+                    name_function(*buffer, function);
+                }
+            }
+            auto write_count = buffer->write_count.load(std::memory_order_relaxed);
+            buffer->records[write_count % records_per_thread] = {function, read_timestamp(), code_offset, opcode, {}};
+            buffer->write_count.store(write_count + 1, std::memory_order_release);
+        }
+
+        // Number of records currently held across all threads
+        auto get_num_records() -> size_t;
+
+        // Safe to call while recording, records that could have been overwritten during the copy are dropped
+        // Throws std::runtime_error if the file can't be written
+        auto dump(const std::filesystem::path& path) -> void;
+
+    private:
+        auto register_thread() -> ThreadBuffer*;
+        // Called once per function and thread
+        auto name_function(ThreadBuffer& buffer, const UFunction* function) -> void;
+        auto snapshot() -> std::vector<ThreadSnapshot>;
+    };
+} // namespace RC::GUI::KismetDebuggerMod
@@ -0,0 +1,149 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <Input/RingBuffer.hpp>
+#include <Timestamp.hpp>
+#include <Unreal/FFrame.hpp>
+
+namespace RC::GUI::KismetDebuggerMod
+{
+    using namespace RC::Unreal;
+
+    /*
+        Counting profiler for the Blueprint VM
+
+        Every opcode that goes through the GNatives hook is timed, its time includes any sub-expressions and functions it calls
+        Function time is tracked with a per-thread shadow stack of script frames:
+            a frame is entered on the first opcode seen for it and left after its EX_Return has executed
+            inclusive time is everything between the two, exclusive time leaves out the inclusive time of the frames it called
+        Counters are owned by the thread that executes the bytecode and are only merged when results are collected
+        Neither recording nor collecting locks, new function counters reach the collecting thread through a single producer single consumer queue
+    */
+    class VMProfiler
+    {
+    public:
+        struct OpcodeResult
+        {
+            std::string opcode{};
+            uint64_t count{};
+            double total_ms{};
+        };
+
+        struct FunctionResult
+        {
+            std::string function{};
+            uint64_t calls{};
+            double inclusive_ms{};
+            double exclusive_ms{};
+        };
+
+        struct Results
+        {
+            std::vector<OpcodeResult> opcodes{};
+            std::vector<FunctionResult> functions{};
+        };
+
+    private:
+        // Only ever written by the owning thread, atomic so that collecting doesn't tear
+        struct OpcodeCounters
+        {
+            std::atomic<uint64_t> count{};
+            std::atomic<int64_t> ticks{};
+        };
+
+        // Created by the owning thread on a function's first call and never freed, only ever written by that thread
+        struct FunctionCounters
+        {
+            // Captured while the function is executing, collecting never touches functions that may have been unloaded since
+            std::string name{};
+            std::atomic<uint64_t> calls{};
+            std::atomic<int64_t> inclusive_ticks{};
+            std::atomic<int64_t> exclusive_ticks{};
+        };
+
+        struct FunctionTotals
+        {
+            uint64_t calls{};
+            int64_t inclusive_ticks{};
+            int64_t exclusive_ticks{};
+        };
+
+        struct ActiveFrame
+        {
+            const FFrame* frame{};
+            UFunction* function{};
+            FunctionCounters* counters{};
+            int64_t enter_ticks{};
+            int64_t child_ticks{};
+        };
+
+        struct ThreadProfile
+        {
+            std::array<OpcodeCounters, 0x100> opcodes{};
+            // Owning thread only
+            std::vector<ActiveFrame> frames{};
+            uint32_t session{};
+            std::unordered_map<UFunction*, std::unique_ptr<FunctionCounters>> functions{};
+            // Counters that didn't fit in 'new_functions' yet, retried on the next call
+            std::vector<FunctionCounters*> pending_new_functions{};
+            // Hands new counters from the owning thread to the collecting thread
+            Input::RingBufferSPSC<FunctionCounters*, 4096> new_functions{};
+            // Guarded by 'm_threads_mutex', every counter the collecting thread has received so far
+            std::vector<FunctionCounters*> known_functions{};
+        };
+
+        struct Totals
+        {
+            std::array<OpcodeCounters, 0x100> opcodes{};
+            // Keyed by name so that functions merge across threads, the names are owned by counters that are never freed
+            std::unordered_map<std::string_view, FunctionTotals> functions{};
+        };
+
+    private:
+        std::atomic<bool> m_is_profiling{};
+        // Incremented on every start so that threads drop frames left over from the previous session
+        std::atomic<uint32_t> m_session{};
+        TimestampCalibration m_calibration{};
+        std::mutex m_threads_mutex{};
+        std::vector<std::unique_ptr<ThreadProfile>> m_threads{};
+        // Subtracted from collected totals, set by reset() because counters can't be cleared from another thread
+        std::unique_ptr<Totals> m_baseline{std::make_unique<Totals>()};
+
+    public:
+        auto is_profiling() const -> bool
+        {
+            return m_is_profiling.load(std::memory_order_relaxed);
+        }
+        auto start() -> void;
+        auto stop() -> void;
+        auto reset() -> void;
+
+        // Called around every opcode, 'begin_opcode' returns the timestamp that must be passed to 'end_opcode'
+        auto begin_opcode(const FFrame& stack, UFunction* function, size_t code_offset) -> int64_t;
+        auto end_opcode(const FFrame& stack, uint8_t opcode, int64_t begin_ticks) -> void;
+
+        // Merges the counters of every thread, times are in milliseconds
+        auto collect() -> Results;
+
+        // Throw std::runtime_error if the file can't be written
+        auto static export_json(const Results& results, const std::filesystem::path& path) -> void;
+        auto static export_csv(const Results& results, const std::filesystem::path& path) -> void;
+
+    private:
+        auto get_thread_profile() -> ThreadProfile&;
+        auto get_function_counters(ThreadProfile& profile, UFunction* function) -> FunctionCounters*;
+        auto hand_off_new_functions(ThreadProfile& profile) -> void;
+        auto leave_frames(ThreadProfile& profile, size_t num_frames_to_keep, int64_t now) -> void;
+        auto collect_totals() -> std::unique_ptr<Totals>;
+    };
+} // namespace RC::GUI::KismetDebuggerMod
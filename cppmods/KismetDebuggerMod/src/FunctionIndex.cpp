@@ -0,0 +1,219 @@
+#include <FunctionIndex.hpp>
+
+#include <bit>
+#include <unordered_set>
+
+#include <Helpers/String.hpp>
+#include <Unreal/UFunction.hpp>
+#include <Unreal/UObject.hpp>
+#include <Unreal/UObjectGlobals.hpp>
+
+namespace RC::GUI::KismetDebuggerMod
+{
+    static auto to_lowercase_ascii(std::string_view string) -> std::string
+    {
+        std::string lowercase_string(string.size(), '\0');
+        for (size_t i = 0; i < string.size(); ++i)
+        {
+            auto ch = string[i];
+            lowercase_string[i] = ch >= 'A' && ch <= 'Z' ? static_cast<char>(ch - 'A' + 'a') : ch;
+        }
+        return lowercase_string;
+    }
+
+    void FunctionIndex::CreateListener::NotifyUObjectCreated(const UObjectBase* object, int32 object_index)
+    {
+        auto as_uobject = std::bit_cast<UObject*>(object);
+        if (as_uobject->IsA<UFunction>())
+        {
+            index->queue_change(static_cast<UFunction*>(as_uobject), true);
+        }
+    }
+
+    void FunctionIndex::CreateListener::OnUObjectArrayShutdown()
+    {
+        UObjectArray::RemoveUObjectCreateListener(this);
+        index->m_create_listener_registered = false;
+    }
+
+    void FunctionIndex::DeleteListener::NotifyUObjectDeleted(const UObjectBase* object, int32 object_index)
+    {
+        auto as_uobject = std::bit_cast<UObject*>(object);
+        if (as_uobject->IsA<UFunction>())
+        {
+            index->queue_change(static_cast<UFunction*>(as_uobject), false);
+        }
+    }
+
+    void FunctionIndex::DeleteListener::OnUObjectArrayShutdown()
+    {
+        UObjectArray::RemoveUObjectDeleteListener(this);
+        index->m_delete_listener_registered = false;
+    }
+
+    FunctionIndex::FunctionIndex()
+    {
+        m_create_listener.index = this;
+        m_delete_listener.index = this;
+    }
+
+    FunctionIndex::~FunctionIndex()
+    {
+        if (m_create_listener_registered)
+        {
+            UObjectArray::RemoveUObjectCreateListener(&m_create_listener);
+        }
+        if (m_delete_listener_registered)
+        {
+            UObjectArray::RemoveUObjectDeleteListener(&m_delete_listener);
+        }
+    }
+
+    auto FunctionIndex::queue_change(UFunction* function, bool is_created) -> void
+    {
+        std::lock_guard lock(m_pending_changes_mutex);
+        if (m_needs_rebuild)
+        {
+            return;
+        }
+        if (m_pending_changes.size() >= max_pending_changes)
+        {
+            // Nobody has looked at the index in a long while, cheaper to walk GUObjectArray again than to keep queueing
+            m_pending_changes.clear();
+            m_pending_changes.shrink_to_fit();
+            m_needs_rebuild = true;
+            return;
+        }
+        m_pending_changes.emplace_back(PendingChange{function, is_created});
+    }
+
+    auto FunctionIndex::build() -> void
+    {
+        {
+            std::lock_guard lock(m_pending_changes_mutex);
+            // Anything queued so far is covered by the walk below, changes made during the walk are applied by the next update
+            m_pending_changes.clear();
+            m_needs_rebuild = false;
+        }
+
+        m_entries.clear();
+        m_entry_index_by_function.clear();
+        UObjectGlobals::ForEachUObject([&](UObject* object, ...) {
+            if (object->IsA<UFunction>())
+            {
+                add(static_cast<UFunction*>(object));
+            }
+            return LoopAction::Continue;
+        });
+
+        m_is_built = true;
+        m_matches_are_stale = true;
+    }
+
+    auto FunctionIndex::add(UFunction* function) -> void
+    {
+        if (m_entry_index_by_function.contains(function))
+        {
+            return;
+        }
+        auto full_name = to_string(function->GetFullName());
+        auto lowercase_full_name = to_lowercase_ascii(full_name);
+        m_entry_index_by_function.emplace(function, m_entries.size());
+        m_entries.emplace_back(Entry{function, std::move(full_name), std::move(lowercase_full_name)});
+    }
+
+    auto FunctionIndex::remove(UFunction* function) -> void
+    {
+        auto it = m_entry_index_by_function.find(function);
+        if (it == m_entry_index_by_function.end())
+        {
+            return;
+        }
+
+        // Order doesn't matter, move the last entry into the hole
+        auto entry_index = it->second;
+        m_entry_index_by_function.erase(it);
+        if (entry_index != m_entries.size() - 1)
+        {
+            m_entries[entry_index] = std::move(m_entries.back());
+            m_entry_index_by_function[m_entries[entry_index].function] = entry_index;
+        }
+        m_entries.pop_back();
+    }
+
+    auto FunctionIndex::update() -> void
+    {
+        if (!m_create_listener_registered)
+        {
+            UObjectArray::AddUObjectCreateListener(&m_create_listener);
+            m_create_listener_registered = true;
+        }
+        if (!m_delete_listener_registered)
+        {
+            UObjectArray::AddUObjectDeleteListener(&m_delete_listener);
+            m_delete_listener_registered = true;
+        }
+
+        std::vector<PendingChange> pending_changes{};
+        bool needs_rebuild{};
+        {
+            std::lock_guard lock(m_pending_changes_mutex);
+            pending_changes.swap(m_pending_changes);
+            needs_rebuild = m_needs_rebuild;
+        }
+
+        if (!m_is_built || needs_rebuild)
+        {
+            build();
+            return;
+        }
+        if (pending_changes.empty())
+        {
+            return;
+        }
+
+        // Names are only read for functions that are still alive once every queued change is applied
+        // A function that was created and deleted since the last update is never touched
+        std::unordered_set<UFunction*> created_functions{};
+        for (const auto& change : pending_changes)
+        {
+            remove(change.function);
+            if (change.is_created)
+            {
+                created_functions.emplace(change.function);
+            }
+            else
+            {
+                created_functions.erase(change.function);
+            }
+        }
+        for (auto function : created_functions)
+        {
+            add(function);
+        }
+
+        m_matches_are_stale = true;
+    }
+
+    auto FunctionIndex::filter(std::string_view query) -> const std::vector<uint32_t>&
+    {
+        if (!m_matches_are_stale && query == m_query)
+        {
+            return m_matches;
+        }
+
+        m_query = query;
+        m_matches_are_stale = false;
+        m_matches.clear();
+
+        auto lowercase_query = to_lowercase_ascii(query);
+        for (size_t i = 0; i < m_entries.size(); ++i)
+        {
+            if (m_entries[i].lowercase_full_name.find(lowercase_query) != std::string::npos)
+            {
+                m_matches.emplace_back(static_cast<uint32_t>(i));
+            }
+        }
+        return m_matches;
+    }
+} // namespace RC::GUI::KismetDebuggerMod
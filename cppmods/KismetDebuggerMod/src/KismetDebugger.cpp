@@ -1,5 +1,7 @@
 #include <KismetDebugger.hpp>
 
+#include <atomic>
+#include <bit>
 #include <vector>
 #include <unordered_map>
 #include <iostream>
@@ -27,7 +29,9 @@
 
 #include "Profiler/Profiler.hpp"
 
+#include <TraceRecorder.hpp>
 #include <UE4SSProgram.hpp>
+#include <VMProfiler.hpp>
 
 namespace RC::GUI::KismetDebuggerMod
 {
@@ -37,18 +41,57 @@ namespace RC::GUI::KismetDebuggerMod
     FNativeFuncPtr GNativesOriginal[EExprToken::EX_Max];
     volatile bool is_hooked = false; // cannot hook *immediately* as GNatives is populated at runtime
 
-    volatile bool should_pause = false;
-    volatile bool should_next = false;
+    std::atomic<bool> should_pause = false;
+    std::atomic<bool> should_next = false;
     std::optional<PausedContext> context;
     std::mutex context_mutex;
 
     BreakpointStore g_breakpoints;
+    TraceRecorder g_trace_recorder;
+    VMProfiler g_vm_profiler;
+
+    // Only called when a profiler zone actually consumes the name, the full name is built once per function
+    auto get_profiler_zone_name(UFunction* fn) -> const char*
+    {
+        thread_local std::unordered_map<UFunction*, std::string> zone_names{};
+        auto [it, inserted] = zone_names.try_emplace(fn);
+        if (inserted)
+        {
+            it->second = to_string(fn->GetFullName());
+        }
+        return it->second.c_str();
+    }
+
+    // Time spent paused at a breakpoint is never part of the profile because only the original native is timed
+    void execute_original(UObject* Context, FFrame& Stack, void* RESULT_DECL, EExprToken N, UFunction* fn)
+    {
+        if (!g_vm_profiler.is_profiling())
+        {
+            GNativesOriginal[N](Context, Stack, RESULT_DECL);
+            return;
+        }
+
+        auto begin_ticks = g_vm_profiler.begin_opcode(Stack, fn, Stack.Code() - fn->GetScript().GetData() - 1);
+        GNativesOriginal[N](Context, Stack, RESULT_DECL);
+        g_vm_profiler.end_opcode(Stack, static_cast<uint8_t>(N), begin_ticks);
+    }
 
     void hook_expr_internal(UObject* Context, FFrame& Stack, void* RESULT_DECL, EExprToken N) {
         UFunction* fn = Stack.Node();
-        StringType name = Stack.Node()->GetFullName();
-        ProfilerTransientScopeNamed(scope, to_string(name).c_str(), true);
-            
+        ProfilerTransientScopeNamed(scope, get_profiler_zone_name(fn), true);
+
+        if (g_trace_recorder.is_recording())
+        {
+            g_trace_recorder.record(fn, static_cast<uint32_t>(Stack.Code() - fn->GetScript().GetData() - 1), static_cast<uint8_t>(N));
+        }
+
+        // Hot path, every Blueprint instruction goes through here so nothing else is done unless the debugger can actually pause
+        if (!should_pause.load(std::memory_order_relaxed) && !g_breakpoints.has_any_breakpoints())
+        {
+            execute_original(Context, Stack, RESULT_DECL, N, fn);
+            return;
+        }
+
         size_t index = Stack.Code() - fn->GetScript().GetData() - 1;
         if (should_pause || g_breakpoints.has_breakpoint(fn, index))
         {
@@ -71,7 +114,7 @@ namespace RC::GUI::KismetDebuggerMod
             should_next = false;
         }
 
-        GNativesOriginal[N](Context, Stack, RESULT_DECL);
+        execute_original(Context, Stack, RESULT_DECL, N, fn);
     }
     
     template <unsigned N>
@@ -88,137 +131,219 @@ namespace RC::GUI::KismetDebuggerMod
 
     typedef std::unordered_map<std::string, std::unordered_set<size_t>> JsonBreakpoints;
 
+    void BreakpointStore::CreateListener::NotifyUObjectCreated(const UObjectBase* object, int32 object_index)
+    {
+        if (!store->m_has_pending_functions.load(std::memory_order_relaxed)) return;
+
+        if (std::bit_cast<UObject*>(object)->IsA<UFunction>())
+            store->m_functions_created.store(true, std::memory_order_relaxed);
+    }
+    void BreakpointStore::CreateListener::OnUObjectArrayShutdown()
+    {
+        UObjectArray::RemoveUObjectCreateListener(this);
+        store->m_create_listener_registered = false;
+    }
+
+    void BreakpointStore::DeleteListener::NotifyUObjectDeleted(const UObjectBase* object, int32 object_index)
+    {
+        auto as_uobject = std::bit_cast<UObject*>(object);
+        if (as_uobject->IsA<UFunction>())
+            store->forget_function(static_cast<UFunction*>(as_uobject));
+    }
+    void BreakpointStore::DeleteListener::OnUObjectArrayShutdown()
+    {
+        UObjectArray::RemoveUObjectDeleteListener(this);
+        store->m_delete_listener_registered = false;
+    }
+
     BreakpointStore::BreakpointStore()
     {
+        m_create_listener.store = this;
+        m_delete_listener.store = this;
+        m_resolved_tables.emplace_back(std::make_unique<const ResolvedBreakpoints>());
+        m_resolved.store(m_resolved_tables.back().get(), std::memory_order_release);
     }
     BreakpointStore::~BreakpointStore()
     {
+        if (m_create_listener_registered)
+            UObjectArray::RemoveUObjectCreateListener(&m_create_listener);
+        if (m_delete_listener_registered)
+            UObjectArray::RemoveUObjectDeleteListener(&m_delete_listener);
+    }
+    auto BreakpointStore::register_listeners() -> void
+    {
+        if (!m_create_listener_registered)
+        {
+            UObjectArray::AddUObjectCreateListener(&m_create_listener);
+            m_create_listener_registered = true;
+        }
+        if (!m_delete_listener_registered)
+        {
+            UObjectArray::AddUObjectDeleteListener(&m_delete_listener);
+            m_delete_listener_registered = true;
+        }
     }
     auto BreakpointStore::load(std::filesystem::path& path) -> void
     {
         JsonBreakpoints breakpoints{};
         auto ec = glz::read_file_json(breakpoints, path.string(), std::string{});
 
-        for (const auto& [fn, bps] : breakpoints)
         {
-            auto wfn = ensure_str(fn);
-            for (const auto& bp : bps)
+            std::scoped_lock lock(m_mutex);
+            for (const auto& [fn, bps] : breakpoints)
             {
-                add_breakpoint(wfn, bp);
+                auto& function_breakpoints = m_breakpoints_by_name[ensure_str(fn)];
+                for (const auto& bp : bps)
+                {
+                    if (function_breakpoints.emplace(bp).second)
+                        m_num_breakpoints.fetch_add(1, std::memory_order_relaxed);
+                }
             }
         }
+
+        m_has_pending_functions = true;
+        resolve_pending_functions();
     }
     auto BreakpointStore::save() -> void
+    {
+        std::scoped_lock lock(m_mutex);
+        save_locked();
+    }
+    auto BreakpointStore::save_locked() -> void
     {
             JsonBreakpoints breakpoints{};
             for (const auto& [fn, bps] : m_breakpoints_by_name) {
-                if (bps) breakpoints[to_string(fn)] = *bps;
+                if (!bps.empty()) breakpoints[to_string(fn)] = bps;
             }
             auto ec = glz::write_file_json(breakpoints, Debugger::m_save_path.string(), std::string{});
 
     }
-    
-    auto BreakpointStore::has_breakpoint(UFunction* fn, size_t index) -> bool
+
+    auto BreakpointStore::publish_resolved() -> void
     {
-        auto [it_fn, inserted] = m_breakpoints_by_function.emplace(fn, nullptr);
-        if (!inserted)
+        // Only the breakpoint indices size the bitsets, cached functions are never dereferenced here
+        ResolvedBreakpoints::BitsByFunction bits_by_function{};
+        for (const auto& [name, bps] : m_breakpoints_by_name)
         {
-            if (it_fn->second)
-                return it_fn->second->contains(index);
-        }
-        else
-        {
-            // insert null so we know we've already inserted the fn ptr into the name map
-            auto [it_name, inserted] = m_breakpoints_by_name.emplace(fn->GetFullName(), nullptr);
-            if (!inserted)
+            auto it_fn = m_functions_by_name.find(name);
+            if (it_fn == m_functions_by_name.end()) continue;
+
+            for (const auto& index : bps)
             {
-                if (it_name->second)
-                {
-                    it_fn->second = it_name->second;
-                    return it_name->second->contains(index);
-                }
+                ResolvedBreakpoints::set(bits_by_function, it_fn->second, index);
             }
         }
-        return false;
+
+        m_resolved_tables.emplace_back(std::make_unique<const ResolvedBreakpoints>(bits_by_function));
+        m_resolved.store(m_resolved_tables.back().get(), std::memory_order_release);
     }
-    auto BreakpointStore::add_breakpoint(UFunction* fn, size_t index) -> void
+
+    auto BreakpointStore::forget_function(UFunction* fn) -> void
     {
-        std::shared_ptr<FunctionBreakpoints> bps;
-        auto [it_fn, inserted_fn] = m_breakpoints_by_function.emplace(fn, nullptr);
-        auto [it_name, inserted_name] = m_breakpoints_by_name.emplace(fn->GetFullName(), nullptr);
-        if (!inserted_fn && it_fn->second) bps = it_fn->second;
-        if (!inserted_name && it_name->second) bps = it_name->second;
-
-        if (!bps)
-            bps = it_fn->second = it_name->second = std::make_shared<FunctionBreakpoints>();
-
-        bps->emplace(index);
-
-        save();
-
-        /*
-        std::cout << "all breakpoints by fn ptr:" << std::endl;
-        for (const auto& fns : m_breakpoints_by_function) {
-            std::cout << (void*) fns.first << " = ";
-            if (fns.second)
-                for (const auto& bps : *fns.second) {
-                    std::cout << bps << " ";
-                }
-            else
-                std::cout << "null";
-            std::cout << std::endl;
-        }
+        m_num_deleted_functions.fetch_add(1, std::memory_order_acq_rel);
 
-        std::cout << "all breakpoints by fn name:" << std::endl;
-        for (const auto& fns : m_breakpoints_by_name) {
-            std::wcout << fns.first << " = ";
-            if (fns.second)
-                for (const auto& bps : *fns.second) {
-                    std::cout << bps << " ";
-                }
-            else
-                std::cout << "null";
-            std::cout << std::endl;
+        // Always erased, even while no breakpoint is set, a cached pointer outlives its breakpoints and would be reused when one is added again
+        std::scoped_lock lock(m_mutex);
+        auto num_erased = std::erase_if(m_functions_by_name, [&](const auto& pair) { return pair.second == fn; });
+        if (num_erased == 0) return;
+
+        // The function may be loaded again later (e.g. when its level streams back in)
+        m_has_pending_functions = true;
+        publish_resolved();
+    }
+
+    auto BreakpointStore::update() -> void
+    {
+        {
+            std::scoped_lock lock(m_mutex);
+            register_listeners();
         }
 
-        std::cout << "all non-null breakpoints by fn name:" << std::endl;
-        for (const auto& fns : m_breakpoints_by_name) {
-            if (fns.second)
+        if (m_has_pending_functions.load(std::memory_order_relaxed) && m_functions_created.exchange(false, std::memory_order_relaxed))
+            resolve_pending_functions();
+    }
+
+    auto BreakpointStore::resolve_pending_functions() -> void
+    {
+        if (!m_has_pending_functions) return;
+
+        std::vector<StringType> pending_names{};
+        {
+            std::scoped_lock lock(m_mutex);
+            register_listeners();
+            for (const auto& [name, bps] : m_breakpoints_by_name)
             {
-                std::wcout << fns.first << " = ";
-                for (const auto& bps : *fns.second) {
-                    std::cout << bps << " ";
-                }
-                std::cout << std::endl;
+                if (!bps.empty() && !m_functions_by_name.contains(name)) pending_names.emplace_back(name);
             }
         }
-        */
+
+        // Not looked up under 'm_mutex' because the delete listener takes it while the engine holds its own locks
+        auto num_deleted_functions = m_num_deleted_functions.load(std::memory_order_acquire);
+        std::vector<std::pair<StringType, UFunction*>> found_functions{};
+        for (const auto& name : pending_names)
+        {
+            // Full names are "<class> <path>", StaticFindObject wants the path
+            auto path_start = name.find(STR(' '));
+            auto path = path_start == name.npos ? name : name.substr(path_start + 1);
+            if (auto fn = UObjectGlobals::StaticFindObject<UFunction*>(nullptr, nullptr, path))
+                found_functions.emplace_back(name, fn);
+        }
+
+        std::scoped_lock lock(m_mutex);
+        if (m_num_deleted_functions.load(std::memory_order_acquire) != num_deleted_functions)
+        {
+            // Any of the functions found above may be gone already, try again once more functions are created
+            m_functions_created = true;
+            return;
+        }
+
+        for (auto& [name, fn] : found_functions)
+        {
+            m_functions_by_name.emplace(std::move(name), fn);
+        }
+        // Breakpoints may have been added by name while the lock wasn't held
+        m_has_pending_functions = std::ranges::any_of(m_breakpoints_by_name, [&](const auto& pair) {
+            return !pair.second.empty() && !m_functions_by_name.contains(pair.first);
+        });
+        if (!found_functions.empty()) publish_resolved();
     }
-    auto BreakpointStore::add_breakpoint(const StringType& fn, size_t index) -> void
+
+    auto BreakpointStore::add_breakpoint(UFunction* fn, size_t index) -> void
     {
-        std::shared_ptr<FunctionBreakpoints> bps;
-        auto [it_name, inserted_name] = m_breakpoints_by_name.emplace(fn, nullptr);
-        if (!inserted_name && it_name->second) bps = it_name->second;
+        auto name = fn->GetFullName();
 
-        if (!bps)
-            bps = it_name->second = std::make_shared<FunctionBreakpoints>();
+        std::scoped_lock lock(m_mutex);
+        register_listeners();
+        m_functions_by_name[name] = fn;
+        if (m_breakpoints_by_name[name].emplace(index).second)
+            m_num_breakpoints.fetch_add(1, std::memory_order_relaxed);
 
-        bps->emplace(index);
+        publish_resolved();
+        save_locked();
+    }
+    auto BreakpointStore::add_breakpoint(const StringType& fn, size_t index) -> void
+    {
+        {
+            std::scoped_lock lock(m_mutex);
+            if (m_breakpoints_by_name[fn].emplace(index).second)
+                m_num_breakpoints.fetch_add(1, std::memory_order_relaxed);
+            save_locked();
+        }
 
-        save();
+        m_has_pending_functions = true;
+        resolve_pending_functions();
     }
     auto BreakpointStore::remove_breakpoint(UFunction* fn, size_t index) -> void
     {
-        std::shared_ptr<FunctionBreakpoints> bps;
-        auto [it_fn, inserted_fn] = m_breakpoints_by_function.emplace(fn, nullptr);
-        auto [it_name, inserted_name] = m_breakpoints_by_name.emplace(fn->GetFullName(), nullptr);
-        if (!inserted_fn && it_fn->second) bps = it_fn->second;
-        if (!inserted_name && it_fn->second) bps = it_name->second;
+        auto name = fn->GetFullName();
 
-        if (bps)
-            bps->erase(index);
+        std::scoped_lock lock(m_mutex);
+        auto it_name = m_breakpoints_by_name.find(name);
+        if (it_name != m_breakpoints_by_name.end() && it_name->second.erase(index))
+            m_num_breakpoints.fetch_sub(1, std::memory_order_relaxed);
 
-        save();
+        publish_resolved();
+        save_locked();
     }
 
     Debugger::Debugger() : m_breakpoints(g_breakpoints)
@@ -284,6 +409,8 @@ namespace RC::GUI::KismetDebuggerMod
     }
     auto Debugger::disable() -> void
     {
+        g_trace_recorder.stop();
+        g_vm_profiler.stop();
         for (int i = 0; i < EExprToken::EX_Max; i++)
         {
             GNatives_Internal[i] = GNativesOriginal[i];
@@ -345,6 +472,16 @@ namespace RC::GUI::KismetDebuggerMod
         }
     }
 
+    auto Debugger::update() -> void
+    {
+        // Blueprints keep loading after the breakpoints are, retry the ones whose function couldn't be found yet
+        if (auto now = std::chrono::steady_clock::now(); now - m_last_breakpoint_resolve_time > std::chrono::seconds(1))
+        {
+            m_last_breakpoint_resolve_time = now;
+            m_breakpoints.update();
+        }
+    }
+
     auto Debugger::render() -> void
     {
         std::scoped_lock lock(context_mutex);
@@ -427,6 +564,47 @@ namespace RC::GUI::KismetDebuggerMod
             }
         }
 
+        if (is_hooked && ImGui::CollapsingHeader("Trace"))
+        {
+            if (ImGui::Button(g_trace_recorder.is_recording() ? "stop recording" : "record"))
+            {
+                if (g_trace_recorder.is_recording())
+                {
+                    g_trace_recorder.stop();
+                }
+                else
+                {
+                    g_trace_recorder.start();
+                }
+            }
+            ImGui::SameLine();
+            if (ImGui::Button("clear"))
+            {
+                g_trace_recorder.clear();
+            }
+            ImGui::SameLine();
+            if (ImGui::Button("dump"))
+            {
+                auto file_name = fmt::format(STR("trace_{}.ktrace"), std::chrono::system_clock::now().time_since_epoch().count());
+                auto trace_path = std::filesystem::path{UE4SSProgram::get_program().get_working_directory()} / STR("Mods") / STR("KismetDebugger") / STR("traces") / file_name;
+                try
+                {
+                    g_trace_recorder.dump(trace_path);
+                    Output::send(STR("[KismetDebugger]: Trace written to {}\n"), trace_path.native());
+                }
+                catch (std::exception& e)
+                {
+                    Output::send<LogLevel::Warning>(STR("[KismetDebugger]: Failed to write trace: {}\n"), ensure_str(e.what()));
+                }
+            }
+            ImGui::Text("%zu records", g_trace_recorder.get_num_records());
+        }
+
+        if (is_hooked && ImGui::CollapsingHeader("Profiler"))
+        {
+            render_profiler();
+        }
+
         if (current_fn)
         {
             if (ImGui::CollapsingHeader("Locals", ImGuiTreeNodeFlags_DefaultOpen))
@@ -492,6 +670,159 @@ namespace RC::GUI::KismetDebuggerMod
             m_last_code = nullptr;
     }
 
+    // Sorts by the column the table's sort spec points at, 'column_getters' are given in column order
+    template <typename Row, typename... ColumnGetters>
+    static auto sort_profiler_rows(std::vector<Row>& rows, const ImGuiTableColumnSortSpecs& spec, ColumnGetters... column_getters) -> void
+    {
+        auto sort_by = [&](auto getter) {
+            std::ranges::sort(rows, [&](const Row& a, const Row& b) {
+                return spec.SortDirection == ImGuiSortDirection_Ascending ? getter(a) < getter(b) : getter(b) < getter(a);
+            });
+        };
+        int column{};
+        ((column++ == spec.ColumnIndex ? sort_by(column_getters) : void()), ...);
+    }
+
+    auto Debugger::render_profiler() -> void
+    {
+        auto write_results = [&](auto export_function, const StringType& extension) {
+            auto file_name = fmt::format(STR("profile_{}.{}"), std::chrono::system_clock::now().time_since_epoch().count(), extension);
+            auto results_path = std::filesystem::path{UE4SSProgram::get_program().get_working_directory()} / STR("Mods") / STR("KismetDebugger") / STR("profiles") / file_name;
+            try
+            {
+                export_function(m_profiler_results, results_path);
+                Output::send(STR("[KismetDebugger]: Profile written to {}\n"), results_path.native());
+            }
+            catch (std::exception& e)
+            {
+                Output::send<LogLevel::Warning>(STR("[KismetDebugger]: Failed to write profile: {}\n"), ensure_str(e.what()));
+            }
+        };
+
+        if (ImGui::Button(g_vm_profiler.is_profiling() ? "stop profiling" : "profile"))
+        {
+            if (g_vm_profiler.is_profiling())
+            {
+                g_vm_profiler.stop();
+            }
+            else
+            {
+                g_vm_profiler.start();
+            }
+        }
+        ImGui::SameLine();
+        if (ImGui::Button("reset##profiler"))
+        {
+            g_vm_profiler.reset();
+            m_last_profiler_refresh_time = {};
+        }
+        ImGui::SameLine();
+        if (ImGui::Button("export json"))
+        {
+            write_results(&VMProfiler::export_json, STR("json"));
+        }
+        ImGui::SameLine();
+        if (ImGui::Button("export csv"))
+        {
+            write_results(&VMProfiler::export_csv, STR("csv"));
+        }
+
+        // Merging every thread's counters isn't free, twice a second is plenty for a table that's read by a human
+        if (auto now = std::chrono::steady_clock::now(); now - m_last_profiler_refresh_time > std::chrono::milliseconds(500))
+        {
+            m_last_profiler_refresh_time = now;
+            m_profiler_results = g_vm_profiler.collect();
+            m_profiler_functions_need_sort = true;
+            m_profiler_opcodes_need_sort = true;
+        }
+
+        constexpr auto table_flags = ImGuiTableFlags_Sortable | ImGuiTableFlags_Resizable | ImGuiTableFlags_ScrollY | ImGuiTableFlags_RowBg | ImGuiTableFlags_Borders;
+        if (ImGui::BeginTabBar("KismetDebugger_ProfilerTabs"))
+        {
+            if (ImGui::BeginTabItem("Functions"))
+            {
+                if (ImGui::BeginTable("KismetDebugger_ProfilerFunctions", 4, table_flags, {0, 300}))
+                {
+                    ImGui::TableSetupScrollFreeze(0, 1);
+                    ImGui::TableSetupColumn("Function");
+                    ImGui::TableSetupColumn("Calls", ImGuiTableColumnFlags_PreferSortDescending);
+                    ImGui::TableSetupColumn("Inclusive ms", ImGuiTableColumnFlags_PreferSortDescending);
+                    ImGui::TableSetupColumn("Exclusive ms", ImGuiTableColumnFlags_DefaultSort | ImGuiTableColumnFlags_PreferSortDescending);
+                    ImGui::TableHeadersRow();
+
+                    auto& rows = m_profiler_results.functions;
+                    if (auto specs = ImGui::TableGetSortSpecs(); specs && specs->SpecsCount > 0 && (specs->SpecsDirty || m_profiler_functions_need_sort))
+                    {
+                        m_profiler_functions_need_sort = false;
+                        sort_profiler_rows(rows, specs->Specs[0],
+                                           [](const VMProfiler::FunctionResult& row) -> const auto& { return row.function; },
+                                           [](const VMProfiler::FunctionResult& row) -> const auto& { return row.calls; },
+                                           [](const VMProfiler::FunctionResult& row) -> const auto& { return row.inclusive_ms; },
+                                           [](const VMProfiler::FunctionResult& row) -> const auto& { return row.exclusive_ms; });
+                        specs->SpecsDirty = false;
+                    }
+
+                    ImGuiListClipper clipper{};
+                    clipper.Begin(static_cast<int>(rows.size()));
+                    while (clipper.Step())
+                    {
+                        for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; ++i)
+                        {
+                            const auto& row = rows[i];
+                            ImGui::TableNextRow();
+                            ImGui::TableNextColumn();
+                            ImGui::TextUnformatted(row.function.c_str());
+                            ImGui::TableNextColumn();
+                            ImGui::Text("%llu", static_cast<unsigned long long>(row.calls));
+                            ImGui::TableNextColumn();
+                            ImGui::Text("%.3f", row.inclusive_ms);
+                            ImGui::TableNextColumn();
+                            ImGui::Text("%.3f", row.exclusive_ms);
+                        }
+                    }
+                    ImGui::EndTable();
+                }
+                ImGui::EndTabItem();
+            }
+            if (ImGui::BeginTabItem("Opcodes"))
+            {
+                if (ImGui::BeginTable("KismetDebugger_ProfilerOpcodes", 3, table_flags, {0, 300}))
+                {
+                    ImGui::TableSetupScrollFreeze(0, 1);
+                    ImGui::TableSetupColumn("Opcode");
+                    ImGui::TableSetupColumn("Count", ImGuiTableColumnFlags_PreferSortDescending);
+                    ImGui::TableSetupColumn("Total ms", ImGuiTableColumnFlags_DefaultSort | ImGuiTableColumnFlags_PreferSortDescending);
+                    ImGui::TableHeadersRow();
+
+                    auto& rows = m_profiler_results.opcodes;
+                    if (auto specs = ImGui::TableGetSortSpecs(); specs && specs->SpecsCount > 0 && (specs->SpecsDirty || m_profiler_opcodes_need_sort))
+                    {
+                        m_profiler_opcodes_need_sort = false;
+                        sort_profiler_rows(rows, specs->Specs[0],
+                                           [](const VMProfiler::OpcodeResult& row) -> const auto& { return row.opcode; },
+                                           [](const VMProfiler::OpcodeResult& row) -> const auto& { return row.count; },
+                                           [](const VMProfiler::OpcodeResult& row) -> const auto& { return row.total_ms; });
+                        specs->SpecsDirty = false;
+                    }
+
+                    for (const auto& row : rows)
+                    {
+                        ImGui::TableNextRow();
+                        ImGui::TableNextColumn();
+                        ImGui::TextUnformatted(row.opcode.c_str());
+                        ImGui::TableNextColumn();
+                        ImGui::Text("%llu", static_cast<unsigned long long>(row.count));
+                        ImGui::TableNextColumn();
+                        ImGui::Text("%.3f", row.total_ms);
+                    }
+                    ImGui::EndTable();
+                }
+                ImGui::EndTabItem();
+            }
+            ImGui::EndTabBar();
+        }
+    }
+
     auto Debugger::render_nav_bar(float width) -> void
     {
         float start = ImGui::GetCursorPosX();
@@ -522,7 +853,8 @@ namespace RC::GUI::KismetDebuggerMod
 
         // https://github.com/ocornut/imgui/issues/718#issuecomment-1249822993
         ImGui::SameLine();
-        ImGui::SetNextItemWidth(width - (ImGui::GetCursorPosX() - start));
+        const float nav_input_width = width - (ImGui::GetCursorPosX() - start);
+        ImGui::SetNextItemWidth(nav_input_width);
         const bool is_input_text_enter_pressed = ImGui::InputText("##input", &m_nav_function, ImGuiInputTextFlags_EnterReturnsTrue);
         const bool is_input_text_active = ImGui::IsItemActive();
         const bool is_input_text_activated = ImGui::IsItemActivated();
@@ -535,44 +867,43 @@ namespace RC::GUI::KismetDebuggerMod
             //ImGui::SetNextWindowSize({ ImGui::GetItemRectSize().x, 0 });
             if (ImGui::BeginPopup("##popup", ImGuiWindowFlags_NoTitleBar | ImGuiWindowFlags_NoMove | ImGuiWindowFlags_NoResize | ImGuiWindowFlags_ChildWindow))
             {
-                int n = 0;
-
-                UObjectGlobals::ForEachUObject([&](UObject* object, ...) {
-                    if (object->IsA<UFunction>())
-                    {
-                        std::string full_name = to_string(object->GetFullName());
+                m_function_index.update();
+                const auto& entries = m_function_index.get_entries();
+                const auto& matches = m_function_index.filter(m_nav_function);
 
-                        auto it = std::search(
-                            full_name.begin(), full_name.end(),
-                            m_nav_function.begin(), m_nav_function.end(),
-                            [](auto ch1, auto ch2) { return std::toupper(ch1) == std::toupper(ch2); }
-                        );
+                if (matches.empty())
+                {
+                    ImGui::Text("[nothing]");
+                }
+                else
+                {
+                    constexpr size_t max_visible_matches = 12;
+                    auto list_height = static_cast<float>(std::min(matches.size(), max_visible_matches)) * ImGui::GetTextLineHeightWithSpacing();
+                    ImGui::BeginChild("##matches", {nav_input_width, list_height});
 
-                        if (it != full_name.end())
+                    ImGuiListClipper clipper{};
+                    clipper.Begin(static_cast<int>(matches.size()));
+                    while (clipper.Step())
+                    {
+                        for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; ++i)
                         {
-                            const char* name_c_str = full_name.c_str();
-
-                            if (ImGui::Selectable(name_c_str))
+                            const auto& entry = entries[matches[i]];
+                            ImGui::PushID(i);
+                            if (ImGui::Selectable(entry.full_name.c_str()))
                             {
                                 ImGui::ClearActiveID();
-                                m_function_name_map[full_name] = static_cast<UFunction*>(object);
-                                m_nav_function = full_name;
-                            }
-
-                            if (n++ > 10)
-                            {
-                                ImGui::Text("...");
-                                return LoopAction::Break;
+                                m_function_name_map[entry.full_name] = entry.function;
+                                m_nav_function = entry.full_name;
                             }
+                            ImGui::PopID();
                         }
                     }
-                    return LoopAction::Continue;
-                });
 
-                if (!n)
-                    ImGui::Text("[nothing]");
+                    ImGui::EndChild();
+                    ImGui::TextDisabled("%zu of %zu functions", matches.size(), entries.size());
+                }
 
-                if (is_input_text_enter_pressed || (!is_input_text_active && !ImGui::IsWindowFocused()))
+                if (is_input_text_enter_pressed || (!is_input_text_active && !ImGui::IsWindowFocused(ImGuiFocusedFlags_ChildWindows)))
                 {
                     ImGui::CloseCurrentPopup();
                     // TODO check valid
@@ -0,0 +1,211 @@
+#include <TraceRecorder.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <unordered_map>
+
+#include <Helpers/String.hpp>
+#include <Unreal/UFunction.hpp>
+
+#include <KismetDebugger.hpp>
+
+namespace RC::GUI::KismetDebuggerMod
+{
+    constexpr static uint32_t trace_file_magic = 0x4352544B; // 'KTRC'
+    constexpr static uint32_t trace_file_version = 1;
+
+    class TraceWriter
+    {
+    private:
+        std::ofstream& m_stream;
+
+    public:
+        explicit TraceWriter(std::ofstream& stream) : m_stream(stream)
+        {
+        }
+
+    public:
+        template <typename T>
+        auto write(T value) -> void
+        {
+            static_assert(std::endian::native == std::endian::little, "Trace files are little endian");
+            m_stream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+        }
+
+        template <typename LengthType>
+        auto write_string(std::string_view string) -> void
+        {
+            write(static_cast<LengthType>(string.size()));
+            m_stream.write(string.data(), static_cast<std::streamsize>(string.size()));
+        }
+
+        auto write_records(const std::vector<TraceRecord>& records) -> void
+        {
+            m_stream.write(reinterpret_cast<const char*>(records.data()), static_cast<std::streamsize>(records.size() * sizeof(TraceRecord)));
+        }
+    };
+
+    auto TraceRecorder::start() -> void
+    {
+        m_calibration.start();
+        m_is_recording = true;
+    }
+
+    auto TraceRecorder::stop() -> void
+    {
+        m_is_recording = false;
+    }
+
+    auto TraceRecorder::clear() -> void
+    {
+        // Buffers are never freed because each recording thread caches a pointer to its own
+        std::scoped_lock lock(m_buffers_mutex);
+        for (const auto& buffer : m_buffers)
+        {
+            buffer->cleared_count = buffer->write_count.load(std::memory_order_acquire);
+        }
+    }
+
+    auto TraceRecorder::register_thread() -> ThreadBuffer*
+    {
+        std::stringstream thread_id_stream{};
+        thread_id_stream << std::this_thread::get_id();
+
+        auto buffer = std::make_unique<ThreadBuffer>();
+        thread_id_stream >> buffer->thread_id;
+
+        std::scoped_lock lock(m_buffers_mutex);
+        return m_buffers.emplace_back(std::move(buffer)).get();
+    }
+
+    auto TraceRecorder::name_function(ThreadBuffer& buffer, const UFunction* function) -> void
+    {
+        buffer.named_functions.emplace(function);
+        auto name = to_string(const_cast<UFunction*>(function)->GetFullName());
+
+        std::scoped_lock lock(buffer.function_names_mutex);
+        buffer.function_names.emplace_back(function, std::move(name));
+    }
+
+    auto TraceRecorder::get_num_records() -> size_t
+    {
+        std::scoped_lock lock(m_buffers_mutex);
+        size_t num_records{};
+        for (const auto& buffer : m_buffers)
+        {
+            auto write_count = buffer->write_count.load(std::memory_order_acquire);
+            num_records += static_cast<size_t>(std::min<uint64_t>(write_count - buffer->cleared_count.load(), records_per_thread));
+        }
+        return num_records;
+    }
+
+    auto TraceRecorder::snapshot() -> std::vector<ThreadSnapshot>
+    {
+        std::scoped_lock lock(m_buffers_mutex);
+        std::vector<ThreadSnapshot> snapshots{};
+        for (const auto& buffer : m_buffers)
+        {
+            auto cleared_count = buffer->cleared_count.load();
+            auto end = buffer->write_count.load(std::memory_order_acquire);
+            auto begin = std::max(cleared_count, end > records_per_thread ? end - records_per_thread : 0);
+
+            // Copied as at most two contiguous ranges to keep the window in which the owning thread can lap us small
+            std::vector<TraceRecord> records(static_cast<size_t>(end - begin));
+            auto first_slot = static_cast<size_t>(begin % records_per_thread);
+            auto num_before_wrap = std::min(records.size(), records_per_thread - first_slot);
+            std::memcpy(records.data(), &buffer->records[first_slot], num_before_wrap * sizeof(TraceRecord));
+            std::memcpy(records.data() + num_before_wrap, &buffer->records[0], (records.size() - num_before_wrap) * sizeof(TraceRecord));
+
+            // The owning thread kept writing during the copy, anything it may have overwritten in the meantime is dropped
+            // One extra record is dropped for the slot that may have been mid-write
+            auto end_after_copy = buffer->write_count.load(std::memory_order_acquire);
+            if (end_after_copy + 1 > begin + records_per_thread)
+            {
+                auto num_overwritten = std::min<uint64_t>(end_after_copy + 1 - (begin + records_per_thread), records.size());
+                records.erase(records.begin(), records.begin() + static_cast<ptrdiff_t>(num_overwritten));
+            }
+
+            if (!records.empty())
+            {
+                snapshots.emplace_back(ThreadSnapshot{buffer->thread_id, std::move(records)});
+            }
+        }
+        return snapshots;
+    }
+
+    auto TraceRecorder::dump(const std::filesystem::path& path) -> void
+    {
+        auto snapshots = snapshot();
+
+        std::unordered_map<const UFunction*, std::string> function_names{};
+        for (const auto& thread_snapshot : snapshots)
+        {
+            for (const auto& record : thread_snapshot.records)
+            {
+                if (record.function)
+                {
+                    function_names.try_emplace(record.function);
+                }
+            }
+        }
+        {
+            // Buffers are only ever added, so the names of every thread are still around
+            std::scoped_lock lock(m_buffers_mutex);
+            for (const auto& buffer : m_buffers)
+            {
+                std::scoped_lock names_lock(buffer->function_names_mutex);
+                for (const auto& [function, name] : buffer->function_names)
+                {
+                    if (auto it = function_names.find(function); it != function_names.end() && it->second.empty())
+                    {
+                        it->second = name;
+                    }
+                }
+            }
+        }
+
+        std::filesystem::create_directories(path.parent_path());
+        std::ofstream stream{path, std::ios::binary | std::ios::trunc};
+        if (!stream)
+        {
+            throw std::runtime_error{"Could not open trace file for writing"};
+        }
+
+        TraceWriter writer{stream};
+        writer.write(trace_file_magic);
+        writer.write(trace_file_version);
+        writer.write(m_calibration.get_seconds_per_tick());
+
+        writer.write(static_cast<uint32_t>(EExprToken::EX_Max));
+        for (int opcode = 0; opcode < EExprToken::EX_Max; ++opcode)
+        {
+            writer.write_string<uint16_t>(expr_to_string(static_cast<EExprToken>(opcode)));
+        }
+
+        writer.write(static_cast<uint32_t>(function_names.size()));
+        for (const auto& [function, name] : function_names)
+        {
+            writer.write(static_cast<uint64_t>(reinterpret_cast<uintptr_t>(function)));
+            writer.write_string<uint32_t>(name);
+        }
+
+        writer.write(static_cast<uint32_t>(snapshots.size()));
+        for (const auto& thread_snapshot : snapshots)
+        {
+            writer.write(thread_snapshot.thread_id);
+            writer.write(static_cast<uint64_t>(thread_snapshot.records.size()));
+            writer.write_records(thread_snapshot.records);
+        }
+
+        if (!stream)
+        {
+            throw std::runtime_error{"Failed to write trace file"};
+        }
+    }
+} // namespace RC::GUI::KismetDebuggerMod
@@ -0,0 +1,291 @@
+#include <VMProfiler.hpp>
+
+#include <fstream>
+#include <stdexcept>
+
+#include <Helpers/String.hpp>
+#include <Unreal/FFrame.hpp>
+#include <Unreal/Script.hpp>
+#include <Unreal/UFunction.hpp>
+
+#include <glaze/glaze.hpp>
+
+#include <KismetDebugger.hpp>
+
+namespace glz
+{
+    template <>
+    struct meta<RC::GUI::KismetDebuggerMod::VMProfiler::OpcodeResult>
+    {
+        using T = RC::GUI::KismetDebuggerMod::VMProfiler::OpcodeResult;
+        static constexpr auto value = glz::object("opcode", &T::opcode, "count", &T::count, "total_ms", &T::total_ms);
+    };
+
+    template <>
+    struct meta<RC::GUI::KismetDebuggerMod::VMProfiler::FunctionResult>
+    {
+        using T = RC::GUI::KismetDebuggerMod::VMProfiler::FunctionResult;
+        static constexpr auto value =
+                glz::object("function", &T::function, "calls", &T::calls, "inclusive_ms", &T::inclusive_ms, "exclusive_ms", &T::exclusive_ms);
+    };
+
+    template <>
+    struct meta<RC::GUI::KismetDebuggerMod::VMProfiler::Results>
+    {
+        using T = RC::GUI::KismetDebuggerMod::VMProfiler::Results;
+        static constexpr auto value = glz::object("opcodes", &T::opcodes, "functions", &T::functions);
+    };
+} // namespace glz
+
+namespace RC::GUI::KismetDebuggerMod
+{
+    // Only the owning thread writes, so a plain load and store is enough and avoids a locked instruction per opcode
+    template <typename T>
+    static auto add_relaxed(std::atomic<T>& counter, T value) -> void
+    {
+        counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+    }
+
+    auto VMProfiler::start() -> void
+    {
+        m_calibration.start();
+        m_session.fetch_add(1, std::memory_order_relaxed);
+        m_is_profiling = true;
+    }
+
+    auto VMProfiler::stop() -> void
+    {
+        m_is_profiling = false;
+    }
+
+    auto VMProfiler::reset() -> void
+    {
+        m_baseline = collect_totals();
+    }
+
+    auto VMProfiler::get_thread_profile() -> ThreadProfile&
+    {
+        // Profiles are never freed because each thread caches a pointer to its own
+        thread_local ThreadProfile* profile = [this] {
+            std::scoped_lock lock(m_threads_mutex);
+            return m_threads.emplace_back(std::make_unique<ThreadProfile>()).get();
+        }();
+        return *profile;
+    }
+
+    auto VMProfiler::get_function_counters(ThreadProfile& profile, UFunction* function) -> FunctionCounters*
+    {
+        auto [it, inserted] = profile.functions.try_emplace(function);
+        if (inserted)
+        {
+            it->second = std::make_unique<FunctionCounters>();
+            it->second->name = to_string(function->GetFullName());
+            profile.pending_new_functions.emplace_back(it->second.get());
+        }
+        if (!profile.pending_new_functions.empty())
+        {
+            hand_off_new_functions(profile);
+        }
+        return it->second.get();
+    }
+
+    auto VMProfiler::hand_off_new_functions(ThreadProfile& profile) -> void
+    {
+        // Counters keep counting while they wait here, they're just not part of the results until the collecting thread receives them
+        auto& pending_new_functions = profile.pending_new_functions;
+        size_t num_handed_off{};
+        while (num_handed_off < pending_new_functions.size() && profile.new_functions.push(pending_new_functions[num_handed_off]))
+        {
+            ++num_handed_off;
+        }
+        pending_new_functions.erase(pending_new_functions.begin(), pending_new_functions.begin() + static_cast<ptrdiff_t>(num_handed_off));
+    }
+
+    auto VMProfiler::leave_frames(ThreadProfile& profile, size_t num_frames_to_keep, int64_t now) -> void
+    {
+        auto& frames = profile.frames;
+        while (frames.size() > num_frames_to_keep)
+        {
+            auto frame = frames.back();
+            frames.pop_back();
+
+            auto inclusive_ticks = now - frame.enter_ticks;
+            add_relaxed<uint64_t>(frame.counters->calls, 1);
+            add_relaxed<int64_t>(frame.counters->inclusive_ticks, inclusive_ticks);
+            add_relaxed<int64_t>(frame.counters->exclusive_ticks, inclusive_ticks - frame.child_ticks);
+            if (!frames.empty())
+            {
+                frames.back().child_ticks += inclusive_ticks;
+            }
+        }
+    }
+
+    auto VMProfiler::begin_opcode(const FFrame& stack, UFunction* function, size_t code_offset) -> int64_t
+    {
+        auto& profile = get_thread_profile();
+        auto& frames = profile.frames;
+        if (auto session = m_session.load(std::memory_order_relaxed); profile.session != session)
+        {
+            frames.clear();
+            profile.session = session;
+        }
+
+        auto now = read_timestamp();
+        auto is_same_frame = [&](const ActiveFrame& frame) {
+            return frame.frame == &stack && frame.function == function;
+        };
+
+        // Execution always starts at offset 0, anywhere else means the frame is already known
+        if (code_offset != 0)
+        {
+            if (!frames.empty() && is_same_frame(frames.back()))
+            {
+                return now;
+            }
+            for (size_t i = frames.size(); i > 0; --i)
+            {
+                if (is_same_frame(frames[i - 1]))
+                {
+                    // Frames above this one were left without their EX_Return being seen, e.g. execution was aborted
+                    leave_frames(profile, i, now);
+                    return now;
+                }
+            }
+        }
+
+        // New call, anything above the caller has already returned, if the caller isn't on the stack then this is a call from native code
+        auto caller = const_cast<FFrame&>(stack).PreviousFrame();
+        auto num_frames_to_keep = frames.size();
+        while (num_frames_to_keep > 0 && frames[num_frames_to_keep - 1].frame != caller)
+        {
+            --num_frames_to_keep;
+        }
+        leave_frames(profile, num_frames_to_keep, now);
+        auto counters = get_function_counters(profile, function);
+        // Timestamp taken again so that capturing the name on a function's first call isn't part of its time
+        frames.emplace_back(ActiveFrame{&stack, function, counters, read_timestamp(), 0});
+        return now;
+    }
+
+    auto VMProfiler::end_opcode(const FFrame& stack, uint8_t opcode, int64_t begin_ticks) -> void
+    {
+        auto now = read_timestamp();
+        auto& profile = get_thread_profile();
+        auto& counters = profile.opcodes[opcode];
+        add_relaxed<uint64_t>(counters.count, 1);
+        add_relaxed<int64_t>(counters.ticks, now - begin_ticks);
+
+        if (opcode == EX_Return)
+        {
+            auto& frames = profile.frames;
+            for (size_t i = frames.size(); i > 0; --i)
+            {
+                if (frames[i - 1].frame == &stack)
+                {
+                    leave_frames(profile, i - 1, now);
+                    break;
+                }
+            }
+        }
+    }
+
+    auto VMProfiler::collect_totals() -> std::unique_ptr<Totals>
+    {
+        auto totals = std::make_unique<Totals>();
+        std::scoped_lock lock(m_threads_mutex);
+        for (const auto& profile : m_threads)
+        {
+            for (size_t opcode = 0; opcode < profile->opcodes.size(); ++opcode)
+            {
+                add_relaxed(totals->opcodes[opcode].count, profile->opcodes[opcode].count.load(std::memory_order_relaxed));
+                add_relaxed(totals->opcodes[opcode].ticks, profile->opcodes[opcode].ticks.load(std::memory_order_relaxed));
+            }
+
+            profile->new_functions.drain([&](FunctionCounters* counters) {
+                profile->known_functions.emplace_back(counters);
+            });
+            for (const auto counters : profile->known_functions)
+            {
+                auto& total = totals->functions[counters->name];
+                total.calls += counters->calls.load(std::memory_order_relaxed);
+                total.inclusive_ticks += counters->inclusive_ticks.load(std::memory_order_relaxed);
+                total.exclusive_ticks += counters->exclusive_ticks.load(std::memory_order_relaxed);
+            }
+        }
+        return totals;
+    }
+
+    auto VMProfiler::collect() -> Results
+    {
+        auto totals = collect_totals();
+        auto ms_per_tick = m_calibration.get_seconds_per_tick() * 1000.0;
+
+        Results results{};
+        for (size_t opcode = 0; opcode < totals->opcodes.size(); ++opcode)
+        {
+            auto count = totals->opcodes[opcode].count.load(std::memory_order_relaxed) - m_baseline->opcodes[opcode].count.load(std::memory_order_relaxed);
+            if (count == 0)
+            {
+                continue;
+            }
+            auto ticks = totals->opcodes[opcode].ticks.load(std::memory_order_relaxed) - m_baseline->opcodes[opcode].ticks.load(std::memory_order_relaxed);
+            results.opcodes.emplace_back(OpcodeResult{expr_to_string(static_cast<EExprToken>(opcode)), count, static_cast<double>(ticks) * ms_per_tick});
+        }
+
+        for (const auto& [name, counters] : totals->functions)
+        {
+            auto calls = counters.calls;
+            auto inclusive_ticks = counters.inclusive_ticks;
+            auto exclusive_ticks = counters.exclusive_ticks;
+            if (auto it = m_baseline->functions.find(name); it != m_baseline->functions.end())
+            {
+                calls -= it->second.calls;
+                inclusive_ticks -= it->second.inclusive_ticks;
+                exclusive_ticks -= it->second.exclusive_ticks;
+            }
+            if (calls == 0)
+            {
+                continue;
+            }
+
+            results.functions.emplace_back(
+                    FunctionResult{std::string{name}, calls, static_cast<double>(inclusive_ticks) * ms_per_tick, static_cast<double>(exclusive_ticks) * ms_per_tick});
+        }
+        return results;
+    }
+
+    auto VMProfiler::export_json(const Results& results, const std::filesystem::path& path) -> void
+    {
+        std::filesystem::create_directories(path.parent_path());
+        if (auto ec = glz::write_file_json(results, path.string(), std::string{}); ec != glz::error_code::none)
+        {
+            throw std::runtime_error{"Failed to write profiler results"};
+        }
+    }
+
+    auto VMProfiler::export_csv(const Results& results, const std::filesystem::path& path) -> void
+    {
+        std::filesystem::create_directories(path.parent_path());
+        std::ofstream stream{path, std::ios::trunc};
+        if (!stream)
+        {
+            throw std::runtime_error{"Could not open profiler results for writing"};
+        }
+
+        // Names are quoted because full names can contain commas
+        stream << "kind,name,count,inclusive_ms,exclusive_ms\n";
+        for (const auto& opcode : results.opcodes)
+        {
+            stream << "opcode,\"" << opcode.opcode << "\"," << opcode.count << ',' << opcode.total_ms << ",\n";
+        }
+        for (const auto& function : results.functions)
+        {
+            stream << "function,\"" << function.function << "\"," << function.calls << ',' << function.inclusive_ms << ',' << function.exclusive_ms << '\n';
+        }
+
+        if (!stream)
+        {
+            throw std::runtime_error{"Failed to write profiler results"};
+        }
+    }
+} // namespace RC::GUI::KismetDebuggerMod
@@ -25,6 +25,11 @@ public:
     }
 
     ~KismetDebuggerMod() override = default;
+
+    auto on_update() -> void override
+    {
+        m_debugger.update();
+    }
 };
 
 #define KISMET_DEBUGGER_MOD_API __declspec(dllexport)
@@ -0,0 +1,71 @@
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <ResolvedBreakpoints.hpp>
+#include <TestHarness/TestHarness.hpp>
+
+using namespace RC::GUI::KismetDebuggerMod;
+using namespace RC::TestHarness;
+
+// Functions are never dereferenced by the lookup, fake addresses spaced like real UFunction allocations are enough
+static auto fake_function(size_t i) -> UFunction*
+{
+    return std::bit_cast<UFunction*>(uintptr_t{0x7ff6'0000'0000} + i * 0x130);
+}
+
+struct Lookup
+{
+    UFunction* fn;
+    size_t index;
+};
+
+// Cost of the checks the script hook makes for every executed instruction, with the same loads as
+// BreakpointStore::has_any_breakpoints and BreakpointStore::has_breakpoint
+int main()
+{
+    constexpr size_t num_functions = 1000;
+    constexpr size_t num_iterations = 1'000'000;
+
+    // Instructions of a mix of functions, most of them without breakpoints
+    std::vector<Lookup> lookups{};
+    for (size_t i = 0; i < 1024; ++i)
+    {
+        lookups.emplace_back(Lookup{fake_function((i * 7919) % (num_functions * 4)), (i * 31) % 512});
+    }
+
+    for (const size_t num_breakpoints : {0, 10, 1000})
+    {
+        // One breakpoint per function, spread over the script
+        ResolvedBreakpoints::BitsByFunction bits_by_function{};
+        for (size_t i = 0; i < num_breakpoints; ++i)
+        {
+            ResolvedBreakpoints::set(bits_by_function, fake_function(i * num_functions / num_breakpoints), (i * 37) % 512);
+        }
+        ResolvedBreakpoints table{bits_by_function};
+        std::atomic<const ResolvedBreakpoints*> resolved{&table};
+        std::atomic<size_t> num_armed_breakpoints{num_breakpoints};
+
+        size_t next_lookup{};
+        auto name = std::to_string(num_breakpoints) + " breakpoints";
+        benchmark("has_any_breakpoints, " + name, num_iterations, [&] {
+            do_not_optimize(num_armed_breakpoints.load(std::memory_order_relaxed) != 0);
+        });
+        benchmark("has_breakpoint, " + name, num_iterations, [&] {
+            const auto& lookup = lookups[next_lookup++ & 1023];
+            do_not_optimize(resolved.load(std::memory_order_acquire)->test(lookup.fn, lookup.index));
+        });
+
+        // Every breakpoint is found and nothing else is
+        for (size_t i = 0; i < num_breakpoints; ++i)
+        {
+            CHECK(table.test(fake_function(i * num_functions / num_breakpoints), (i * 37) % 512));
+            CHECK(!table.test(fake_function(i * num_functions / num_breakpoints), (i * 37 + 1) % 512));
+        }
+        CHECK(!table.test(fake_function(num_functions * 4), 0));
+    }
+
+    return report();
+}
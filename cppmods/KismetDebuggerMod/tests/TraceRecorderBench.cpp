@@ -0,0 +1,67 @@
+#include <bit>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include <TraceRecorder.hpp>
+#include <TestHarness/TestHarness.hpp>
+
+using namespace RC::GUI::KismetDebuggerMod;
+using namespace RC::TestHarness;
+
+static size_t num_named_functions{};
+
+// TraceRecorder.cpp needs the engine to name functions, the two functions 'record' calls out to are defined here instead
+namespace RC::GUI::KismetDebuggerMod
+{
+    auto TraceRecorder::register_thread() -> ThreadBuffer*
+    {
+        std::scoped_lock lock(m_buffers_mutex);
+        return m_buffers.emplace_back(std::make_unique<ThreadBuffer>()).get();
+    }
+
+    auto TraceRecorder::name_function(ThreadBuffer& buffer, const UFunction* function) -> void
+    {
+        ++num_named_functions;
+        buffer.named_functions.emplace(function);
+        std::scoped_lock lock(buffer.function_names_mutex);
+        buffer.function_names.emplace_back(function, "Function " + std::to_string(std::bit_cast<uintptr_t>(function)));
+    }
+} // namespace RC::GUI::KismetDebuggerMod
+
+// Functions are never dereferenced while recording, fake addresses spaced like real UFunction allocations are enough
+static auto fake_function(size_t i) -> const UFunction*
+{
+    return std::bit_cast<const UFunction*>(uintptr_t{0x7ff6'0000'0000} + i * 0x130);
+}
+
+// Cost the script hook adds to every executed opcode while a trace is being recorded
+int main()
+{
+    constexpr size_t num_iterations = 1'000'000;
+    constexpr size_t num_functions = 64;
+    // Roughly the number of opcodes a small blueprint function runs before calling into another one
+    constexpr size_t opcodes_per_call = 16;
+    TraceRecorder recorder{};
+
+    benchmark("read_timestamp", num_iterations, [] {
+        do_not_optimize(read_timestamp());
+    });
+
+    uint32_t code_offset{};
+    benchmark("TraceRecorder::record, one function", num_iterations, [&] {
+        recorder.record(fake_function(0), code_offset++, 0x0B);
+    });
+
+    size_t opcode_index{};
+    benchmark("TraceRecorder::record, 64 functions", num_iterations, [&] {
+        auto function = fake_function(1 + (opcode_index++ / opcodes_per_call) % num_functions);
+        recorder.record(function, code_offset++, 0x0B);
+    });
+
+    // Every function is named once no matter how often execution comes back to it
+    CHECK(num_named_functions == 1 + num_functions);
+
+    return report();
+}
@@ -0,0 +1,89 @@
+#!/usr/bin/env python3
+"""Pretty-prints a .ktrace file written by the KismetDebugger trace recorder.
+
+Usage: print_trace.py <file.ktrace> [--thread ID] [--function SUBSTRING] [--last N]
+"""
+
+import argparse
+import struct
+import sys
+
+MAGIC = 0x4352544B  # 'KTRC'
+VERSION = 1
+RECORD = struct.Struct("<QqIB3x")
+
+
+class Reader:
+    def __init__(self, data):
+        self.data = data
+        self.offset = 0
+
+    def read(self, fmt):
+        values = struct.unpack_from("<" + fmt, self.data, self.offset)
+        self.offset += struct.calcsize("<" + fmt)
+        return values if len(values) > 1 else values[0]
+
+    def read_string(self, length_fmt):
+        length = self.read(length_fmt)
+        string = self.data[self.offset:self.offset + length].decode("utf-8", errors="replace")
+        self.offset += length
+        return string
+
+
+def load(path):
+    with open(path, "rb") as file:
+        reader = Reader(file.read())
+
+    magic, version, seconds_per_tick = reader.read("IId")
+    if magic != MAGIC:
+        sys.exit(f"{path} is not a KismetDebugger trace")
+    if version != VERSION:
+        sys.exit(f"{path} has unsupported version {version}")
+
+    opcodes = [reader.read_string("H") for _ in range(reader.read("I"))]
+
+    functions = {}
+    for _ in range(reader.read("I")):
+        address = reader.read("Q")
+        functions[address] = reader.read_string("I")
+
+    threads = []
+    for _ in range(reader.read("I")):
+        thread_id, num_records = reader.read("QQ")
+        records = [RECORD.unpack_from(reader.data, reader.offset + i * RECORD.size) for i in range(num_records)]
+        reader.offset += num_records * RECORD.size
+        threads.append((thread_id, records))
+
+    return seconds_per_tick, opcodes, functions, threads
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Pretty-prints a KismetDebugger .ktrace file")
+    parser.add_argument("trace")
+    parser.add_argument("--thread", type=int, help="only print records from this thread id")
+    parser.add_argument("--function", help="only print records from functions whose full name contains this")
+    parser.add_argument("--last", type=int, help="only print the newest N records of each thread")
+    args = parser.parse_args()
+
+    seconds_per_tick, opcodes, functions, threads = load(args.trace)
+    for thread_id, records in threads:
+        if args.thread is not None and thread_id != args.thread:
+            continue
+        if args.last is not None:
+            records = records[-args.last:]
+        if not records:
+            continue
+
+        print(f"thread {thread_id}: {len(records)} records")
+        start = records[0][1]
+        for function, timestamp, code_offset, opcode in records:
+            name = functions.get(function, f"0x{function:016X}")
+            if args.function and args.function not in name:
+                continue
+            opcode_name = opcodes[opcode] if opcode < len(opcodes) else f"0x{opcode:02X}"
+            elapsed_us = (timestamp - start) * seconds_per_tick * 1e6
+            print(f"  +{elapsed_us:12.3f}us  {code_offset:6}  {opcode_name:<32} {name}")
+
+
+if __name__ == "__main__":
+    main()
@@ -3,4 +3,4 @@ local projectName = "KismetDebuggerMod"
 target(projectName)
     add_rules("ue4ss.mod")
 	add_includedirs("include")
-	add_files("src/dllmain.cpp", "src/KismetDebugger.cpp")
\ No newline at end of file
+	add_files("src/dllmain.cpp", "src/FunctionIndex.cpp", "src/KismetDebugger.cpp", "src/TraceRecorder.cpp", "src/VMProfiler.cpp")
\ No newline at end of file
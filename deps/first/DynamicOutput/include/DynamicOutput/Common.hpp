@@ -1,5 +1,12 @@
 #pragma once
 
+// Only Windows builds export and import symbols
+#ifndef _WIN32
+#ifndef RC_DYNOUT_API
+#define RC_DYNOUT_API
+#endif
+#endif
+
 #ifndef RC_DYNAMIC_OUTPUT_EXPORTS
 #ifndef RC_DYNAMIC_OUTPUT_BUILD_STATIC
 #ifndef RC_DYNOUT_API
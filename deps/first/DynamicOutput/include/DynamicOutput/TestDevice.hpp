@@ -1,6 +1,8 @@
 #ifndef UE4SS_REWRITTEN_TESTDEVICE_HPP
 #define UE4SS_REWRITTEN_TESTDEVICE_HPP
 
+#include <cstdio>
+
 #include <DynamicOutput/Macros.hpp>
 #include <DynamicOutput/OutputDevice.hpp>
 
@@ -49,23 +51,23 @@ namespace RC::Output
             switch (typed_optional_arg)
             {
             case OptionalArgTest::ValueDefault:
-                printf_s("Optional Arg: ValueDefault - ");
+                std::printf("Optional Arg: ValueDefault - ");
                 break;
             case OptionalArgTest::ValueOne:
-                printf_s("Optional Arg: ValueOne - ");
+                std::printf("Optional Arg: ValueOne - ");
                 break;
             case OptionalArgTest::ValueTwo:
-                printf_s("Optional Arg: ValueTwo - ");
+                std::printf("Optional Arg: ValueTwo - ");
                 break;
             case OptionalArgTest::ValueThree:
-                printf_s("Optional Arg: ValueThree - ");
+                std::printf("Optional Arg: ValueThree - ");
                 break;
             }
 
 #if ENABLE_OUTPUT_DEVICE_DEBUG_MODE
-            printf_s("TestDevice received: %S", fmt.c_str());
+            std::printf("TestDevice received: %.*ls", static_cast<int>(fmt.size()), FromCharTypePtr<wchar_t>(fmt.data()));
 #else
-            printf_s("%S", FromCharTypePtr<wchar_t>(fmt.data()));
+            std::printf("%.*ls", static_cast<int>(fmt.size()), FromCharTypePtr<wchar_t>(fmt.data()));
 #endif
         }
     };
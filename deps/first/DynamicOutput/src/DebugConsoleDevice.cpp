@@ -1,14 +1,17 @@
 #include <chrono>
+#include <cstdio>
 #include <locale>
 
 #include <DynamicOutput/DebugConsoleDevice.hpp>
 #include <DynamicOutput/Output.hpp>
 
+#ifdef _WIN32
 #define NOMINMAX
 #include <Windows.h>
 #ifdef TEXT
 #undef TEXT
 #endif
+#endif
 
 namespace RC::Output
 {
@@ -42,6 +45,7 @@ namespace RC::Output
         {
             return;
         }
+#ifdef _WIN32
         HANDLE current_console_out_handle = GetStdHandle(STD_OUTPUT_HANDLE);
         if (current_console_out_handle != INVALID_HANDLE_VALUE)
         {
@@ -49,6 +53,7 @@ namespace RC::Output
             GetConsoleMode(current_console_out_handle, &current_console_out_mode);
             SetConsoleMode(current_console_out_handle, current_console_out_mode | ENABLE_VIRTUAL_TERMINAL_PROCESSING);
         }
+#endif
         m_windows_console_mode_set = true;
     }
 
@@ -67,9 +72,17 @@ namespace RC::Output
         set_windows_console_out_mode_if_needed();
 
 #if ENABLE_OUTPUT_DEVICE_DEBUG_MODE
+#ifdef _WIN32
         printf_s("DebugConsoleDevice received: %S", m_formatter(fmt).c_str());
 #else
+        printf("DebugConsoleDevice received: %ls", m_formatter(fmt).c_str());
+#endif
+#else
+#ifdef _WIN32
         printf_s("%s%S\033[0m", log_level_to_color(static_cast<Color::Color>(optional_arg)).c_str(), m_formatter(fmt).c_str());
+#else
+        printf("%s%ls\033[0m", log_level_to_color(static_cast<Color::Color>(optional_arg)).c_str(), m_formatter(fmt).c_str());
+#endif
 #endif
     }
 } // namespace RC::Output
@@ -28,6 +28,16 @@ namespace RC::File
         No,
     };
 
+    // Encoding of a file as detected from its byte order mark
+    // Unknown means there was no byte order mark
+    enum class Encoding
+    {
+        Unknown,
+        UTF8,
+        UTF16LE,
+        UTF16BE,
+    };
+
     enum class GenericDataType
     {
         UnsignedLong,
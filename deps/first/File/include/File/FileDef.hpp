@@ -5,13 +5,18 @@ namespace RC::File
 #ifndef RC_DETECTED_OS
 #ifdef _WIN32
 #define RC_DETECTED_OS _WIN32
+#elif defined(__unix__) || defined(__APPLE__)
+#define RC_DETECTED_OS RC_DETECTED_OS_POSIX
+#define RC_DETECTED_OS_POSIX 2
 #else
     static_assert(false, "Could not setup the 'Handle' typedef because a supported OS was not detected.");
 #endif
 #endif
 
-#if RC_DETECTED_OS == _WIN32
 #ifndef RC_OS_FILE_TYPE_INCLUDE_FILE
+#if defined(RC_DETECTED_OS_POSIX) && RC_DETECTED_OS == RC_DETECTED_OS_POSIX
+#define RC_OS_FILE_TYPE_INCLUDE_FILE <File/FileType/PosixFile.hpp>
+#elif RC_DETECTED_OS == _WIN32
 #define RC_OS_FILE_TYPE_INCLUDE_FILE <File/FileType/WinFile.hpp>
 #else
     static_assert(false, "Could not setup the 'RC_OS_FILE_TYPE_INCLUDE_FILE' macro because a supported OS was not detected.");
@@ -1,3 +1,7 @@
 #pragma once
 
+#ifdef _WIN32
 #include <File/FileType/WinFile.hpp>
+#else
+#include <File/FileType/PosixFile.hpp>
+#endif
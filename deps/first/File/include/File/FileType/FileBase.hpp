@@ -4,6 +4,7 @@
 #include <type_traits>
 
 #include <File/Enums.hpp>
+#include <File/FileView.hpp>
 #include <File/InternalFile.hpp>
 #include <File/Macros.hpp>
 
@@ -76,6 +77,15 @@ namespace RC::File
         // Throws std::runtime_error if an error occurred
         virtual auto write_string_to_file(StringViewType) -> void = 0;
 
+        // Sets how many bytes of converted output are kept in memory before being written to the file
+        // 0 disables buffering and every call to 'write_string_to_file' writes immediately, this is the default
+        // Throws std::runtime_error if an error occurred while flushing the previous buffer
+        virtual auto set_write_buffer_size(size_t size) -> void = 0;
+
+        // Writes any buffered output to the file, the buffer is also flushed when the file is closed
+        // Throws std::runtime_error if an error occurred
+        virtual auto flush() -> void = 0;
+
         // Returns whether the currently opened file is the same as another opened file
         // Throws std::runtime_error if an error occurred
         virtual auto is_same_as(InternalFileType& other_file) -> bool = 0;
@@ -84,6 +94,13 @@ namespace RC::File
         // Throws std::runtime_error if an error occurred
         virtual auto read_all() const -> StringType = 0;
 
+        // Maps the entire file read-only and returns a view of it, nothing is copied or decoded
+        // Empty files return an empty view
+        // Throws std::runtime_error if an error occurred
+        virtual auto read_all_view() const -> FileView = 0;
+
+        // Maps the entire file into memory, the returned span stays valid until the file is closed
+        // Throws std::runtime_error if an error occurred
         virtual auto memory_map() -> std::span<uint8_t> = 0;
 
         /*
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+
+#include <File/Common.hpp>
+#include <File/FileType/FileBase.hpp>
+#include <File/Macros.hpp>
+
+namespace RC::File
+{
+    // POSIX implementation of the file interface, built on open/pread/pwrite/mmap
+    // Behaves like WinFile so that code using File::Handle doesn't need to know which backend it's running on
+    class PosixFile : public FileInterface<PosixFile>
+    {
+      private:
+        constexpr static int invalid_file = -1;
+
+        struct IdentifyingProperties
+        {
+            unsigned long long device{};
+            unsigned long long inode{};
+            unsigned long long last_write_time_seconds{};
+            unsigned long long last_write_time_nanoseconds{};
+            unsigned long long file_size{};
+        };
+
+      private:
+        int m_file{invalid_file};
+        uint8_t* m_memory_map{};
+        size_t m_memory_map_size{};
+        OpenProperties m_open_properties{};
+        std::filesystem::path m_file_path_and_name{};
+        std::filesystem::path m_serialization_file_path_and_name{};
+        IdentifyingProperties m_identifying_properties{};
+        constexpr static inline size_t cache_size = 0x500;
+        unsigned char m_cache[cache_size]{};
+        size_t m_offset_to_next_serialized_item{};
+        // UTF-8 output waiting to be written, only used when 'm_write_buffer_size' isn't 0
+        std::string m_write_buffer{};
+        size_t m_write_buffer_size{};
+        // Offset used by pwrite, appending files use write instead because O_APPEND ignores the offset
+        int64_t m_write_offset{};
+        bool m_has_cache_in_memory{};
+        bool m_has_cached_identifying_properties{};
+        bool m_is_file_open{};
+
+      public:
+        ~PosixFile() override = default;
+
+      private:
+        auto static create_all_directories(const std::filesystem::path& file_name_and_path) -> void;
+
+      private:
+        auto close_file() -> void;
+        auto write_bytes(const void* data, size_t num_bytes_to_write) -> void;
+        auto get_live_identifying_properties() const -> IdentifyingProperties;
+
+      public:
+        [[nodiscard]] auto is_file_open() const -> bool;
+
+      public:
+        RC_FILE_API auto set_file(int new_file) -> void;
+        RC_FILE_API auto set_is_file_open(bool new_is_open) -> void;
+        RC_FILE_API auto get_file() -> int;
+        RC_FILE_API auto serialization_file_exists() -> bool;
+
+        // File Interface -> START
+        RC_FILE_API auto is_valid() noexcept -> bool override;
+        RC_FILE_API auto invalidate_file() noexcept -> void override;
+        RC_FILE_API auto static delete_file(const std::filesystem::path&) -> void;
+        RC_FILE_API auto delete_file() -> void override;
+        RC_FILE_API auto get_raw_handle() noexcept -> void* override;
+        [[nodiscard]] RC_FILE_API auto get_file_path() const noexcept -> const std::filesystem::path& override;
+        RC_FILE_API auto set_serialization_output_file(const std::filesystem::path& output_file) noexcept -> void override;
+        RC_FILE_API auto serialize_identifying_properties() -> void override;
+        RC_FILE_API auto deserialize_identifying_properties() -> void override;
+        RC_FILE_API auto is_deserialized_and_live_equal() -> bool override;
+        RC_FILE_API auto invalidate_serialization() -> void override;
+        RC_FILE_API auto serialize_item(const GenericItemData& data, bool is_internal_item = false) -> void override;
+        RC_FILE_API auto get_serialized_item(size_t data_size, bool is_internal_item = false) -> void* override;
+        RC_FILE_API auto close_current_file() -> void override;
+        RC_FILE_API auto write_string_to_file(StringViewType string_to_write) -> void override;
+        RC_FILE_API auto set_write_buffer_size(size_t size) -> void override;
+        RC_FILE_API auto flush() -> void override;
+        RC_FILE_API auto is_same_as(PosixFile& other_file) -> bool override;
+        [[nodiscard]] RC_FILE_API auto read_all() const -> StringType override;
+        [[nodiscard]] RC_FILE_API auto read_all_view() const -> FileView override;
+        [[nodiscard]] RC_FILE_API auto memory_map() -> std::span<uint8_t> override;
+        [[nodiscard]] RC_FILE_API auto static open_file(const std::filesystem::path& file_name_and_path, const OpenProperties& open_properties) -> PosixFile;
+        // File Interface -> END
+    };
+
+    // This file is automatically included ONLY if a POSIX system is detected
+    // Therefore, it's not necessary to do any checks here
+    template <ImplementsFileInterface UnderlyingAbstraction>
+    class HandleTemplate;
+    using Handle = HandleTemplate<PosixFile>;
+} // namespace RC::File
@@ -2,6 +2,7 @@
 
 #include <filesystem>
 #include <format>
+#include <string>
 
 #include <File/Common.hpp>
 #include <File/FileType/FileBase.hpp>
@@ -38,6 +39,9 @@ namespace RC::File
         constexpr static inline size_t cache_size = 0x500;
         unsigned char m_cache[cache_size]{};
         size_t m_offset_to_next_serialized_item{};
+        // UTF-8 output waiting to be written, only used when 'm_write_buffer_size' isn't 0
+        std::string m_write_buffer{};
+        size_t m_write_buffer_size{};
         bool m_has_cache_in_memory{};
         bool m_has_cached_identifying_properties{};
         bool m_is_file_open{};
@@ -76,8 +80,11 @@ namespace RC::File
         RC_FILE_API auto get_serialized_item(size_t data_size, bool is_internal_item = false) -> void* override;
         RC_FILE_API auto close_current_file() -> void override;
         RC_FILE_API auto write_string_to_file(StringViewType string_to_write) -> void override;
+        RC_FILE_API auto set_write_buffer_size(size_t size) -> void override;
+        RC_FILE_API auto flush() -> void override;
         RC_FILE_API auto is_same_as(WinFile& other_file) -> bool override;
         [[nodiscard]] RC_FILE_API auto read_all() const -> StringType override;
+        [[nodiscard]] RC_FILE_API auto read_all_view() const -> FileView override;
         [[nodiscard]] RC_FILE_API auto memory_map() -> std::span<uint8_t> override;
         [[nodiscard]] RC_FILE_API auto static open_file(const std::filesystem::path& file_name_and_path, const OpenProperties& open_properties) -> WinFile;
         // File Interface -> END
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string_view>
+
+#include <File/Common.hpp>
+#include <File/Enums.hpp>
+#include <File/Macros.hpp>
+
+namespace RC::File
+{
+    // Read-only view of an entire file that's been mapped into memory
+    // The byte order mark is detected and stripped when the view is created
+    // The mapping is released when the view is destroyed, text returned by 'as_native_text' or 'get_text' must not outlive the view
+    class FileView
+    {
+      private:
+        const uint8_t* m_mapping{};
+        size_t m_mapping_size{};
+        std::span<const uint8_t> m_data{};
+        Encoding m_encoding{Encoding::Unknown};
+
+      public:
+        FileView() = default;
+        // Takes ownership of a mapping created by the platform file backend
+        RC_FILE_API FileView(const uint8_t* mapping, size_t mapping_size);
+        FileView(const FileView&) = delete;
+        auto operator=(const FileView&) -> FileView& = delete;
+        RC_FILE_API FileView(FileView&&) noexcept;
+        RC_FILE_API auto operator=(FileView&&) noexcept -> FileView&;
+        RC_FILE_API ~FileView();
+
+      public:
+        auto get_encoding() const -> Encoding
+        {
+            return m_encoding;
+        }
+
+        // The contents of the file without the byte order mark
+        auto get_bytes() const -> std::span<const uint8_t>
+        {
+            return m_data;
+        }
+
+        auto empty() const -> bool
+        {
+            return m_data.empty();
+        }
+
+        // Returns the contents as text without copying
+        // Only possible when the file is stored in the native encoding of CharType, otherwise returns an empty optional
+        RC_FILE_API auto as_native_text() const -> std::optional<StringViewType>;
+
+        // Returns the contents as UTF-8 without copying, for parsers that can read UTF-8 directly
+        // Only possible for files without a UTF-16 byte order mark whose contents are valid UTF-8, otherwise returns an empty optional
+        RC_FILE_API auto as_utf8_text() const -> std::optional<std::string_view>;
+
+        // Returns the contents as text, the text is only decoded into 'storage' if it can't be viewed directly
+        RC_FILE_API auto get_text(StringType& storage) const -> StringViewType;
+
+        // Returns a decoded copy of the contents
+        // UTF-16 and valid UTF-8 are decoded, anything else is widened one byte per character like 'read_all' used to do for every file
+        RC_FILE_API auto to_string() const -> StringType;
+
+      private:
+        auto release() noexcept -> void;
+
+        // Implemented by the platform file backend because it's the backend that created the mapping
+        auto static unmap(const uint8_t* mapping, size_t mapping_size) noexcept -> void;
+    };
+
+    // Rejects overlong encodings, surrogates and code points above U+10FFFF like the UTF-8 spec does
+    RC_FILE_API auto is_valid_utf8(std::string_view input) -> bool;
+
+    // Decodes valid UTF-8 into 'output' and returns the end of the decoded text, 'output' needs room for 'input.size()' characters
+    // Code points above U+FFFF become surrogate pairs when CharType is 16 bits
+    RC_FILE_API auto decode_utf8(std::string_view input, CharType* output) -> CharType*;
+} // namespace RC::File
@@ -4,6 +4,7 @@
 #include <memory>
 #include <span>
 #include <string>
+#include <type_traits>
 
 #include <File/Common.hpp>
 #include <File/Enums.hpp>
@@ -52,7 +53,14 @@ namespace RC::File
         }
         ~HandleTemplate()
         {
-            close();
+            // Destructors can't throw, the file is closed either way and 'close' should be called explicitly where errors matter
+            try
+            {
+                close();
+            }
+            catch (...)
+            {
+            }
         }
 
       public:
@@ -109,43 +117,26 @@ namespace RC::File
         template <typename SerializedDataType>
         auto serialize_item(SerializedDataType data) -> void
         {
-            throw std::runtime_error{"not reached"};
-        }
-
-        template <>
-        auto serialize_item(unsigned long data) -> void
-        {
-            m_internal_handle.serialize_item({.data_type = GenericDataType::UnsignedLong, .data_ulong = data}, false);
-        }
-
-        template <>
-        auto serialize_item(signed long data) -> void
-        {
-            m_internal_handle.serialize_item({.data_type = GenericDataType::SignedLong, .data_long = data}, false);
-        }
-
-        template <>
-        auto serialize_item(unsigned long long data) -> void
-        {
-            m_internal_handle.serialize_item({.data_type = GenericDataType::UnsignedLongLong, .data_ulonglong = data}, false);
-        }
-
-        template <>
-        auto serialize_item(signed long long data) -> void
-        {
-            m_internal_handle.serialize_item({.data_type = GenericDataType::SignedLongLong, .data_longlong = data}, false);
-        }
-
-        template <>
-        auto serialize_item(unsigned int data) -> void
-        {
-            serialize_item<unsigned long>(data);
-        }
-
-        template <>
-        auto serialize_item(signed int data) -> void
-        {
-            serialize_item<signed long>(data);
+            if constexpr (std::is_same_v<SerializedDataType, unsigned long> || std::is_same_v<SerializedDataType, unsigned int>)
+            {
+                m_internal_handle.serialize_item({.data_type = GenericDataType::UnsignedLong, .data_ulong = data}, false);
+            }
+            else if constexpr (std::is_same_v<SerializedDataType, signed long> || std::is_same_v<SerializedDataType, signed int>)
+            {
+                m_internal_handle.serialize_item({.data_type = GenericDataType::SignedLong, .data_long = data}, false);
+            }
+            else if constexpr (std::is_same_v<SerializedDataType, unsigned long long>)
+            {
+                m_internal_handle.serialize_item({.data_type = GenericDataType::UnsignedLongLong, .data_ulonglong = data}, false);
+            }
+            else if constexpr (std::is_same_v<SerializedDataType, signed long long>)
+            {
+                m_internal_handle.serialize_item({.data_type = GenericDataType::SignedLongLong, .data_longlong = data}, false);
+            }
+            else
+            {
+                static_assert(!sizeof(SerializedDataType), "Unsupported type for 'serialize_item'");
+            }
         }
 
         template <typename SerializedDataType>
@@ -164,11 +155,26 @@ namespace RC::File
             m_internal_handle.write_string_to_file(string_to_write);
         }
 
+        auto set_write_buffer_size(size_t size) -> void
+        {
+            m_internal_handle.set_write_buffer_size(size);
+        }
+
+        auto flush() -> void
+        {
+            m_internal_handle.flush();
+        }
+
         [[nodiscard]] auto read_all() const -> StringType
         {
             return m_internal_handle.read_all();
         }
 
+        [[nodiscard]] auto read_all_view() const -> FileView
+        {
+            return m_internal_handle.read_all_view();
+        }
+
         [[nodiscard]] auto memory_map() -> std::span<uint8_t>
         {
             return m_internal_handle.memory_map();
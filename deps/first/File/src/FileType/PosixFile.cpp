@@ -0,0 +1,624 @@
+#include <cerrno>
+#include <cstring>
+#include <exception>
+
+#include <File/File.hpp>
+#include <File/FileType/PosixFile.hpp>
+#include <File/HandleTemplate.hpp>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <Helpers/String.hpp>
+#include <Helpers/SysError.hpp>
+#include <fmt/core.h>
+
+namespace RC::File
+{
+    // Encodes to UTF-8 the same way WideCharToMultiByte does for WinFile, unpaired surrogates become U+FFFD
+    static auto append_as_utf8(std::string& output, StringViewType input) -> void
+    {
+        // Written through a pointer into space for the longest possible encoding, then trimmed, so that each character costs a store instead of a push_back
+        const auto previous_size = output.size();
+        output.resize(previous_size + input.size() * 4);
+        auto out = output.data() + previous_size;
+
+        for (size_t i = 0; i < input.size(); ++i)
+        {
+            auto code_point = static_cast<uint32_t>(input[i]);
+            if (code_point < 0x80)
+            {
+                *out++ = static_cast<char>(code_point);
+                continue;
+            }
+            if (code_point >= 0xD800 && code_point <= 0xDBFF && i + 1 < input.size())
+            {
+                const auto low_surrogate = static_cast<uint32_t>(input[i + 1]);
+                if (low_surrogate >= 0xDC00 && low_surrogate <= 0xDFFF)
+                {
+                    code_point = 0x10000 + ((code_point - 0xD800) << 10) + (low_surrogate - 0xDC00);
+                    ++i;
+                }
+            }
+            if ((code_point >= 0xD800 && code_point <= 0xDFFF) || code_point > 0x10FFFF)
+            {
+                code_point = 0xFFFD;
+            }
+
+            if (code_point < 0x800)
+            {
+                *out++ = static_cast<char>(0xC0 | (code_point >> 6));
+                *out++ = static_cast<char>(0x80 | (code_point & 0x3F));
+            }
+            else if (code_point < 0x10000)
+            {
+                *out++ = static_cast<char>(0xE0 | (code_point >> 12));
+                *out++ = static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+                *out++ = static_cast<char>(0x80 | (code_point & 0x3F));
+            }
+            else
+            {
+                *out++ = static_cast<char>(0xF0 | (code_point >> 18));
+                *out++ = static_cast<char>(0x80 | ((code_point >> 12) & 0x3F));
+                *out++ = static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+                *out++ = static_cast<char>(0x80 | (code_point & 0x3F));
+            }
+        }
+
+        output.resize(static_cast<size_t>(out - output.data()));
+    }
+
+    auto PosixFile::is_valid() noexcept -> bool
+    {
+        return m_file != invalid_file;
+    }
+
+    auto PosixFile::invalidate_file() noexcept -> void
+    {
+        m_file = invalid_file;
+        m_memory_map = nullptr;
+        m_memory_map_size = 0;
+    }
+
+    auto PosixFile::delete_file(const std::filesystem::path& file_path_and_name) -> void
+    {
+        if (unlink(file_path_and_name.c_str()) != 0)
+        {
+            THROW_INTERNAL_FILE_ERROR(fmt::format("[PosixFile::delete_file] Was unable to delete file, error: {}", to_string(SysError(errno)).c_str()))
+        }
+    }
+
+    auto PosixFile::delete_file() -> void
+    {
+        if (m_is_file_open)
+        {
+            close_file();
+        }
+
+        delete_file(m_file_path_and_name);
+    }
+
+    auto PosixFile::set_file(int new_file) -> void
+    {
+        m_file = new_file;
+    }
+
+    auto PosixFile::get_file() -> int
+    {
+        return m_file;
+    }
+
+    auto PosixFile::set_is_file_open(bool new_is_open) -> void
+    {
+        m_is_file_open = new_is_open;
+    }
+
+    auto PosixFile::get_raw_handle() noexcept -> void*
+    {
+        return reinterpret_cast<void*>(static_cast<intptr_t>(m_file));
+    }
+
+    auto PosixFile::get_file_path() const noexcept -> const std::filesystem::path&
+    {
+        return m_file_path_and_name;
+    }
+
+    auto PosixFile::set_serialization_output_file(const std::filesystem::path& output_file) noexcept -> void
+    {
+        m_serialization_file_path_and_name = output_file;
+    }
+
+    auto PosixFile::serialization_file_exists() -> bool
+    {
+        return std::filesystem::exists(m_serialization_file_path_and_name);
+    }
+
+    auto PosixFile::write_bytes(const void* data, size_t num_bytes_to_write) -> void
+    {
+        if (!is_file_open())
+        {
+            THROW_INTERNAL_FILE_ERROR("[PosixFile::write_bytes] Tried writing to file but the file is not open")
+        }
+
+        const auto is_appending = m_open_properties.open_for == OpenFor::Appending;
+        auto bytes = static_cast<const char*>(data);
+        while (num_bytes_to_write > 0)
+        {
+            const auto bytes_written = is_appending ? write(m_file, bytes, num_bytes_to_write) : pwrite(m_file, bytes, num_bytes_to_write, m_write_offset);
+            if (bytes_written < 0)
+            {
+                if (errno == EINTR)
+                {
+                    continue;
+                }
+                THROW_INTERNAL_FILE_ERROR(fmt::format("[PosixFile::write_bytes] Tried writing to file but was unable to complete operation. error: {}",
+                                                      to_string(SysError(errno)).c_str()))
+            }
+
+            bytes += bytes_written;
+            num_bytes_to_write -= static_cast<size_t>(bytes_written);
+            m_write_offset += bytes_written;
+        }
+    }
+
+    auto PosixFile::get_live_identifying_properties() const -> IdentifyingProperties
+    {
+        struct stat file_info{};
+        if (fstat(m_file, &file_info) != 0)
+        {
+            THROW_INTERNAL_FILE_ERROR(fmt::format("[PosixFile::get_live_identifying_properties] Tried retrieving file information. error: {}",
+                                                  to_string(SysError(errno)).c_str()))
+        }
+
+#ifdef __APPLE__
+        const auto& last_write_time = file_info.st_mtimespec;
+#else
+        const auto& last_write_time = file_info.st_mtim;
+#endif
+
+        return IdentifyingProperties{
+                .device = static_cast<unsigned long long>(file_info.st_dev),
+                .inode = static_cast<unsigned long long>(file_info.st_ino),
+                .last_write_time_seconds = static_cast<unsigned long long>(last_write_time.tv_sec),
+                .last_write_time_nanoseconds = static_cast<unsigned long long>(last_write_time.tv_nsec),
+                .file_size = static_cast<unsigned long long>(file_info.st_size),
+        };
+    }
+
+    // Serialization Format (POSIX):
+    // device
+    // inode
+    // last_write_time_seconds
+    // last_write_time_nanoseconds
+    // file_size
+    // user_data
+    auto PosixFile::serialize_identifying_properties() -> void
+    {
+        if (m_serialization_file_path_and_name.empty())
+        {
+            THROW_INTERNAL_FILE_ERROR("[PosixFile::serialize_identifying_properties]: Path & file name for serialization file is empty, please call "
+                                      "'set_serialization_output_file'")
+        }
+
+        const auto properties = get_live_identifying_properties();
+        serialize_item(GenericItemData{.data_type = GenericDataType::UnsignedLongLong, .data_ulonglong = properties.device}, true);
+        serialize_item(GenericItemData{.data_type = GenericDataType::UnsignedLongLong, .data_ulonglong = properties.inode}, true);
+        serialize_item(GenericItemData{.data_type = GenericDataType::UnsignedLongLong, .data_ulonglong = properties.last_write_time_seconds}, true);
+        serialize_item(GenericItemData{.data_type = GenericDataType::UnsignedLongLong, .data_ulonglong = properties.last_write_time_nanoseconds}, true);
+        serialize_item(GenericItemData{.data_type = GenericDataType::UnsignedLongLong, .data_ulonglong = properties.file_size}, true);
+    }
+
+    auto PosixFile::deserialize_identifying_properties() -> void
+    {
+        const auto get_item = [&] {
+            return *static_cast<unsigned long long*>(get_serialized_item(sizeof(unsigned long long), true));
+        };
+        m_identifying_properties.device = get_item();
+        m_identifying_properties.inode = get_item();
+        m_identifying_properties.last_write_time_seconds = get_item();
+        m_identifying_properties.last_write_time_nanoseconds = get_item();
+        m_identifying_properties.file_size = get_item();
+
+        // The cached identifying properties should be inaccessible by user-code,
+        // so let's make sure that the next serialized item to be deserialized by the user-code
+        // is the first item after the last identifying property item
+        m_offset_to_next_serialized_item = sizeof(IdentifyingProperties);
+
+        m_has_cached_identifying_properties = true;
+    }
+
+    auto PosixFile::is_deserialized_and_live_equal() -> bool
+    {
+        if (!m_has_cached_identifying_properties)
+        {
+            if (!std::filesystem::exists(m_serialization_file_path_and_name))
+            {
+                return false;
+            }
+
+            deserialize_identifying_properties();
+        }
+
+        const auto live_properties = get_live_identifying_properties();
+        return live_properties.device == m_identifying_properties.device && live_properties.inode == m_identifying_properties.inode &&
+               live_properties.last_write_time_seconds == m_identifying_properties.last_write_time_seconds &&
+               live_properties.last_write_time_nanoseconds == m_identifying_properties.last_write_time_nanoseconds &&
+               live_properties.file_size == m_identifying_properties.file_size;
+    }
+
+    auto PosixFile::invalidate_serialization() -> void
+    {
+        if (m_serialization_file_path_and_name.empty())
+        {
+            THROW_INTERNAL_FILE_ERROR("[PosixFile::invalidate_serialization] Could not invalidate serialization file because "
+                                      "'m_serialization_file_path_and_name' was empty, please call 'set_serialization_output_file'")
+        }
+
+        if (std::filesystem::exists(m_serialization_file_path_and_name))
+        {
+            delete_file(m_serialization_file_path_and_name);
+        }
+    }
+
+    auto PosixFile::serialize_item(const GenericItemData& data, bool is_internal_item) -> void
+    {
+        if (m_serialization_file_path_and_name.empty())
+        {
+            THROW_INTERNAL_FILE_ERROR(
+                    "[PosixFile::serialize_item]: Path & file name for serialization file is empty, please call 'set_serialization_output_file'")
+        }
+
+        if (!serialization_file_exists() && !is_internal_item)
+        {
+            // If the serialization cache file doesn't exist & this is not an identifying property item,
+            // then we need to serialize the identifying properties before continuing
+            serialize_identifying_properties();
+        }
+
+        Handle serialization_file = open(m_serialization_file_path_and_name, OpenFor::Appending, OverwriteExistingFile::No, CreateIfNonExistent::Yes);
+        auto& underlying_file = serialization_file.get_underlying_type();
+
+        switch (data.data_type)
+        {
+        case GenericDataType::UnsignedLong:
+            underlying_file.write_bytes(&data.data_ulong, sizeof(unsigned long));
+            break;
+        case GenericDataType::SignedLong:
+            underlying_file.write_bytes(&data.data_long, sizeof(signed long));
+            break;
+        case GenericDataType::UnsignedLongLong:
+            underlying_file.write_bytes(&data.data_ulonglong, sizeof(unsigned long long));
+            break;
+        case GenericDataType::SignedLongLong:
+            underlying_file.write_bytes(&data.data_longlong, sizeof(signed long long));
+            break;
+        }
+
+        serialization_file.close();
+    }
+
+    auto PosixFile::get_serialized_item(size_t data_size, bool is_internal_item) -> void*
+    {
+        if (!m_has_cache_in_memory)
+        {
+            if (m_serialization_file_path_and_name.empty())
+            {
+                THROW_INTERNAL_FILE_ERROR(
+                        "[PosixFile::get_serialized_item]: Path & file name for serialization file is empty, please call 'set_serialization_output_file'")
+            }
+
+            Handle cache_file = open(m_serialization_file_path_and_name);
+
+            ssize_t bytes_read{};
+            do
+            {
+                bytes_read = pread(cache_file.get_underlying_type().get_file(), &m_cache, cache_size, 0);
+            } while (bytes_read < 0 && errno == EINTR);
+
+            if (bytes_read < 0)
+            {
+                THROW_INTERNAL_FILE_ERROR(fmt::format("[PosixFile::get_serialized_item] Tried deserializing file but was unable to complete operation. error: {}",
+                                                      to_string(SysError(errno)).c_str()))
+            }
+
+            cache_file.close();
+
+            m_has_cache_in_memory = true;
+        }
+
+        if (!m_has_cached_identifying_properties && !is_internal_item)
+        {
+            deserialize_identifying_properties();
+        }
+
+        void* data_ptr = &m_cache[m_offset_to_next_serialized_item];
+        m_offset_to_next_serialized_item += data_size;
+        return data_ptr;
+    }
+
+    auto PosixFile::close_current_file() -> void
+    {
+        close_file();
+    }
+
+    auto PosixFile::create_all_directories(const std::filesystem::path& file_name_and_path) -> void
+    {
+        if (file_name_and_path.parent_path().empty())
+        {
+            return;
+        }
+
+        try
+        {
+            std::filesystem::create_directories(file_name_and_path.parent_path());
+        }
+        catch (const std::filesystem::filesystem_error& e)
+        {
+            THROW_INTERNAL_FILE_ERROR(fmt::format("[PosixFile::create_all_directories] Tried creating directories '{}' but encountered an error. error: {}",
+                                                  file_name_and_path.string(),
+                                                  e.what()))
+        }
+    }
+
+    auto PosixFile::close_file() -> void
+    {
+        // A failed flush still closes the file, the error is rethrown once the file is closed and the unwritten output is dropped
+        std::exception_ptr flush_error{};
+        if (is_valid() && is_file_open())
+        {
+            try
+            {
+                flush();
+            }
+            catch (...)
+            {
+                flush_error = std::current_exception();
+                m_write_buffer.clear();
+            }
+        }
+
+        if (m_memory_map)
+        {
+            if (munmap(m_memory_map, m_memory_map_size) != 0)
+            {
+                THROW_INTERNAL_FILE_ERROR(fmt::format("[PosixFile::close_file] Was unable to unmap file, error: {}", to_string(SysError(errno)).c_str()))
+            }
+            else
+            {
+                m_memory_map = nullptr;
+                m_memory_map_size = 0;
+            }
+        }
+
+        if (!is_valid() || !is_file_open())
+        {
+            return;
+        }
+
+        // The descriptor is released even if close reports an error, retrying it could close a descriptor that's been reused
+        set_is_file_open(false);
+        if (::close(m_file) != 0 && errno != EINTR)
+        {
+            THROW_INTERNAL_FILE_ERROR(fmt::format("[PosixFile::close_file] Was unable to close file, {}", to_string(SysError(errno)).c_str()))
+        }
+
+        if (flush_error)
+        {
+            std::rethrow_exception(flush_error);
+        }
+    }
+
+    auto PosixFile::is_file_open() const -> bool
+    {
+        return m_is_file_open;
+    }
+
+    auto PosixFile::write_string_to_file(StringViewType string_to_write) -> void
+    {
+        if (string_to_write.empty())
+        {
+            THROW_INTERNAL_FILE_ERROR("[PosixFile::write_string_to_file] Tried writing string to file but string_size was 0.")
+        }
+
+        append_as_utf8(m_write_buffer, string_to_write);
+        if (m_write_buffer.size() >= m_write_buffer_size)
+        {
+            flush();
+        }
+    }
+
+    auto PosixFile::set_write_buffer_size(size_t size) -> void
+    {
+        if (size < m_write_buffer.size())
+        {
+            flush();
+        }
+        m_write_buffer_size = size;
+        m_write_buffer.reserve(size);
+    }
+
+    auto PosixFile::flush() -> void
+    {
+        if (m_write_buffer.empty())
+        {
+            return;
+        }
+
+        write_bytes(m_write_buffer.data(), m_write_buffer.size());
+        m_write_buffer.clear();
+    }
+
+    auto PosixFile::is_same_as(PosixFile& other_file) -> bool
+    {
+        const auto properties = get_live_identifying_properties();
+        const auto other_properties = other_file.get_live_identifying_properties();
+        return properties.device == other_properties.device && properties.inode == other_properties.inode &&
+               properties.last_write_time_seconds == other_properties.last_write_time_seconds &&
+               properties.last_write_time_nanoseconds == other_properties.last_write_time_nanoseconds && properties.file_size == other_properties.file_size;
+    }
+
+    auto PosixFile::read_all() const -> StringType
+    {
+        return read_all_view().to_string();
+    }
+
+    auto PosixFile::read_all_view() const -> FileView
+    {
+        // Opened separately from 'm_file' like WinFile does, so that files opened for writing can still be read back
+        int file{};
+        do
+        {
+            file = ::open(get_file_path().c_str(), O_RDONLY | O_CLOEXEC);
+        } while (file < 0 && errno == EINTR);
+
+        if (file < 0)
+        {
+            THROW_INTERNAL_FILE_ERROR(fmt::format("[PosixFile::read_all_view] Tried to open file for reading but encountered an error. Path & File: {} | error: {}",
+                                                  get_file_path().string(),
+                                                  to_string(SysError(errno)).c_str()))
+        }
+
+        struct stat file_info{};
+        if (fstat(file, &file_info) != 0)
+        {
+            const auto error = errno;
+            ::close(file);
+            THROW_INTERNAL_FILE_ERROR(fmt::format("[PosixFile::read_all_view] Tried to retrieve the file size but 'fstat' returned {}", to_string(SysError(error)).c_str()))
+        }
+
+        if (file_info.st_size <= 0)
+        {
+            ::close(file);
+            return {};
+        }
+
+        // The mapping stays valid after the descriptor is closed
+        const auto file_size = static_cast<size_t>(file_info.st_size);
+        auto mapping = mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE, file, 0);
+        const auto error = errno;
+        ::close(file);
+        if (mapping == MAP_FAILED)
+        {
+            THROW_INTERNAL_FILE_ERROR(fmt::format("[PosixFile::read_all_view] Tried to memory map file but 'mmap' returned {}", to_string(SysError(error)).c_str()))
+        }
+
+        return FileView{static_cast<const uint8_t*>(mapping), file_size};
+    }
+
+    auto FileView::unmap(const uint8_t* mapping, size_t mapping_size) noexcept -> void
+    {
+        munmap(const_cast<uint8_t*>(mapping), mapping_size);
+    }
+
+    auto PosixFile::memory_map() -> std::span<uint8_t>
+    {
+        if (m_memory_map)
+        {
+            return std::span(m_memory_map, m_memory_map_size);
+        }
+
+        int protection;
+        switch (m_open_properties.open_for)
+        {
+        case OpenFor::Writing:
+        case OpenFor::Appending:
+        case OpenFor::ReadWrite:
+            protection = PROT_READ | PROT_WRITE;
+            break;
+        case OpenFor::Reading:
+            protection = PROT_READ;
+            break;
+        default:
+            THROW_INTERNAL_FILE_ERROR("[PosixFile::memory_map] Tried to memory map file but 'm_open_properties' contains invalid data.")
+        }
+
+        // Anything still in the write buffer must be in the file before it's mapped
+        flush();
+
+        struct stat file_info{};
+        if (fstat(m_file, &file_info) != 0)
+        {
+            THROW_INTERNAL_FILE_ERROR(fmt::format("[PosixFile::memory_map] Tried to memory map file but 'fstat' returned {}", to_string(SysError(errno)).c_str()))
+        }
+        if (file_info.st_size <= 0)
+        {
+            THROW_INTERNAL_FILE_ERROR("[PosixFile::memory_map] Tried to memory map file but the file is empty")
+        }
+
+        const auto file_size = static_cast<size_t>(file_info.st_size);
+        auto mapping = mmap(nullptr, file_size, protection, MAP_SHARED, m_file, 0);
+        if (mapping == MAP_FAILED)
+        {
+            THROW_INTERNAL_FILE_ERROR(fmt::format("[PosixFile::memory_map] Tried to memory map file but 'mmap' returned {}", to_string(SysError(errno)).c_str()))
+        }
+
+        m_memory_map = static_cast<uint8_t*>(mapping);
+        m_memory_map_size = file_size;
+        return std::span(m_memory_map, m_memory_map_size);
+    }
+
+    auto PosixFile::open_file(const std::filesystem::path& file_name_and_path, const OpenProperties& open_properties) -> PosixFile
+    {
+        if (file_name_and_path.empty())
+        {
+            THROW_INTERNAL_FILE_ERROR("[PosixFile::open_file] Tried to open file but file_name_and_path was empty.")
+        }
+
+        int flags = O_CLOEXEC;
+        switch (open_properties.open_for)
+        {
+        case OpenFor::Writing:
+            flags |= O_WRONLY;
+            break;
+        case OpenFor::Appending:
+            flags |= O_WRONLY | O_APPEND;
+            break;
+        case OpenFor::Reading:
+            flags |= O_RDONLY;
+            break;
+        case OpenFor::ReadWrite:
+            flags |= O_RDWR;
+            break;
+        default:
+            THROW_INTERNAL_FILE_ERROR("[PosixFile::open_file] Tried to open file but received invalid data for the 'OpenFor' parameter.")
+        }
+
+        if (open_properties.overwrite_existing_file == OverwriteExistingFile::Yes)
+        {
+            create_all_directories(file_name_and_path);
+            flags |= O_CREAT | O_TRUNC;
+        }
+        else if (open_properties.create_if_non_existent == CreateIfNonExistent::Yes)
+        {
+            create_all_directories(file_name_and_path);
+            flags |= O_CREAT;
+        }
+
+        PosixFile file{};
+
+        int new_file{};
+        do
+        {
+            new_file = ::open(file_name_and_path.c_str(), flags, 0666);
+        } while (new_file < 0 && errno == EINTR);
+        file.set_file(new_file);
+
+        if (file.get_file() == invalid_file)
+        {
+            std::string_view open_type = open_properties.open_for == OpenFor::Writing || open_properties.open_for == OpenFor::Appending ? "writing" : "reading";
+
+            THROW_INTERNAL_FILE_ERROR(fmt::format("[PosixFile::open_file] Tried opening file for {} but encountered an error. Path & File: {} | error: {}\n",
+                                                  open_type,
+                                                  file_name_and_path.string(),
+                                                  to_string(SysError(errno)).c_str()))
+        }
+
+        file.m_file_path_and_name = file_name_and_path;
+        file.set_is_file_open(true);
+        file.m_open_properties = open_properties;
+
+        return file;
+    }
+} // namespace RC::File
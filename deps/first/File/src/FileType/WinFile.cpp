@@ -1,3 +1,4 @@
+#include <exception>
 #include <fstream>
 
 #include <File/File.hpp>
@@ -340,6 +341,21 @@ namespace RC::File
 
     auto WinFile::close_file() -> void
     {
+        // A failed flush still closes the file, the error is rethrown once the file is closed and the unwritten output is dropped
+        std::exception_ptr flush_error{};
+        if (is_valid() && is_file_open())
+        {
+            try
+            {
+                flush();
+            }
+            catch (...)
+            {
+                flush_error = std::current_exception();
+                m_write_buffer.clear();
+            }
+        }
+
         if (m_memory_map)
         {
             if (UnmapViewOfFile(m_memory_map) == 0)
@@ -377,6 +393,11 @@ namespace RC::File
         {
             set_is_file_open(false);
         }
+
+        if (flush_error)
+        {
+            std::rethrow_exception(flush_error);
+        }
     }
 
     auto WinFile::is_file_open() const -> bool
@@ -394,22 +415,49 @@ namespace RC::File
                                                   to_string(SysError(GetLastError())).c_str()))
         }
 
-        std::string string_converted_to_utf8(string_size, 0);
+        // Convert straight into the tail of the write buffer so that buffered writes don't need a temporary string
+        const auto previous_size = m_write_buffer.size();
+        m_write_buffer.resize(previous_size + string_size);
         if (WideCharToMultiByte(CP_UTF8,
                                 0,
                                 FromCharTypePtr<wchar_t>(string_to_write.data()),
                                 static_cast<int>(string_to_write.size()),
-                                &string_converted_to_utf8[0],
+                                &m_write_buffer[previous_size],
                                 string_size,
                                 NULL,
                                 NULL) == 0)
         {
+            m_write_buffer.resize(previous_size);
             THROW_INTERNAL_FILE_ERROR(
                     fmt::format("[WinFile::write_string_to_file] Tried writing string to file but could not convert to utf-8. {}",
                                 to_string(SysError(GetLastError())).c_str()))
         }
 
-        write_to_file(*this, string_converted_to_utf8.c_str(), string_size);
+        if (m_write_buffer.size() >= m_write_buffer_size)
+        {
+            flush();
+        }
+    }
+
+    auto WinFile::set_write_buffer_size(size_t size) -> void
+    {
+        if (size < m_write_buffer.size())
+        {
+            flush();
+        }
+        m_write_buffer_size = size;
+        m_write_buffer.reserve(size);
+    }
+
+    auto WinFile::flush() -> void
+    {
+        if (m_write_buffer.empty())
+        {
+            return;
+        }
+
+        write_to_file(*this, m_write_buffer.data(), static_cast<DWORD>(m_write_buffer.size()));
+        m_write_buffer.clear();
     }
 
     auto WinFile::is_same_as(WinFile& other_file) -> bool
@@ -467,36 +515,60 @@ namespace RC::File
 
     auto WinFile::read_all() const -> StringType
     {
-        StreamIType stream{get_file_path(), std::ios::in | std::ios::binary};
-        if (!stream)
+        return read_all_view().to_string();
+    }
+
+    auto WinFile::read_all_view() const -> FileView
+    {
+        // Opened separately from 'm_file' so that files opened for writing can still be read back
+        HANDLE file = CreateFileW(get_file_path().wstring().c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
         {
-            THROW_INTERNAL_FILE_ERROR(fmt::format("[WinFile::read_all] Tried to read entire file but returned error {}", errno))
+            THROW_INTERNAL_FILE_ERROR(fmt::format("[WinFile::read_all_view] Tried to open file for reading but encountered an error. Path & File: {} | error: {}",
+                                                  get_file_path().string(),
+                                                  to_string(SysError(GetLastError())).c_str()))
         }
-        else
+
+        LARGE_INTEGER file_size{};
+        if (GetFileSizeEx(file, &file_size) == 0)
         {
-            // Strip the BOM if it exists
-            File::StreamIType::off_type start{};
-            File::CharType bom[3]{};
-            stream.read(bom, 3);
-            if (bom[0] == 0xEF && bom[1] == 0xBB && bom[2] == 0xBF)
-            {
-                // BOM: UTF-8
-                start = 3;
-            }
+            const auto error = GetLastError();
+            CloseHandle(file);
+            THROW_INTERNAL_FILE_ERROR(fmt::format("[WinFile::read_all_view] Tried to retrieve the file size but 'GetFileSizeEx' returned {}",
+                                                  to_string(SysError(error)).c_str()))
+        }
 
-            StringType file_contents;
-            stream.seekg(0, std::ios::end);
-            auto size = stream.tellg();
-            if (size == -1)
-            {
-                return {};
-            }
-            file_contents.resize(size);
-            stream.seekg(start, std::ios::beg);
-            stream.read(&file_contents[0], file_contents.size());
-            stream.close();
-            return file_contents;
+        if (file_size.QuadPart == 0)
+        {
+            CloseHandle(file);
+            return {};
+        }
+
+        // The mapping object keeps the file open and the view keeps the mapping object alive so both handles can be closed right away
+        HANDLE map_handle = CreateFileMapping(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        const auto map_error = GetLastError();
+        CloseHandle(file);
+        if (!map_handle)
+        {
+            THROW_INTERNAL_FILE_ERROR(fmt::format("[WinFile::read_all_view] Tried to memory map file but 'CreateFileMapping' returned {}",
+                                                  to_string(SysError(map_error)).c_str()))
         }
+
+        auto mapping = static_cast<const uint8_t*>(MapViewOfFile(map_handle, FILE_MAP_READ, 0, 0, 0));
+        const auto view_error = GetLastError();
+        CloseHandle(map_handle);
+        if (!mapping)
+        {
+            THROW_INTERNAL_FILE_ERROR(fmt::format("[WinFile::read_all_view] Tried to memory map file but 'MapViewOfFile' returned {}",
+                                                  to_string(SysError(view_error)).c_str()))
+        }
+
+        return FileView{mapping, static_cast<size_t>(file_size.QuadPart)};
+    }
+
+    auto FileView::unmap(const uint8_t* mapping, [[maybe_unused]] size_t mapping_size) noexcept -> void
+    {
+        UnmapViewOfFile(mapping);
     }
 
     auto WinFile::memory_map() -> std::span<uint8_t>
@@ -0,0 +1,259 @@
+#include <bit>
+#include <cstring>
+#include <utility>
+
+#include <File/FileView.hpp>
+
+namespace RC::File
+{
+    FileView::FileView(const uint8_t* mapping, size_t mapping_size) : m_mapping(mapping), m_mapping_size(mapping_size), m_data(mapping, mapping_size)
+    {
+        if (m_data.size() >= 3 && m_data[0] == 0xEF && m_data[1] == 0xBB && m_data[2] == 0xBF)
+        {
+            m_encoding = Encoding::UTF8;
+            m_data = m_data.subspan(3);
+        }
+        else if (m_data.size() >= 2 && m_data[0] == 0xFF && m_data[1] == 0xFE)
+        {
+            m_encoding = Encoding::UTF16LE;
+            m_data = m_data.subspan(2);
+        }
+        else if (m_data.size() >= 2 && m_data[0] == 0xFE && m_data[1] == 0xFF)
+        {
+            m_encoding = Encoding::UTF16BE;
+            m_data = m_data.subspan(2);
+        }
+    }
+
+    FileView::FileView(FileView&& other) noexcept
+        : m_mapping(std::exchange(other.m_mapping, nullptr)), m_mapping_size(std::exchange(other.m_mapping_size, 0)), m_data(std::exchange(other.m_data, {})),
+          m_encoding(std::exchange(other.m_encoding, Encoding::Unknown))
+    {
+    }
+
+    auto FileView::operator=(FileView&& other) noexcept -> FileView&
+    {
+        if (this != &other)
+        {
+            release();
+            m_mapping = std::exchange(other.m_mapping, nullptr);
+            m_mapping_size = std::exchange(other.m_mapping_size, 0);
+            m_data = std::exchange(other.m_data, {});
+            m_encoding = std::exchange(other.m_encoding, Encoding::Unknown);
+        }
+        return *this;
+    }
+
+    FileView::~FileView()
+    {
+        release();
+    }
+
+    auto FileView::release() noexcept -> void
+    {
+        if (m_mapping)
+        {
+            unmap(m_mapping, m_mapping_size);
+            m_mapping = nullptr;
+            m_mapping_size = 0;
+            m_data = {};
+        }
+    }
+
+    auto FileView::as_native_text() const -> std::optional<StringViewType>
+    {
+        if constexpr (sizeof(CharType) == 2 && std::endian::native == std::endian::little)
+        {
+            // Mappings are page aligned and the byte order mark is two bytes so the data is always aligned for CharType
+            if (m_encoding == Encoding::UTF16LE && m_data.size() % sizeof(CharType) == 0)
+            {
+                return StringViewType{reinterpret_cast<const CharType*>(m_data.data()), m_data.size() / sizeof(CharType)};
+            }
+        }
+        return std::nullopt;
+    }
+
+    auto FileView::as_utf8_text() const -> std::optional<std::string_view>
+    {
+        if (m_encoding == Encoding::UTF16LE || m_encoding == Encoding::UTF16BE)
+        {
+            return std::nullopt;
+        }
+
+        std::string_view text{reinterpret_cast<const char*>(m_data.data()), m_data.size()};
+        if (!is_valid_utf8(text))
+        {
+            return std::nullopt;
+        }
+        return text;
+    }
+
+    auto FileView::get_text(StringType& storage) const -> StringViewType
+    {
+        if (auto native_text = as_native_text())
+        {
+            return *native_text;
+        }
+        storage = to_string();
+        return storage;
+    }
+
+    auto FileView::to_string() const -> StringType
+    {
+        if (m_encoding != Encoding::UTF16LE && m_encoding != Encoding::UTF16BE)
+        {
+            if (auto utf8_text = as_utf8_text())
+            {
+                StringType output(utf8_text->size(), STR('\0'));
+                auto output_end = decode_utf8(*utf8_text, output.data());
+                output.resize(static_cast<size_t>(output_end - output.data()));
+                return output;
+            }
+            // Files in a legacy code page are still read, their bytes just aren't mapped to the right characters
+            return StringType(m_data.begin(), m_data.end());
+        }
+
+        const auto is_big_endian = m_encoding == Encoding::UTF16BE;
+        const auto num_code_units = m_data.size() / 2;
+        const auto get_code_unit = [&](size_t index) -> uint32_t {
+            const auto first = m_data[index * 2];
+            const auto second = m_data[index * 2 + 1];
+            return is_big_endian ? (first << 8) | second : (second << 8) | first;
+        };
+
+        StringType output{};
+        output.reserve(num_code_units);
+        for (size_t i = 0; i < num_code_units; ++i)
+        {
+            auto code_unit = get_code_unit(i);
+            if constexpr (sizeof(CharType) > 2)
+            {
+                // Surrogate pairs are combined when CharType is wide enough to hold the whole code point
+                if (code_unit >= 0xD800 && code_unit <= 0xDBFF && i + 1 < num_code_units)
+                {
+                    const auto low_surrogate = get_code_unit(i + 1);
+                    if (low_surrogate >= 0xDC00 && low_surrogate <= 0xDFFF)
+                    {
+                        code_unit = 0x10000 + ((code_unit - 0xD800) << 10) + (low_surrogate - 0xDC00);
+                        ++i;
+                    }
+                }
+            }
+            output.push_back(static_cast<CharType>(code_unit));
+        }
+        return output;
+    }
+
+    auto is_valid_utf8(std::string_view input) -> bool
+    {
+        auto bytes = reinterpret_cast<const uint8_t*>(input.data());
+        const auto size = input.size();
+        size_t i{};
+        while (i < size)
+        {
+            // Most files are plain ASCII, eight bytes are checked at once until something else shows up
+            if (size - i >= sizeof(uint64_t))
+            {
+                uint64_t chunk{};
+                std::memcpy(&chunk, bytes + i, sizeof(chunk));
+                if ((chunk & 0x8080808080808080ull) == 0)
+                {
+                    i += sizeof(chunk);
+                    continue;
+                }
+            }
+
+            const auto lead = bytes[i];
+            if (lead < 0x80)
+            {
+                ++i;
+                continue;
+            }
+
+            // The range of the second byte is what rules out overlong encodings, surrogates and code points above U+10FFFF
+            size_t length{};
+            uint8_t min_second_byte{0x80};
+            uint8_t max_second_byte{0xBF};
+            if (lead >= 0xC2 && lead <= 0xDF)
+            {
+                length = 2;
+            }
+            else if (lead >= 0xE0 && lead <= 0xEF)
+            {
+                length = 3;
+                min_second_byte = lead == 0xE0 ? 0xA0 : 0x80;
+                max_second_byte = lead == 0xED ? 0x9F : 0xBF;
+            }
+            else if (lead >= 0xF0 && lead <= 0xF4)
+            {
+                length = 4;
+                min_second_byte = lead == 0xF0 ? 0x90 : 0x80;
+                max_second_byte = lead == 0xF4 ? 0x8F : 0xBF;
+            }
+            else
+            {
+                return false;
+            }
+
+            if (size - i < length || bytes[i + 1] < min_second_byte || bytes[i + 1] > max_second_byte)
+            {
+                return false;
+            }
+            for (size_t j = 2; j < length; ++j)
+            {
+                if ((bytes[i + j] & 0xC0) != 0x80)
+                {
+                    return false;
+                }
+            }
+            i += length;
+        }
+        return true;
+    }
+
+    auto decode_utf8(std::string_view input, CharType* output) -> CharType*
+    {
+        auto bytes = reinterpret_cast<const uint8_t*>(input.data());
+        const auto size = input.size();
+        for (size_t i = 0; i < size;)
+        {
+            const uint32_t lead = bytes[i];
+            if (lead < 0x80)
+            {
+                *output++ = static_cast<CharType>(lead);
+                ++i;
+                continue;
+            }
+
+            uint32_t code_point{};
+            if (lead < 0xE0)
+            {
+                code_point = ((lead & 0x1F) << 6) | (bytes[i + 1] & 0x3F);
+                i += 2;
+            }
+            else if (lead < 0xF0)
+            {
+                code_point = ((lead & 0x0F) << 12) | ((bytes[i + 1] & 0x3F) << 6) | (bytes[i + 2] & 0x3F);
+                i += 3;
+            }
+            else
+            {
+                code_point = ((lead & 0x07) << 18) | ((bytes[i + 1] & 0x3F) << 12) | ((bytes[i + 2] & 0x3F) << 6) | (bytes[i + 3] & 0x3F);
+                i += 4;
+            }
+
+            if constexpr (sizeof(CharType) == 2)
+            {
+                if (code_point >= 0x10000)
+                {
+                    code_point -= 0x10000;
+                    *output++ = static_cast<CharType>(0xD800 + (code_point >> 10));
+                    *output++ = static_cast<CharType>(0xDC00 + (code_point & 0x3FF));
+                    continue;
+                }
+            }
+            *output++ = static_cast<CharType>(code_point);
+        }
+        return output;
+    }
+} // namespace RC::File
@@ -0,0 +1,54 @@
+#include <filesystem>
+
+#include <File/File.hpp>
+#include <TestHarness/TestHarness.hpp>
+
+using namespace RC;
+using namespace RC::TestHarness;
+
+// Cost of writing a file in small pieces the way the dumpers and the log do, with and without the write buffer
+// Then the cost of reading it back whole, converted to a string or viewed through the mapping
+int main()
+{
+    constexpr size_t num_lines = 100'000;
+    auto directory = std::filesystem::temp_directory_path() / "FileBench";
+    std::filesystem::create_directories(directory);
+    auto path = directory / "bench.txt";
+    StringViewType line = STR("[0x7ff6a1b2c3d0] /Script/Engine.Actor:K2_GetActorLocation\n");
+
+    auto write_lines = [&](size_t write_buffer_size) {
+        auto file = File::open(path, File::OpenFor::Writing, File::OverwriteExistingFile::Yes, File::CreateIfNonExistent::Yes);
+        file.set_write_buffer_size(write_buffer_size);
+        for (size_t i = 0; i < num_lines; ++i)
+        {
+            file.write_string_to_file(line);
+        }
+        file.close();
+    };
+
+    write_lines(0);
+    auto num_bytes = static_cast<size_t>(std::filesystem::file_size(path));
+    CHECK(num_bytes == num_lines * line.size());
+    benchmark_throughput("write_string_to_file, 100k lines, unbuffered", num_bytes, 1, [&] {
+        write_lines(0);
+    });
+    benchmark_throughput("write_string_to_file, 100k lines, 64 KiB buffer", num_bytes, 3, [&] {
+        write_lines(0x10000);
+    });
+
+    write_lines(0x10000);
+    benchmark_throughput("read_all", num_bytes, 10, [&] {
+        do_not_optimize(File::open(path).read_all());
+    });
+    benchmark_throughput("read_all_view, to_string", num_bytes, 10, [&] {
+        do_not_optimize(File::open(path).read_all_view().to_string());
+    });
+    benchmark_throughput("read_all_view, as_utf8_text", num_bytes, 10, [&] {
+        auto file_view = File::open(path).read_all_view();
+        do_not_optimize(file_view.as_utf8_text());
+    });
+
+    std::filesystem::remove_all(directory);
+
+    return report();
+}
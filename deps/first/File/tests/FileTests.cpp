@@ -0,0 +1,250 @@
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <string_view>
+
+#include <File/File.hpp>
+#include <TestHarness/TestHarness.hpp>
+
+// Runs against whichever backend the platform builds, PosixFile or WinFile, both must behave the same
+using namespace RC;
+using RC::TestHarness::throws;
+
+static auto read_bytes(const std::filesystem::path& path) -> std::string
+{
+    std::ifstream stream{path, std::ios::binary};
+    return {std::istreambuf_iterator<char>{stream}, std::istreambuf_iterator<char>{}};
+}
+
+static auto write_bytes(const std::filesystem::path& path, std::string_view bytes) -> void
+{
+    std::ofstream stream{path, std::ios::binary | std::ios::trunc};
+    stream.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+}
+
+static auto open_for_writing(const std::filesystem::path& path) -> File::Handle
+{
+    return File::open(path, File::OpenFor::Writing, File::OverwriteExistingFile::Yes, File::CreateIfNonExistent::Yes);
+}
+
+static auto test_buffered_write(const std::filesystem::path& path) -> void
+{
+    auto file = open_for_writing(path);
+    file.set_write_buffer_size(16);
+
+    // Held back until the buffer fills or is flushed
+    file.write_string_to_file(STR("0123456789"));
+    CHECK(std::filesystem::file_size(path) == 0);
+    file.flush();
+    CHECK(read_bytes(path) == "0123456789");
+
+    file.write_string_to_file(STR("abcdefgh"));
+    CHECK(read_bytes(path) == "0123456789");
+    file.write_string_to_file(STR("ijklmnop"));
+    CHECK(read_bytes(path) == "0123456789abcdefghijklmnop");
+
+    // Shrinking the buffer below what's buffered writes it out, without a buffer every write goes straight to the file
+    file.write_string_to_file(STR("q"));
+    file.set_write_buffer_size(0);
+    CHECK(read_bytes(path) == "0123456789abcdefghijklmnopq");
+    file.write_string_to_file(STR("r"));
+    CHECK(read_bytes(path) == "0123456789abcdefghijklmnopqr");
+
+    // Closing writes what's left, as does destroying the handle
+    file.set_write_buffer_size(64);
+    file.write_string_to_file(STR("s"));
+    file.close();
+    CHECK(read_bytes(path) == "0123456789abcdefghijklmnopqrs");
+    {
+        auto destroyed_file = open_for_writing(path);
+        destroyed_file.set_write_buffer_size(64);
+        destroyed_file.write_string_to_file(STR("destroyed"));
+    }
+    CHECK(read_bytes(path) == "destroyed");
+
+    // Text is written as UTF-8
+    file = open_for_writing(path);
+    file.write_string_to_file(STR("a\u00e9\u20ac\U0001F600"));
+    file.close();
+    CHECK(read_bytes(path) == "a\xc3\xa9\xe2\x82\xac\xf0\x9f\x98\x80");
+}
+
+static auto test_append(const std::filesystem::path& path) -> void
+{
+    write_bytes(path, "first");
+    for (auto text : {STR(" second"), STR(" third")})
+    {
+        auto file = File::open(path, File::OpenFor::Appending, File::OverwriteExistingFile::No, File::CreateIfNonExistent::Yes);
+        file.set_write_buffer_size(64);
+        file.write_string_to_file(text);
+        file.close();
+    }
+    CHECK(read_bytes(path) == "first second third");
+}
+
+static auto test_read_all(const std::filesystem::path& path) -> void
+{
+    write_bytes(path, "no bom");
+    CHECK(File::open(path).read_all() == STR("no bom"));
+    CHECK(File::open(path).read_all_view().get_encoding() == File::Encoding::Unknown);
+
+    write_bytes(path, "\xef\xbb\xbfutf-8 bom");
+    CHECK(File::open(path).read_all() == STR("utf-8 bom"));
+    CHECK(File::open(path).read_all_view().get_encoding() == File::Encoding::UTF8);
+
+    write_bytes(path, std::string_view{"\xff\xfeu\0t\0f\0-\0001\0006\0l\0e\0", 18});
+    CHECK(File::open(path).read_all() == STR("utf-16le"));
+    CHECK(File::open(path).read_all_view().get_encoding() == File::Encoding::UTF16LE);
+
+    write_bytes(path, std::string_view{"\xfe\xff\0u\0t\0f\0-\0001\0006\0b\0e", 18});
+    CHECK(File::open(path).read_all() == STR("utf-16be"));
+    CHECK(File::open(path).read_all_view().get_encoding() == File::Encoding::UTF16BE);
+
+    write_bytes(path, "");
+    CHECK(File::open(path).read_all().empty());
+    CHECK(File::open(path).read_all_view().empty());
+
+    // Files opened for writing can be read back once flushed
+    auto file = open_for_writing(path);
+    file.set_write_buffer_size(64);
+    file.write_string_to_file(STR("written"));
+    file.flush();
+    CHECK(file.read_all() == STR("written"));
+}
+
+// PosixFile and WinFile write UTF-8 without a byte order mark, it has to read back as what was written
+static auto test_utf8(const std::filesystem::path& path) -> void
+{
+    const StringType text = STR("Accent\u00e9 Emoji\U0001F600 Plain");
+    auto file = open_for_writing(path);
+    file.write_string_to_file(text);
+    file.close();
+    CHECK(read_bytes(path) == "Accent\xc3\xa9 Emoji\xf0\x9f\x98\x80 Plain");
+    CHECK(File::open(path).read_all() == text);
+    CHECK(File::open(path).read_all_view().as_utf8_text() == "Accent\xc3\xa9 Emoji\xf0\x9f\x98\x80 Plain");
+
+    StringType storage{};
+    CHECK(File::open(path).read_all_view().get_text(storage) == text);
+
+    write_bytes(path, "\xef\xbb\xbf\xe2\x82\xac");
+    CHECK(File::open(path).read_all() == STR("\u20ac"));
+
+    // Files in a legacy code page still read one character per byte
+    write_bytes(path, "Caf\xe9");
+    CHECK(!File::open(path).read_all_view().as_utf8_text());
+    CHECK(File::open(path).read_all() == StringType({STR('C'), STR('a'), STR('f'), static_cast<CharType>(0xe9)}));
+
+    CHECK(File::is_valid_utf8("ASCII only, longer than eight bytes"));
+    CHECK(File::is_valid_utf8("\xc3\xa9\xe2\x82\xac\xf4\x8f\xbf\xbf"));
+    // Overlong encodings, surrogates, code points above U+10FFFF and truncated sequences
+    CHECK(!File::is_valid_utf8("\xc0\xaf"));
+    CHECK(!File::is_valid_utf8("\xe0\x80\xaf"));
+    CHECK(!File::is_valid_utf8("\xed\xa0\x80"));
+    CHECK(!File::is_valid_utf8("\xf4\x90\x80\x80"));
+    CHECK(!File::is_valid_utf8("twelve bytes\xe2\x82"));
+    CHECK(!File::is_valid_utf8("\x80"));
+}
+
+static auto test_memory_map(const std::filesystem::path& path) -> void
+{
+    write_bytes(path, "mapped");
+    {
+        auto file = File::open(path, File::OpenFor::ReadWrite);
+        auto bytes = file.memory_map();
+        CHECK(bytes.size() == 6);
+        CHECK(std::string_view(reinterpret_cast<const char*>(bytes.data()), bytes.size()) == "mapped");
+        bytes[0] = 'M';
+        // Mapping again returns the same mapping
+        CHECK(file.memory_map().data() == bytes.data());
+        file.close();
+    }
+    CHECK(read_bytes(path) == "Mapped");
+
+    // Buffered output is written before the file is mapped, both backends can only map files that were opened for reading too
+    auto file = File::open(path, File::OpenFor::ReadWrite, File::OverwriteExistingFile::Yes, File::CreateIfNonExistent::Yes);
+    file.set_write_buffer_size(64);
+    file.write_string_to_file(STR("buffered"));
+    auto bytes = file.memory_map();
+    CHECK(std::string_view(reinterpret_cast<const char*>(bytes.data()), bytes.size()) == "buffered");
+    file.close();
+
+    write_bytes(path, "");
+    CHECK(throws([&] {
+        auto empty_file = File::open(path);
+        (void)empty_file.memory_map();
+    }));
+}
+
+static auto test_serialization(const std::filesystem::path& path, const std::filesystem::path& serialization_path) -> void
+{
+    std::filesystem::remove(serialization_path);
+    write_bytes(path, "serialized");
+    {
+        auto file = File::open(path);
+        file.set_serialization_output_file(serialization_path);
+        CHECK(!file.is_deserialized_and_live_equal());
+        file.serialize_item(0x1122334455667788ull);
+        file.serialize_item(-5ll);
+        file.close();
+    }
+    {
+        auto file = File::open(path);
+        file.set_serialization_output_file(serialization_path);
+        CHECK(file.is_deserialized_and_live_equal());
+        CHECK(file.get_serialized_item<unsigned long long>() == 0x1122334455667788ull);
+        CHECK(file.get_serialized_item<long long>() == -5ll);
+        file.close();
+    }
+
+    // Any change to the file makes the serialized data stale
+    write_bytes(path, "serialized, changed");
+    {
+        auto file = File::open(path);
+        file.set_serialization_output_file(serialization_path);
+        CHECK(!file.is_deserialized_and_live_equal());
+        file.invalidate_serialization();
+        CHECK(!std::filesystem::exists(serialization_path));
+        file.close();
+    }
+}
+
+static auto test_failed_flush([[maybe_unused]] const std::filesystem::path& path) -> void
+{
+#ifndef _WIN32
+    // Every write to /dev/full fails, closing reports it and destroying the handle mustn't terminate
+    auto file = File::open("/dev/full", File::OpenFor::Writing);
+    file.set_write_buffer_size(64);
+    file.write_string_to_file(STR("lost"));
+    CHECK(throws([&] {
+        file.close();
+    }));
+    // The file was closed anyway
+    file.close();
+
+    {
+        auto destroyed_file = File::open("/dev/full", File::OpenFor::Writing);
+        destroyed_file.set_write_buffer_size(64);
+        destroyed_file.write_string_to_file(STR("lost"));
+    }
+#endif
+}
+
+int main()
+{
+    auto directory = std::filesystem::temp_directory_path() / "FileTests";
+    std::filesystem::create_directories(directory);
+    auto path = directory / "file.txt";
+
+    test_buffered_write(path);
+    test_append(path);
+    test_read_all(path);
+    test_utf8(path);
+    test_memory_map(path);
+    test_serialization(path, directory / "file.cache");
+    test_failed_flush(path);
+
+    std::filesystem::remove_all(directory);
+
+    return RC::TestHarness::report();
+}
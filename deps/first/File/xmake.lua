@@ -11,5 +11,10 @@ target(projectName)
     add_includedirs("include", { public = true }) 
     add_headerfiles("include/**.hpp")
 
-    add_files("src/**.cpp")
+    add_files("src/File.cpp", "src/FileView.cpp")
+    if is_plat("windows") then
+        add_files("src/FileType/WinFile.cpp")
+    else
+        add_files("src/FileType/PosixFile.cpp")
+    end
     add_packages("fmt", { public = true })
\ No newline at end of file
@@ -1,5 +1,12 @@
 #pragma once
 
+// Only Windows builds export and import symbols
+#ifndef _WIN32
+#ifndef RC_INI_PARSER_API
+#define RC_INI_PARSER_API
+#endif
+#endif
+
 #ifndef RC_INI_PARSER_EXPORTS
 #ifndef RC_INI_PARSER_BUILD_STATIC
 #ifndef RC_INI_PARSER_API
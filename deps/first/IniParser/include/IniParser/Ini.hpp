@@ -1,6 +1,9 @@
 #pragma once
 
+#include <cstdint>
+#include <filesystem>
 #include <unordered_map>
+#include <vector>
 
 #include <File/File.hpp>
 #include <IniParser/Common.hpp>
@@ -13,6 +16,52 @@ namespace RC::Ini
 {
     class Value;
 
+    // A section and key pair whose lookup hash is computed when the key is constructed
+    // Keys built from literals are constexpr so repeated lookups don't hash or allocate at runtime
+    class Key
+    {
+      private:
+        File::StringViewType m_section;
+        File::StringViewType m_key;
+        uint64_t m_hash;
+
+      public:
+        constexpr Key(File::StringViewType section, File::StringViewType key) : m_section(section), m_key(key), m_hash(hash(section, key))
+        {
+        }
+
+      public:
+        constexpr auto get_section() const -> File::StringViewType
+        {
+            return m_section;
+        }
+        constexpr auto get_key() const -> File::StringViewType
+        {
+            return m_key;
+        }
+        constexpr auto get_hash() const -> uint64_t
+        {
+            return m_hash;
+        }
+
+        // FNV-1a over both strings, the section length is mixed in so that "ab"/"c" and "a"/"bc" don't collide
+        constexpr static auto hash(File::StringViewType section, File::StringViewType key) -> uint64_t
+        {
+            constexpr uint64_t prime = 0x100000001b3;
+            uint64_t hash = 0xcbf29ce484222325;
+            for (auto c : section)
+            {
+                hash = (hash ^ static_cast<uint64_t>(c)) * prime;
+            }
+            hash = (hash ^ static_cast<uint64_t>(section.size())) * prime;
+            for (auto c : key)
+            {
+                hash = (hash ^ static_cast<uint64_t>(c)) * prime;
+            }
+            return hash;
+        }
+    };
+
     class Parser
     {
       public:
@@ -22,23 +71,53 @@ namespace RC::Ini
             No,
         };
 
+      private:
+        struct IndexEntry
+        {
+            uint64_t hash;
+            const File::StringType* section;
+            const File::StringType* key;
+            const Value* value;
+        };
+
       private:
         std::unordered_map<File::StringType, Section> m_sections;
+        // Every key/value pair of every section, sorted by Key hash
+        // Points into the nodes of 'm_sections' which is why the parser can be moved but not copied
+        std::vector<IndexEntry> m_index;
         bool m_parsing_is_complete{false};
+        bool m_loaded_from_snapshot{false};
 
       public:
         Parser() = default;
+        Parser(const Parser&) = delete;
+        Parser(Parser&&) = default;
+        auto operator=(const Parser&) -> Parser& = delete;
+        auto operator=(Parser&&) -> Parser& = default;
 
       private:
-        RC_INI_PARSER_API auto parse_internal(File::StringType& input) -> void;
+        RC_INI_PARSER_API auto parse_internal(File::StringViewType input) -> void;
+        RC_INI_PARSER_API auto parse_internal(File::StringViewType input, const std::filesystem::path& snapshot_path) -> void;
+        RC_INI_PARSER_API auto build_index() -> void;
         RC_INI_PARSER_API auto create_available_tokens_for_tokenizer() -> ParserBase::TokenContainer;
-        RC_INI_PARSER_API auto get_value(const File::StringType& section,
-                                         const File::StringType& key,
-                                         CanThrow = CanThrow::Yes) const -> std::optional<std::reference_wrapper<const Value>>;
+        RC_INI_PARSER_API auto get_value(const Key& key, CanThrow = CanThrow::Yes) const -> std::optional<std::reference_wrapper<const Value>>;
+        RC_INI_PARSER_API auto read_snapshot(const std::filesystem::path& snapshot_path, uint64_t source_hash) -> bool;
+        RC_INI_PARSER_API auto write_snapshot(const std::filesystem::path& snapshot_path, uint64_t source_hash) const -> void;
 
       public:
         RC_INI_PARSER_API auto parse(File::StringType& input) -> void;
         RC_INI_PARSER_API auto parse(const File::Handle&) -> void;
+        // Tokenizes straight from the mapped file when it's stored in the native encoding, otherwise it's decoded once first
+        RC_INI_PARSER_API auto parse(const File::FileView&) -> void;
+        // Loads the sections from the binary snapshot at 'snapshot_path' if it was written from identical input
+        // Otherwise the input is parsed as text and a new snapshot is written, snapshot I/O errors are never fatal
+        RC_INI_PARSER_API auto parse(File::StringType& input, const std::filesystem::path& snapshot_path) -> void;
+        RC_INI_PARSER_API auto parse(const File::Handle&, const std::filesystem::path& snapshot_path) -> void;
+        RC_INI_PARSER_API auto parse(const File::FileView&, const std::filesystem::path& snapshot_path) -> void;
+        RC_INI_PARSER_API auto is_loaded_from_snapshot() const -> bool
+        {
+            return m_loaded_from_snapshot;
+        }
         RC_INI_PARSER_API auto get_list(const File::StringType& section) -> List;
         RC_INI_PARSER_API auto get_ordered_list(const File::StringType& section) -> List;
         RC_INI_PARSER_API auto get_string(const File::StringType& section,
@@ -52,5 +131,14 @@ namespace RC::Ini
         RC_INI_PARSER_API auto get_float(const File::StringType& section, const File::StringType& key) const -> float;
         RC_INI_PARSER_API auto get_bool(const File::StringType& section, const File::StringType& key, bool default_value) const noexcept -> bool;
         RC_INI_PARSER_API auto get_bool(const File::StringType& section, const File::StringType& key) const -> bool;
+
+        RC_INI_PARSER_API auto get_string(const Key& key, const File::StringType& default_value) const noexcept -> const File::StringType&;
+        RC_INI_PARSER_API auto get_string(const Key& key) const -> const File::StringType&;
+        RC_INI_PARSER_API auto get_int64(const Key& key, int64_t default_value) const noexcept -> int64_t;
+        RC_INI_PARSER_API auto get_int64(const Key& key) const -> int64_t;
+        RC_INI_PARSER_API auto get_float(const Key& key, float default_value) const noexcept -> float;
+        RC_INI_PARSER_API auto get_float(const Key& key) const -> float;
+        RC_INI_PARSER_API auto get_bool(const Key& key, bool default_value) const noexcept -> bool;
+        RC_INI_PARSER_API auto get_bool(const Key& key) const -> bool;
     };
 } // namespace RC::Ini
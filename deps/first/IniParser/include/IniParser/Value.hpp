@@ -8,8 +8,13 @@
 
 namespace RC::Ini
 {
+    class Parser;
+
     class Value
     {
+        // The parser reads and writes the raw members when saving and loading binary snapshots
+        friend class Parser;
+
       public:
         enum class Type
         {
@@ -1,10 +1,12 @@
+#include <algorithm>
+
 #include <IniParser/Ini.hpp>
 #include <IniParser/TokenParser.hpp>
 #include <IniParser/Tokens.hpp>
 
 namespace RC::Ini
 {
-    auto Parser::parse_internal(File::StringType& input) -> void
+    auto Parser::parse_internal(File::StringViewType input) -> void
     {
         // Tokenize -> START
         ParserBase::Tokenizer tokenizer;
@@ -17,6 +19,7 @@ namespace RC::Ini
         token_parser.parse();
         // Parse Tokens -> END
 
+        build_index();
         m_parsing_is_complete = true;
     }
 
@@ -41,9 +44,20 @@ namespace RC::Ini
         return tc;
     }
 
-    auto Parser::get_value(const File::StringType& section,
-                           const File::StringType& key,
-                           CanThrow can_throw) const -> std::optional<std::reference_wrapper<const Value>>
+    auto Parser::build_index() -> void
+    {
+        m_index.clear();
+        for (const auto& [section_name, section] : m_sections)
+        {
+            for (const auto& [key, value] : section.key_value_pairs)
+            {
+                m_index.emplace_back(IndexEntry{Key::hash(section_name, key), &section_name, &key, &value});
+            }
+        }
+        std::ranges::sort(m_index, {}, &IndexEntry::hash);
+    }
+
+    auto Parser::get_value(const Key& key, CanThrow can_throw) const -> std::optional<std::reference_wrapper<const Value>>
     {
         if (!m_parsing_is_complete)
         {
@@ -57,24 +71,32 @@ namespace RC::Ini
             }
         }
 
-        const auto& section_iter = m_sections.find(section);
-        if (section_iter == m_sections.end())
+        // Different keys can share a hash so every entry in the range has to be compared
+        auto entry = std::ranges::lower_bound(m_index, key.get_hash(), {}, &IndexEntry::hash);
+        for (; entry != m_index.end() && entry->hash == key.get_hash(); ++entry)
         {
-            return std::nullopt;
-        }
-        else
-        {
-            const auto& key_value_pairs = section_iter->second.key_value_pairs;
-            const auto& key_value_pairs_iter = key_value_pairs.find(key);
-            if (key_value_pairs_iter == key_value_pairs.end())
-            {
-                return std::nullopt;
-            }
-            else
+            if (*entry->section == key.get_section() && *entry->key == key.get_key())
             {
-                return std::ref(key_value_pairs_iter->second);
+                return std::cref(*entry->value);
             }
         }
+        return std::nullopt;
+    }
+
+    auto Parser::parse_internal(File::StringViewType input, const std::filesystem::path& snapshot_path) -> void
+    {
+        // The source hash covers the whole input, any edit to the file invalidates its snapshot
+        const auto source_hash = Key::hash(input, {});
+        if (read_snapshot(snapshot_path, source_hash))
+        {
+            build_index();
+            m_parsing_is_complete = true;
+            m_loaded_from_snapshot = true;
+            return;
+        }
+
+        parse_internal(input);
+        write_snapshot(snapshot_path, source_hash);
     }
 
     auto Parser::parse(File::StringType& input) -> void
@@ -84,8 +106,29 @@ namespace RC::Ini
 
     auto Parser::parse(const File::Handle& file) -> void
     {
-        auto input = file.read_all();
-        parse_internal(input);
+        parse(file.read_all_view());
+    }
+
+    auto Parser::parse(const File::FileView& file_view) -> void
+    {
+        File::StringType decoded_input{};
+        parse_internal(file_view.get_text(decoded_input));
+    }
+
+    auto Parser::parse(File::StringType& input, const std::filesystem::path& snapshot_path) -> void
+    {
+        parse_internal(input, snapshot_path);
+    }
+
+    auto Parser::parse(const File::Handle& file, const std::filesystem::path& snapshot_path) -> void
+    {
+        parse(file.read_all_view(), snapshot_path);
+    }
+
+    auto Parser::parse(const File::FileView& file_view, const std::filesystem::path& snapshot_path) -> void
+    {
+        File::StringType decoded_input{};
+        parse_internal(file_view.get_text(decoded_input), snapshot_path);
     }
 
     auto Parser::get_list(const File::StringType& section) -> List
@@ -107,9 +150,9 @@ namespace RC::Ini
         return get_list(section);
     }
 
-    auto Parser::get_string(const File::StringType& section, const File::StringType& key, const File::StringType& default_value) const noexcept -> const File::StringType&
+    auto Parser::get_string(const Key& key, const File::StringType& default_value) const noexcept -> const File::StringType&
     {
-        const auto maybe_value = get_value(section, key, CanThrow::No);
+        const auto maybe_value = get_value(key, CanThrow::No);
         if (!maybe_value.has_value())
         {
             return default_value;
@@ -128,9 +171,9 @@ namespace RC::Ini
         }
     }
 
-    auto Parser::get_string(const File::StringType& section, const File::StringType& key) const -> const File::StringType&
+    auto Parser::get_string(const Key& key) const -> const File::StringType&
     {
-        const auto maybe_value = get_value(section, key);
+        const auto maybe_value = get_value(key);
         if (!maybe_value.has_value())
         {
             throw std::runtime_error{"[Ini::get_string] Tried getting value of type 'String' but the value didn't exist."};
@@ -149,9 +192,9 @@ namespace RC::Ini
         }
     }
 
-    auto Parser::get_int64(const File::StringType& section, const File::StringType& key, int64_t default_value) const noexcept -> int64_t
+    auto Parser::get_int64(const Key& key, int64_t default_value) const noexcept -> int64_t
     {
-        const auto maybe_value = get_value(section, key, CanThrow::No);
+        const auto maybe_value = get_value(key, CanThrow::No);
         if (!maybe_value.has_value())
         {
             return default_value;
@@ -170,9 +213,9 @@ namespace RC::Ini
         }
     }
 
-    auto Parser::get_int64(const File::StringType& section, const File::StringType& key) const -> int64_t
+    auto Parser::get_int64(const Key& key) const -> int64_t
     {
-        const auto maybe_value = get_value(section, key);
+        const auto maybe_value = get_value(key);
         if (!maybe_value.has_value())
         {
             throw std::runtime_error{"[Ini::get_int64] Tried getting value of type 'Int64' but the value didn't exist."};
@@ -191,9 +234,9 @@ namespace RC::Ini
         }
     }
 
-    auto Parser::get_float(const File::StringType& section, const File::StringType& key, float default_value) const noexcept -> float
+    auto Parser::get_float(const Key& key, float default_value) const noexcept -> float
     {
-        const auto maybe_value = get_value(section, key, CanThrow::No);
+        const auto maybe_value = get_value(key, CanThrow::No);
         if (!maybe_value.has_value())
         {
             return default_value;
@@ -212,9 +255,9 @@ namespace RC::Ini
         }
     }
 
-    auto Parser::get_float(const File::StringType& section, const File::StringType& key) const -> float
+    auto Parser::get_float(const Key& key) const -> float
     {
-        const auto maybe_value = get_value(section, key);
+        const auto maybe_value = get_value(key);
         if (!maybe_value.has_value())
         {
             throw std::runtime_error{"[Ini::get_float] Tried getting value of type 'Float' but the value didn't exist."};
@@ -233,9 +276,9 @@ namespace RC::Ini
         }
     }
 
-    auto Parser::get_bool(const File::StringType& section, const File::StringType& key, bool default_value) const noexcept -> bool
+    auto Parser::get_bool(const Key& key, bool default_value) const noexcept -> bool
     {
-        const auto maybe_value = get_value(section, key, CanThrow::No);
+        const auto maybe_value = get_value(key, CanThrow::No);
         if (!maybe_value.has_value())
         {
             return default_value;
@@ -254,9 +297,9 @@ namespace RC::Ini
         }
     }
 
-    auto Parser::get_bool(const File::StringType& section, const File::StringType& key) const -> bool
+    auto Parser::get_bool(const Key& key) const -> bool
     {
-        const auto maybe_value = get_value(section, key);
+        const auto maybe_value = get_value(key);
         if (!maybe_value.has_value())
         {
             throw std::runtime_error{"[Ini::get_int64] Tried getting value of type 'Bool' but the value didn't exist."};
@@ -274,4 +317,44 @@ namespace RC::Ini
             }
         }
     }
+
+    auto Parser::get_string(const File::StringType& section, const File::StringType& key, const File::StringType& default_value) const noexcept -> const File::StringType&
+    {
+        return get_string(Key{section, key}, default_value);
+    }
+
+    auto Parser::get_string(const File::StringType& section, const File::StringType& key) const -> const File::StringType&
+    {
+        return get_string(Key{section, key});
+    }
+
+    auto Parser::get_int64(const File::StringType& section, const File::StringType& key, int64_t default_value) const noexcept -> int64_t
+    {
+        return get_int64(Key{section, key}, default_value);
+    }
+
+    auto Parser::get_int64(const File::StringType& section, const File::StringType& key) const -> int64_t
+    {
+        return get_int64(Key{section, key});
+    }
+
+    auto Parser::get_float(const File::StringType& section, const File::StringType& key, float default_value) const noexcept -> float
+    {
+        return get_float(Key{section, key}, default_value);
+    }
+
+    auto Parser::get_float(const File::StringType& section, const File::StringType& key) const -> float
+    {
+        return get_float(Key{section, key});
+    }
+
+    auto Parser::get_bool(const File::StringType& section, const File::StringType& key, bool default_value) const noexcept -> bool
+    {
+        return get_bool(Key{section, key}, default_value);
+    }
+
+    auto Parser::get_bool(const File::StringType& section, const File::StringType& key) const -> bool
+    {
+        return get_bool(Key{section, key});
+    }
 } // namespace RC::Ini
@@ -0,0 +1,217 @@
+#include <array>
+#include <bit>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <type_traits>
+
+#include <IniParser/Ini.hpp>
+#include <IniParser/Value.hpp>
+
+/*
+    Binary snapshot of a parsed ini file
+
+    Header:      magic, version, sizeof(CharType), hash of the source text
+    Sections:    count, then for each section: name, is_ordered_list, ordered list items, key/value pairs
+    Values:      valid type mask, string, int64, float, bool
+
+    Strings are stored as a 32-bit length followed by the raw characters
+    Variable references are resolved before writing, every loaded value refers to itself
+    The layout is native endian and only meant to be read back on the machine that wrote it
+*/
+
+namespace RC::Ini
+{
+    constexpr static uint32_t snapshot_magic = 0x53494E49; // 'INIS'
+    constexpr static uint32_t snapshot_version = 1;
+
+    class SnapshotWriter
+    {
+      private:
+        std::vector<char> m_data{};
+
+      public:
+        template <typename T>
+        auto write(T value) -> void
+        {
+            static_assert(std::is_trivially_copyable_v<T>);
+            const auto bytes = std::bit_cast<std::array<char, sizeof(T)>>(value);
+            m_data.insert(m_data.end(), bytes.begin(), bytes.end());
+        }
+
+        auto write_string(File::StringViewType string) -> void
+        {
+            write(static_cast<uint32_t>(string.size()));
+            const auto bytes = reinterpret_cast<const char*>(string.data());
+            m_data.insert(m_data.end(), bytes, bytes + string.size() * sizeof(File::CharType));
+        }
+
+        auto get_data() const -> const std::vector<char>&
+        {
+            return m_data;
+        }
+    };
+
+    class SnapshotReader
+    {
+      private:
+        const std::vector<char>& m_data;
+        size_t m_offset{};
+        bool m_is_valid{true};
+
+      public:
+        explicit SnapshotReader(const std::vector<char>& data) : m_data(data)
+        {
+        }
+
+      public:
+        auto is_valid() const -> bool
+        {
+            return m_is_valid;
+        }
+
+        // Reads past the end of the data mark the reader invalid and return default constructed values
+        template <typename T>
+        auto read() -> T
+        {
+            static_assert(std::is_trivially_copyable_v<T>);
+            T value{};
+            if (!m_is_valid || m_data.size() - m_offset < sizeof(T))
+            {
+                m_is_valid = false;
+                return value;
+            }
+            std::memcpy(&value, m_data.data() + m_offset, sizeof(T));
+            m_offset += sizeof(T);
+            return value;
+        }
+
+        auto read_string() -> File::StringType
+        {
+            const auto size = static_cast<size_t>(read<uint32_t>());
+            const auto size_in_bytes = size * sizeof(File::CharType);
+            if (!m_is_valid || m_data.size() - m_offset < size_in_bytes)
+            {
+                m_is_valid = false;
+                return {};
+            }
+            File::StringType string(size, STR('\0'));
+            std::memcpy(string.data(), m_data.data() + m_offset, size_in_bytes);
+            m_offset += size_in_bytes;
+            return string;
+        }
+
+        auto is_at_end() const -> bool
+        {
+            return m_offset == m_data.size();
+        }
+    };
+
+    auto Parser::write_snapshot(const std::filesystem::path& snapshot_path, uint64_t source_hash) const -> void
+    {
+        SnapshotWriter writer{};
+        writer.write(snapshot_magic);
+        writer.write(snapshot_version);
+        writer.write(static_cast<uint32_t>(sizeof(File::CharType)));
+        writer.write(source_hash);
+
+        writer.write(static_cast<uint32_t>(m_sections.size()));
+        for (const auto& [section_name, section] : m_sections)
+        {
+            writer.write_string(section_name);
+            writer.write(static_cast<uint8_t>(section.is_ordered_list));
+
+            writer.write(static_cast<uint32_t>(section.ordered_list.size()));
+            for (const auto& item : section.ordered_list)
+            {
+                writer.write_string(item);
+            }
+
+            writer.write(static_cast<uint32_t>(section.key_value_pairs.size()));
+            for (const auto& [key, value] : section.key_value_pairs)
+            {
+                const auto& resolved_value = *value.get_ref();
+                uint8_t valid_types{};
+                for (size_t i = 0; i < resolved_value.m_valid_types.size(); ++i)
+                {
+                    valid_types |= static_cast<uint8_t>(resolved_value.m_valid_types[i]) << i;
+                }
+
+                writer.write_string(key);
+                writer.write(valid_types);
+                writer.write_string(resolved_value.m_string_value);
+                writer.write(resolved_value.m_int64_value);
+                writer.write(resolved_value.m_float_value);
+                writer.write(static_cast<uint8_t>(resolved_value.m_bool_value));
+            }
+        }
+
+        // The snapshot is only a cache, failing to write it must never stop the text parse result from being used
+        std::error_code error_code{};
+        std::filesystem::create_directories(snapshot_path.parent_path(), error_code);
+        std::ofstream stream{snapshot_path, std::ios::binary | std::ios::trunc};
+        if (stream)
+        {
+            stream.write(writer.get_data().data(), static_cast<std::streamsize>(writer.get_data().size()));
+        }
+    }
+
+    auto Parser::read_snapshot(const std::filesystem::path& snapshot_path, uint64_t source_hash) -> bool
+    {
+        std::ifstream stream{snapshot_path, std::ios::binary};
+        if (!stream)
+        {
+            return false;
+        }
+        const std::vector<char> data{std::istreambuf_iterator<char>{stream}, std::istreambuf_iterator<char>{}};
+
+        SnapshotReader reader{data};
+        if (reader.read<uint32_t>() != snapshot_magic || reader.read<uint32_t>() != snapshot_version ||
+            reader.read<uint32_t>() != sizeof(File::CharType) || reader.read<uint64_t>() != source_hash)
+        {
+            return false;
+        }
+
+        std::unordered_map<File::StringType, Section> sections{};
+        const auto num_sections = reader.read<uint32_t>();
+        for (uint32_t section_index = 0; section_index < num_sections && reader.is_valid(); ++section_index)
+        {
+            auto section_name = reader.read_string();
+            auto& section = sections[std::move(section_name)];
+            section.is_ordered_list = reader.read<uint8_t>() != 0;
+
+            const auto num_items = reader.read<uint32_t>();
+            for (uint32_t item_index = 0; item_index < num_items && reader.is_valid(); ++item_index)
+            {
+                section.ordered_list.emplace_back(reader.read_string());
+            }
+
+            const auto num_key_value_pairs = reader.read<uint32_t>();
+            for (uint32_t pair_index = 0; pair_index < num_key_value_pairs && reader.is_valid(); ++pair_index)
+            {
+                auto key = reader.read_string();
+                auto& value = section.key_value_pairs[std::move(key)];
+
+                const auto valid_types = reader.read<uint8_t>();
+                for (size_t i = 0; i < value.m_valid_types.size(); ++i)
+                {
+                    value.m_valid_types[i] = (valid_types >> i) & 1;
+                    value.m_num_valid_types += value.m_valid_types[i];
+                }
+                value.m_string_value = reader.read_string();
+                value.m_int64_value = reader.read<int64_t>();
+                value.m_float_value = reader.read<float>();
+                value.m_bool_value = reader.read<uint8_t>() != 0;
+                value.m_ref = &value;
+            }
+        }
+
+        if (!reader.is_valid() || !reader.is_at_end())
+        {
+            return false;
+        }
+
+        m_sections = std::move(sections);
+        return true;
+    }
+} // namespace RC::Ini
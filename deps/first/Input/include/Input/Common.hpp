@@ -1,5 +1,12 @@
 #pragma once
 
+// Only Windows builds export and import symbols
+#ifndef _WIN32
+#ifndef RC_INPUT_API
+#define RC_INPUT_API
+#endif
+#endif
+
 #ifndef RC_INPUT_EXPORTS
 #ifndef RC_INPUT_BUILD_STATIC
 #ifndef RC_INPUT_API
@@ -8,6 +8,7 @@
 #include <vector>
 #include <memory>
 #include <array>
+#include <atomic>
 #include <mutex>
 
 #include <Input/Common.hpp>
@@ -40,6 +41,19 @@ namespace RC::Input
 
     using ModifierKeyArray = std::array<Input::ModifierKey, max_modifier_keys>;
 
+    // The registered key binds compiled into a table indexed by key
+    // A table is immutable once published, registration changes build a new table that replaces it
+    struct DispatchTable
+    {
+        struct Entry
+        {
+            uint32_t required_modifier_keys{};
+            EventCallbackCallable callback{};
+        };
+
+        std::array<std::vector<Entry>, 0x100> entries{};
+    };
+
 #ifdef HAS_INPUT
     class PlatformInputSource;
     class RC_INPUT_API Handler
@@ -49,9 +63,15 @@ namespace RC::Input
         KeySet m_key_set{};
         bool m_allow_input{true};
         std::array<bool, max_keys> m_subscribed_keys{};
+        // Incremented whenever 'm_subscribed_keys' changes so that input sources can cache what they poll
+        std::atomic<uint32_t> m_subscribed_keys_version{};
 
         std::shared_ptr<PlatformInputSource> m_platform_handler;
         std::mutex m_event_mutex;
+        // Read by 'process_event' without taking 'm_event_mutex'
+        std::atomic<std::shared_ptr<const DispatchTable>> m_dispatch_table{};
+        // Set when 'm_key_set' changes, the table is rebuilt once before the next dispatch instead of after every registration
+        std::atomic<bool> m_dispatch_table_is_stale{};
 
       public:
         Handler() {};
@@ -82,12 +102,19 @@ namespace RC::Input
         {
             return m_subscribed_keys;
         }
+        auto get_subscribed_keys_version() const -> uint32_t
+        {
+            return m_subscribed_keys_version.load(std::memory_order_acquire);
+        }
 
         auto get_allow_input() -> bool;
         auto set_allow_input(bool new_value) -> void;
 
         auto get_current_input_source() -> std::string;
 
+      private:
+        auto rebuild_dispatch_table() -> void;
+
       private:
         static std::unordered_map<std::string, std::shared_ptr<PlatformInputSource>> m_input_sources_store;
         static auto register_input_source(std::shared_ptr<PlatformInputSource> input_source) -> void;
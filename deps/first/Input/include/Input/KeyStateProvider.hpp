@@ -0,0 +1,25 @@
+#pragma once
+
+#include <string>
+
+namespace RC::Input
+{
+    // Source of raw keyboard and window focus state for polling input sources
+    // Keeping the OS calls behind this interface lets the polling logic run against a mock provider
+    class KeyStateProvider
+    {
+      public:
+        virtual ~KeyStateProvider() = default;
+
+      public:
+        // Returns whether the key with the given virtual key code is currently held down
+        virtual auto is_key_down(int key) -> bool = 0;
+
+        // Returns an opaque identifier for the window that currently has focus, or nullptr if there isn't one
+        virtual auto get_foreground_window() -> void* = 0;
+
+        // Retrieves the class name of a window returned by 'get_foreground_window'
+        // Returns false if the class name couldn't be retrieved
+        virtual auto get_window_class_name(void* window, std::wstring& class_name) -> bool = 0;
+    };
+} // namespace RC::Input
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <atomic>
+
 #include <Input/PlatformInputSource.hpp>
 #include <Input/KeyDef.hpp>
 #include <Input/RingBuffer.hpp>
@@ -14,6 +16,8 @@ namespace RC::Input
 
       protected:
         bool m_activated{false};
+        // Logs every pushed and received event at the verbose level, checked before anything is formatted
+        std::atomic<bool> m_trace_events{false};
 
       private:
         /// SAFETY: Only update and return m_input_events
@@ -55,6 +59,10 @@ namespace RC::Input
 
       public:
         auto push_input_event(const InputEvent& event) -> void;
+        auto set_trace_events(bool trace_events) -> void
+        {
+            m_trace_events.store(trace_events, std::memory_order_relaxed);
+        }
     };
 
 }; // namespace RC::Input
\ No newline at end of file
@@ -1,23 +1,40 @@
 #pragma once
 
+#include <array>
+#include <memory>
+#include <string>
 #include <vector>
-#include <unordered_map>
 
 #include <Input/KeyDef.hpp>
 #include <Input/Common.hpp>
+#include <Input/KeyStateProvider.hpp>
 #include <Input/PlatformInputSource.hpp>
+#include <Input/Platform/Win32KeyStateProvider.hpp>
 
 namespace RC::Input
 {
     class Win32AsyncInputSource : public PlatformInputSource
     {
       private:
+        constexpr static std::array<ModifierKey, 3> polled_modifier_keys{ModifierKey::SHIFT, ModifierKey::CONTROL, ModifierKey::ALT};
+
+      private:
+        std::unique_ptr<KeyStateProvider> m_key_state_provider{};
         std::vector<const wchar_t*> m_active_window_classes{};
-        std::unordered_map<ModifierKey, bool> m_modifier_keys_down{};
         bool m_any_keys_are_down{};
         bool m_activated{false};
         std::array<bool, max_keys> m_key_down{};
 
+        // Only the subscribed keys are polled, the list is rebuilt when the handler's subscriptions change
+        std::vector<Key> m_polled_keys{};
+        uint32_t m_polled_keys_version{};
+        bool m_has_polled_keys{};
+
+        // The focus decision only changes when the foreground window does
+        void* m_last_foreground_window{};
+        bool m_last_foreground_window_is_active{};
+        std::wstring m_window_class_name{};
+
       private:
         /// SAFETY: Only update and return m_input_events
         /// in the process_event function
@@ -26,12 +43,16 @@ namespace RC::Input
       public:
         template <typename... WindowClasses>
         explicit Win32AsyncInputSource(WindowClasses... window_classes)
+            : Win32AsyncInputSource(std::unique_ptr<KeyStateProvider>{std::make_unique<Win32KeyStateProvider>()}, window_classes...)
         {
-            static_assert(std::conjunction<std::is_same<const wchar_t*, WindowClasses>...>::value, "WindowClasses must be of type const wchar_t*");
+        }
 
-            m_modifier_keys_down.emplace(ModifierKey::SHIFT, false);
-            m_modifier_keys_down.emplace(ModifierKey::CONTROL, false);
-            m_modifier_keys_down.emplace(ModifierKey::ALT, false);
+        // Polls through the given provider instead of the Win32 API
+        template <typename... WindowClasses>
+        explicit Win32AsyncInputSource(std::unique_ptr<KeyStateProvider> key_state_provider, WindowClasses... window_classes)
+            : m_key_state_provider(std::move(key_state_provider))
+        {
+            static_assert(std::conjunction<std::is_same<const wchar_t*, WindowClasses>...>::value, "WindowClasses must be of type const wchar_t*");
 
             register_window_classes(window_classes...);
         }
@@ -50,8 +71,8 @@ namespace RC::Input
             register_window_classes(window_classes...);
         }
 
-        auto are_modifier_keys_down(const std::vector<ModifierKey>&) -> bool;
         auto is_program_focused() -> bool;
+        auto update_polled_keys(const Handler& handler) -> void;
 
       public:
         bool is_available() override
@@ -0,0 +1,14 @@
+#pragma once
+
+#include <Input/KeyStateProvider.hpp>
+
+namespace RC::Input
+{
+    class Win32KeyStateProvider : public KeyStateProvider
+    {
+      public:
+        auto is_key_down(int key) -> bool override;
+        auto get_foreground_window() -> void* override;
+        auto get_window_class_name(void* window, std::wstring& class_name) -> bool override;
+    };
+} // namespace RC::Input
@@ -43,5 +43,28 @@ namespace RC::Input
             m_head.store((current_head + 1) % max_buffer, std::memory_order_release);
             return event;
         }
+
+        // head belongs to the consumer
+        // Hands every event that was pending at the time of the call to 'callable' and releases them all with a single store
+        // Events pushed while draining are left for the next call
+        template <typename Callable>
+        auto drain(Callable&& callable) -> unsigned int
+        {
+            auto current_head = m_head.load(std::memory_order_relaxed);
+            auto tail = m_tail.load(std::memory_order_acquire);
+            unsigned int num_drained{};
+            while (current_head != tail)
+            {
+                callable(static_cast<const T&>(m_queue[current_head]));
+                current_head = (current_head + 1) % max_buffer;
+                ++num_drained;
+            }
+
+            if (num_drained > 0)
+            {
+                m_head.store(current_head, std::memory_order_release);
+            }
+            return num_drained;
+        }
     };
 } // namespace RC::Input
@@ -17,32 +17,49 @@ namespace RC::Input
             return;
         }
 
-        std::vector<EventCallbackCallable> callbacks_to_call{};
+        auto& events = m_platform_handler->process_event(this);
 
-        auto events = m_platform_handler->process_event(this);
+        if (m_dispatch_table_is_stale.exchange(false, std::memory_order_acquire))
+        {
+            rebuild_dispatch_table();
+        }
 
+        // The table is held for the whole dispatch so callbacks can register key binds without invalidating it
+        // Nothing is copied or allocated here, every callback is called straight from the table
+        const auto dispatch_table = m_dispatch_table.load(std::memory_order_acquire);
+        if (!dispatch_table)
         {
-            // Lock the event mutex to access the key_set
-            auto event_update_lock = std::lock_guard(m_event_mutex);
-            for (auto& event : events)
+            return;
+        }
+
+        for (const auto& event : events)
+        {
+            for (const auto& entry : dispatch_table->entries[event.key])
             {
-                auto key_set_array = m_key_set.key_data[event.key];
-                for (auto& key_data : key_set_array)
+                if (entry.required_modifier_keys == event.modifier_keys.keys)
                 {
-                    if (key_data.required_modifier_keys == event.modifier_keys)
-                    {
-                        callbacks_to_call.emplace_back(key_data.callback);
-                    }
+                    entry.callback();
                 }
             }
         }
+    }
 
-        // No need to lock the event mutex to call the callbacks
-        // this avoids key registration inside the callback
-        for (const auto& callback : callbacks_to_call)
+    auto Handler::rebuild_dispatch_table() -> void
+    {
+        auto dispatch_table = std::make_shared<DispatchTable>();
         {
-            callback();
+            auto event_update_lock = std::lock_guard(m_event_mutex);
+            for (const auto& [key, key_data_array] : m_key_set.key_data)
+            {
+                auto& entries = dispatch_table->entries[key];
+                entries.reserve(key_data_array.size());
+                for (const auto& key_data : key_data_array)
+                {
+                    entries.emplace_back(DispatchTable::Entry{key_data.required_modifier_keys.keys, key_data.callback});
+                }
+            }
         }
+        m_dispatch_table.store(std::move(dispatch_table), std::memory_order_release);
     }
 
     auto Handler::register_keydown_event(Input::Key key, EventCallbackCallable callback, uint8_t custom_data, void* custom_data2) -> void
@@ -53,6 +70,8 @@ namespace RC::Input
         key_data.custom_data = custom_data;
         key_data.custom_data2 = custom_data2;
         m_subscribed_keys[key] = true;
+        m_subscribed_keys_version.fetch_add(1, std::memory_order_release);
+        m_dispatch_table_is_stale.store(true, std::memory_order_release);
     }
 
     auto Handler::register_keydown_event(
@@ -66,6 +85,8 @@ namespace RC::Input
         key_data.requires_modifier_keys = true;
         key_data.required_modifier_keys = modifier_keys;
         m_subscribed_keys[key] = true;
+        m_subscribed_keys_version.fetch_add(1, std::memory_order_release);
+        m_dispatch_table_is_stale.store(true, std::memory_order_release);
     }
 
     auto Handler::is_keydown_event_registered(Input::Key key) -> bool
@@ -114,16 +135,20 @@ namespace RC::Input
     {
         auto event_update_lock = std::lock_guard(m_event_mutex);
         callback(m_key_set);
+        // The callback may have changed any of the key binds
+        m_dispatch_table_is_stale.store(true, std::memory_order_release);
     }
 
     auto Handler::clear_subscribed_keys() -> void
     {
         m_subscribed_keys.fill(false);
+        m_subscribed_keys_version.fetch_add(1, std::memory_order_release);
     }
 
     auto Handler::clear_subscribed_key(Key k) -> void
     {
         m_subscribed_keys[k] = false;
+        m_subscribed_keys_version.fetch_add(1, std::memory_order_release);
     }
 
     auto Handler::get_allow_input() -> bool
@@ -9,7 +9,10 @@ namespace RC::Input
         if (m_activated)
         {
             m_input_queue.push(event);
-            Output::send<LogLevel::Default>(STR("QueueInputSource::push_input_event: {}"), (int)event.key);
+            if (m_trace_events.load(std::memory_order_relaxed))
+            {
+                Output::send<LogLevel::Verbose>(STR("QueueInputSource::push_input_event: {}\n"), (int)event.key);
+            }
         }
     }
 
@@ -18,17 +21,18 @@ namespace RC::Input
     {
         m_input_events.clear();
 
-        auto event = m_input_queue.pop();
         auto& key_set = handler->get_subscribed_keys();
-        while (event)
-        {
-            Output::send<LogLevel::Default>(STR("QueueInputSource::reveive key event: {}"), (int)event->key);
-            if (key_set[event->key])
+        const auto trace_events = m_trace_events.load(std::memory_order_relaxed);
+        m_input_queue.drain([&](const InputEvent& event) {
+            if (trace_events)
             {
-                m_input_events.emplace_back(*event);
+                Output::send<LogLevel::Verbose>(STR("QueueInputSource::receive key event: {}\n"), (int)event.key);
             }
-            event = m_input_queue.pop();
-        }
+            if (key_set[event.key])
+            {
+                m_input_events.emplace_back(event);
+            }
+        });
 
         if (!m_activated)
         {
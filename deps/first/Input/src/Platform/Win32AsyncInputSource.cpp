@@ -3,26 +3,54 @@
 #include <Input/Common.hpp>
 #include <Input/Platform/Win32AsyncInputSource.hpp>
 
-#define NOMINMAX
-#include <Windows.h>
-
 namespace RC::Input
 {
 
     auto Win32AsyncInputSource::is_program_focused() -> bool
     {
-        HWND hwnd = GetForegroundWindow();
-        if (!hwnd) return false;
-        wchar_t current_window_class_name[MAX_PATH];
-        if (!GetClassNameW(hwnd, current_window_class_name, MAX_PATH)) return false;
+        void* foreground_window = m_key_state_provider->get_foreground_window();
+        if (!foreground_window) return false;
+
+        // A window's class never changes so the class name only has to be looked up when focus moves to another window
+        if (foreground_window == m_last_foreground_window)
+        {
+            return m_last_foreground_window_is_active;
+        }
+
+        if (!m_key_state_provider->get_window_class_name(foreground_window, m_window_class_name)) return false;
+
+        m_last_foreground_window = foreground_window;
+        m_last_foreground_window_is_active = false;
         for (const auto& active_window_class : m_active_window_classes)
         {
-            if (wcscmp(current_window_class_name, active_window_class) == 0)
+            if (m_window_class_name == active_window_class)
+            {
+                m_last_foreground_window_is_active = true;
+                break;
+            }
+        }
+        return m_last_foreground_window_is_active;
+    }
+
+    auto Win32AsyncInputSource::update_polled_keys(const Handler& handler) -> void
+    {
+        const auto subscribed_keys_version = handler.get_subscribed_keys_version();
+        if (m_has_polled_keys && subscribed_keys_version == m_polled_keys_version)
+        {
+            return;
+        }
+
+        m_polled_keys.clear();
+        auto& subscribed_keys = handler.get_subscribed_keys();
+        for (int key = 0; key < max_keys; ++key)
+        {
+            if (subscribed_keys[key])
             {
-                return true;
+                m_polled_keys.emplace_back(static_cast<Key>(key));
             }
         }
-        return false;
+        m_polled_keys_version = subscribed_keys_version;
+        m_has_polled_keys = true;
     }
 
     std::vector<InputEvent>& Win32AsyncInputSource::process_event(Handler* handler)
@@ -50,36 +78,28 @@ namespace RC::Input
 
         // Check if any modifier keys are down
         ModifierKeys modifier_keys{};
-        for (auto& [modifier_key, key_is_down] : m_modifier_keys_down)
+        for (const auto modifier_key : polled_modifier_keys)
         {
-            if (GetAsyncKeyState(modifier_key))
+            if (m_key_state_provider->is_key_down(modifier_key))
             {
                 modifier_keys |= modifier_key;
-                key_is_down = true;
-            }
-            else
-            {
-                key_is_down = false;
             }
         }
 
-        auto& subscribed_keys = handler->get_subscribed_keys();
+        update_polled_keys(*handler);
 
-        for (int key = 0; key < max_keys; ++key)
+        for (const auto key : m_polled_keys)
         {
-            if (subscribed_keys[key])
+            auto keyed = m_key_state_provider->is_key_down(key);
+            if (keyed && !m_key_down[key])
+            {
+                any_keys_are_down = true;
+                m_key_down[key] = true;
+                m_input_events.emplace_back(InputEvent{key, modifier_keys});
+            }
+            else if (!keyed && m_key_down[key])
             {
-                auto keyed = GetAsyncKeyState(key);
-                if (keyed && !m_key_down[key])
-                {
-                    any_keys_are_down = true;
-                    m_key_down[key] = true;
-                    m_input_events.emplace_back(InputEvent{static_cast<Key>(key), modifier_keys});
-                }
-                else if (!keyed && m_key_down[key])
-                {
-                    m_key_down[key] = false;
-                }
+                m_key_down[key] = false;
             }
         }
 
@@ -0,0 +1,29 @@
+#include <Input/Platform/Win32KeyStateProvider.hpp>
+
+#define NOMINMAX
+#include <Windows.h>
+
+namespace RC::Input
+{
+    auto Win32KeyStateProvider::is_key_down(int key) -> bool
+    {
+        return GetAsyncKeyState(key) != 0;
+    }
+
+    auto Win32KeyStateProvider::get_foreground_window() -> void*
+    {
+        return GetForegroundWindow();
+    }
+
+    auto Win32KeyStateProvider::get_window_class_name(void* window, std::wstring& class_name) -> bool
+    {
+        wchar_t window_class_name[MAX_PATH];
+        const auto length = GetClassNameW(static_cast<HWND>(window), window_class_name, MAX_PATH);
+        if (length == 0)
+        {
+            return false;
+        }
+        class_name.assign(window_class_name, length);
+        return true;
+    }
+} // namespace RC::Input
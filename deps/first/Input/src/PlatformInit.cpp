@@ -6,7 +6,9 @@ namespace RC::Input
 {
     auto Handler::init() -> void
     {
+#ifdef _WIN32
         register_input_source(std::make_shared<Win32AsyncInputSource>(L"ConsoleWindowClass", L"UnrealWindow"));
+#endif
         register_input_source(std::make_shared<GLFW3InputSource>());
     }
 } // namespace RC::Input
\ No newline at end of file
@@ -0,0 +1,96 @@
+#include <memory>
+
+#include <Input/Handler.hpp>
+#include <Input/Platform/QueueInputSource.hpp>
+#include <Input/Platform/Win32AsyncInputSource.hpp>
+#include <TestHarness/TestHarness.hpp>
+
+#include "MockKeyStateProvider.hpp"
+
+using namespace RC;
+using namespace RC::TestHarness;
+
+// Cost of one Win32AsyncInputSource poll, the game thread pays it every frame
+// With every key subscribed the source polls as many keys as it did before it only polled the subscribed ones
+static auto bench_polling() -> void
+{
+    constexpr size_t num_iterations = 100'000;
+    static int unreal_window{};
+
+    auto poll = [&](const char* name, int num_subscribed_keys) {
+        Input::Handler handler{};
+        for (int key = 1; key <= num_subscribed_keys; ++key)
+        {
+            handler.register_keydown_event(static_cast<Input::Key>(key), [] {});
+        }
+
+        auto provider = new MockKeyStateProvider{};
+        provider->foreground_window = &unreal_window;
+        provider->foreground_window_class_name = L"UnrealWindow";
+        Input::Win32AsyncInputSource source{std::unique_ptr<Input::KeyStateProvider>{provider}, L"UnrealWindow"};
+        source.activate();
+
+        benchmark(name, num_iterations, [&] {
+            do_not_optimize(source.process_event(&handler));
+        });
+        CHECK(provider->num_class_name_calls == 1);
+    };
+
+    poll("Win32AsyncInputSource::process_event, 10 subscribed keys", 10);
+    poll("Win32AsyncInputSource::process_event, every key subscribed", Input::max_keys - 1);
+}
+
+// Cost of dispatching the events of one frame to the registered key binds, mods register hundreds of them
+static auto bench_dispatch() -> void
+{
+    constexpr size_t num_iterations = 100'000;
+    constexpr int num_keys = 40;
+    constexpr int binds_per_key = 15;
+
+    Input::Handler handler{};
+    handler.init();
+    CHECK(handler.set_input_source("GLFW3"));
+    auto queue_input_source = std::dynamic_pointer_cast<Input::QueueInputSource>(Input::Handler::get_input_source("GLFW3"));
+
+    size_t num_calls{};
+    for (int key = 0; key < num_keys; ++key)
+    {
+        for (int bind = 0; bind < binds_per_key; ++bind)
+        {
+            // A third of the binds need CTRL and don't fire for the events below
+            if (bind % 3 == 0)
+            {
+                handler.register_keydown_event(static_cast<Input::Key>(Input::Key::A + key), {Input::ModifierKey::CONTROL}, [&] {
+                    ++num_calls;
+                });
+            }
+            else
+            {
+                handler.register_keydown_event(static_cast<Input::Key>(Input::Key::A + key), [&] {
+                    ++num_calls;
+                });
+            }
+        }
+    }
+
+    benchmark("Handler::process_event, 600 binds, 3 events", num_iterations, [&] {
+        queue_input_source->push_input_event({Input::Key::A});
+        queue_input_source->push_input_event({Input::Key::F1});
+        queue_input_source->push_input_event({static_cast<Input::Key>(Input::Key::A + 20)});
+        handler.process_event();
+    });
+    // F1 has no binds, the other two events each call the ten binds without modifiers
+    CHECK(num_calls % 20 == 0);
+    num_calls = 0;
+    queue_input_source->push_input_event({Input::Key::A});
+    handler.process_event();
+    CHECK(num_calls == 10);
+}
+
+int main()
+{
+    bench_polling();
+    bench_dispatch();
+
+    return report();
+}
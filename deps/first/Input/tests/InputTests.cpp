@@ -0,0 +1,131 @@
+#include <memory>
+
+#include <Input/Handler.hpp>
+#include <Input/Platform/Win32AsyncInputSource.hpp>
+#include <TestHarness/TestHarness.hpp>
+
+#include "MockKeyStateProvider.hpp"
+
+using namespace RC;
+
+static int unreal_window{};
+static int other_window{};
+
+struct PolledSource
+{
+    MockKeyStateProvider* provider{};
+    std::unique_ptr<Input::Win32AsyncInputSource> source{};
+};
+
+static auto make_polled_source() -> PolledSource
+{
+    auto provider = new MockKeyStateProvider{};
+    provider->foreground_window = &unreal_window;
+    provider->foreground_window_class_name = L"UnrealWindow";
+    auto source = std::make_unique<Input::Win32AsyncInputSource>(std::unique_ptr<Input::KeyStateProvider>{provider}, L"ConsoleWindowClass", L"UnrealWindow");
+    source->activate();
+    return {provider, std::move(source)};
+}
+
+static auto test_key_presses() -> void
+{
+    Input::Handler handler{};
+    handler.register_keydown_event(Input::Key::A, [] {});
+    auto [provider, source] = make_polled_source();
+
+    CHECK(source->process_event(&handler).empty());
+
+    // A new press is reported once with the modifiers that are held
+    provider->keys_down[Input::Key::A] = true;
+    provider->keys_down[Input::ModifierKey::CONTROL] = true;
+    auto& events = source->process_event(&handler);
+    CHECK(events.size() == 1);
+    CHECK(events[0].key == Input::Key::A);
+    CHECK(events[0].modifier_keys == Input::ModifierKeys{Input::ModifierKey::CONTROL});
+
+    // Holding the key doesn't repeat it
+    CHECK(source->process_event(&handler).empty());
+    CHECK(source->process_event(&handler).empty());
+
+    provider->keys_down[Input::Key::A] = false;
+    CHECK(source->process_event(&handler).empty());
+    provider->keys_down[Input::Key::A] = true;
+    CHECK(source->process_event(&handler).size() == 1);
+
+    // Keys without a key bind are never reported
+    provider->keys_down[Input::Key::B] = true;
+    provider->keys_down[Input::Key::A] = false;
+    CHECK(source->process_event(&handler).empty());
+    CHECK(source->process_event(&handler).empty());
+
+    // Presses while input is disallowed are dropped
+    handler.set_allow_input(false);
+    provider->keys_down[Input::Key::A] = true;
+    CHECK(source->process_event(&handler).empty());
+}
+
+static auto test_only_subscribed_keys_are_polled() -> void
+{
+    Input::Handler handler{};
+    handler.register_keydown_event(Input::Key::A, [] {});
+    handler.register_keydown_event(Input::Key::F1, [] {});
+    auto [provider, source] = make_polled_source();
+
+    // The three modifier keys plus every subscribed key
+    source->process_event(&handler);
+    CHECK(provider->num_key_state_calls == 5);
+
+    // A new key bind is polled from the next frame on
+    handler.register_keydown_event(Input::Key::B, [] {});
+    provider->num_key_state_calls = 0;
+    provider->keys_down[Input::Key::B] = true;
+    CHECK(source->process_event(&handler).size() == 1);
+    CHECK(provider->num_key_state_calls == 6);
+
+    handler.clear_subscribed_key(Input::Key::B);
+    provider->num_key_state_calls = 0;
+    source->process_event(&handler);
+    CHECK(provider->num_key_state_calls == 5);
+}
+
+static auto test_focus() -> void
+{
+    Input::Handler handler{};
+    handler.register_keydown_event(Input::Key::A, [] {});
+    auto [provider, source] = make_polled_source();
+    provider->keys_down[Input::Key::A] = true;
+
+    // Nothing is polled without a focused window
+    provider->foreground_window = nullptr;
+    CHECK(source->process_event(&handler).empty());
+    CHECK(provider->num_key_state_calls == 0);
+
+    // Nor when a window of another class has focus, its class is only looked up once
+    provider->foreground_window = &other_window;
+    provider->foreground_window_class_name = L"Notepad";
+    CHECK(source->process_event(&handler).empty());
+    CHECK(source->process_event(&handler).empty());
+    CHECK(provider->num_key_state_calls == 0);
+    CHECK(provider->num_class_name_calls == 1);
+
+    provider->foreground_window = &unreal_window;
+    provider->foreground_window_class_name = L"UnrealWindow";
+    CHECK(source->process_event(&handler).size() == 1);
+    CHECK(provider->num_class_name_calls == 2);
+
+    // Deactivated sources report nothing
+    source->deactivate();
+    provider->keys_down[Input::Key::A] = false;
+    source->process_event(&handler);
+    provider->keys_down[Input::Key::A] = true;
+    CHECK(source->process_event(&handler).empty());
+}
+
+int main()
+{
+    test_key_presses();
+    test_only_subscribed_keys_are_polled();
+    test_focus();
+
+    return RC::TestHarness::report();
+}
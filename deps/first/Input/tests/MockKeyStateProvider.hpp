@@ -0,0 +1,37 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <string>
+
+#include <Input/KeyStateProvider.hpp>
+
+// Stands in for the Win32 API so Win32AsyncInputSource can be polled on every platform
+class MockKeyStateProvider : public RC::Input::KeyStateProvider
+{
+  public:
+    std::array<bool, 0x100> keys_down{};
+    void* foreground_window{};
+    std::wstring foreground_window_class_name{};
+    size_t num_key_state_calls{};
+    size_t num_class_name_calls{};
+
+  public:
+    auto is_key_down(int key) -> bool override
+    {
+        ++num_key_state_calls;
+        return keys_down[key];
+    }
+
+    auto get_foreground_window() -> void* override
+    {
+        return foreground_window;
+    }
+
+    auto get_window_class_name(void*, std::wstring& class_name) -> bool override
+    {
+        ++num_class_name_calls;
+        class_name = foreground_window_class_name;
+        return true;
+    }
+};
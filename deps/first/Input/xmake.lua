@@ -19,6 +19,7 @@ target(projectName)
     if is_plat("windows") then
         if get_config("ue4ssInput") then
             add_files("src/Platform/Win32AsyncInputSource.cpp")
+            add_files("src/Platform/Win32KeyStateProvider.cpp")
             add_files("src/Platform/GLFW3InputSource.cpp")
             add_files("src/Platform/QueueInputSource.cpp")
         end
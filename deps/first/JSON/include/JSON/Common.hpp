@@ -1,5 +1,12 @@
 #pragma once
 
+// Only Windows builds export and import symbols
+#ifndef _WIN32
+#ifndef RC_JSON_API
+#define RC_JSON_API
+#endif
+#endif
+
 #ifndef RC_JSON_EXPORTS
 #ifndef RC_JSON_BUILD_STATIC
 #ifndef RC_JSON_API
@@ -0,0 +1,384 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <Constructs/Loop.hpp>
+#include <File/File.hpp>
+#include <File/Macros.hpp>
+#include <Helpers/String.hpp>
+#include <JSON/Common.hpp>
+#include <JSON/Value.hpp>
+
+#include <fmt/core.h>
+#include <fmt/xchar.h>
+
+/*
+    Read-only JSON DOM backed by a single arena
+
+    Every value of a document lives in one arena owned by the Document, and strings are views into the input buffer
+    Only strings that contain escape sequences are copied, they're decoded into the arena
+    UTF-8 files are parsed from the mapping as well, but their strings are always decoded into the arena
+    The accessor API mirrors JSON::Object / JSON::Array so code reading a parsed file can switch between the two with minimal changes
+
+    auto document = JSON::Dom::parse(file.read_all_view());
+    auto& root = document.get_root();
+    auto name = root.get<JSON::Dom::String>(STR("Name")).get_view();
+*/
+
+namespace RC::JSON::Dom
+{
+    class Arena
+    {
+      public:
+        constexpr static size_t block_size = 0x10000;
+
+      private:
+        std::vector<std::unique_ptr<std::byte[]>> m_blocks{};
+        std::byte* m_current{};
+        size_t m_remaining{};
+
+      public:
+        Arena() = default;
+        Arena(const Arena&) = delete;
+        Arena(Arena&&) noexcept = default;
+        auto operator=(const Arena&) -> Arena& = delete;
+        auto operator=(Arena&&) noexcept -> Arena& = default;
+
+      public:
+        RC_JSON_API auto allocate(size_t size, size_t alignment) -> void*;
+
+        // Only trivially destructible types can be stored because the arena never runs destructors
+        template <typename T, typename... Args>
+        auto create(Args&&... args) -> T*
+        {
+            static_assert(std::is_trivially_destructible_v<T>, "Types stored in a JSON::Dom::Arena must be trivially destructible");
+            return new (allocate(sizeof(T), alignof(T))) T{std::forward<Args>(args)...};
+        }
+
+        template <typename T>
+        auto create_array(size_t count) -> T*
+        {
+            static_assert(std::is_trivially_destructible_v<T>, "Types stored in a JSON::Dom::Arena must be trivially destructible");
+            if (count == 0)
+            {
+                return nullptr;
+            }
+            return static_cast<T*>(allocate(sizeof(T) * count, alignof(T)));
+        }
+    };
+
+    class Value
+    {
+      private:
+        Type m_type;
+
+      protected:
+        explicit Value(Type type) : m_type(type)
+        {
+        }
+
+      public:
+        auto get_type() const -> Type
+        {
+            return m_type;
+        }
+
+        template <typename T>
+        auto is() const -> bool
+        {
+            return m_type == T::static_type;
+        }
+
+        template <typename T>
+        auto as() const -> const T*
+        {
+            return static_cast<const T*>(this);
+        }
+        template <typename T>
+        auto as() -> T*
+        {
+            return static_cast<T*>(this);
+        }
+    };
+
+    class Null : public Value
+    {
+      public:
+        constexpr static Type static_type = Type::Null;
+
+      public:
+        Null() : Value(static_type)
+        {
+        }
+    };
+
+    class Bool : public Value
+    {
+      public:
+        constexpr static Type static_type = Type::Bool;
+
+      private:
+        bool m_underlying_value{};
+
+      public:
+        explicit Bool(bool value) : Value(static_type), m_underlying_value(value)
+        {
+        }
+
+      public:
+        auto get() const -> bool
+        {
+            return m_underlying_value;
+        }
+    };
+
+    class Number : public Value
+    {
+      public:
+        constexpr static Type static_type = Type::Number;
+
+      private:
+        union {
+            int64_t m_integer;
+            double m_double;
+        };
+        bool m_is_integer{};
+
+      public:
+        explicit Number(int64_t value) : Value(static_type), m_integer(value), m_is_integer(true)
+        {
+        }
+        explicit Number(double value) : Value(static_type), m_double(value), m_is_integer(false)
+        {
+        }
+
+      public:
+        auto is_integer() const -> bool
+        {
+            return m_is_integer;
+        }
+
+        // Converts to the requested type, integers that were written with a fraction or exponent are truncated
+        template <typename NumberType>
+        auto get() const -> NumberType
+        {
+            static_assert(std::is_arithmetic_v<NumberType>, "JSON::Dom::Number::get requires an arithmetic type");
+            return m_is_integer ? static_cast<NumberType>(m_integer) : static_cast<NumberType>(m_double);
+        }
+    };
+
+    class String : public Value
+    {
+      public:
+        constexpr static Type static_type = Type::String;
+
+      private:
+        const CharType* m_data{};
+        size_t m_size{};
+
+      public:
+        explicit String(StringViewType view) : Value(static_type), m_data(view.data()), m_size(view.size())
+        {
+        }
+
+      public:
+        auto get_view() const -> StringViewType
+        {
+            return StringViewType{m_data, m_size};
+        }
+        auto get() const -> StringType
+        {
+            return StringType{get_view()};
+        }
+    };
+
+    template <typename F>
+    concept CallableWithIndex = std::invocable<F&, size_t, Value&>;
+
+    template <typename F>
+    concept CallableWithoutIndex = std::invocable<F&, Value&>;
+
+    class Array : public Value
+    {
+      public:
+        constexpr static Type static_type = Type::Array;
+
+      private:
+        Value** m_elements{};
+        size_t m_size{};
+
+      public:
+        Array(Value** elements, size_t size) : Value(static_type), m_elements(elements), m_size(size)
+        {
+        }
+
+      public:
+        auto size() const -> size_t
+        {
+            return m_size;
+        }
+        auto empty() const -> bool
+        {
+            return m_size == 0;
+        }
+        auto operator[](size_t index) const -> Value&
+        {
+            return *m_elements[index];
+        }
+        auto begin() const -> Value* const*
+        {
+            return m_elements;
+        }
+        auto end() const -> Value* const*
+        {
+            return m_elements + m_size;
+        }
+
+        template <typename Callable>
+        auto for_each(Callable callable) const -> void
+        {
+            static_assert(CallableWithIndex<Callable> || CallableWithoutIndex<Callable>, "Callable must have params Value&, or size_t and Value&");
+            for (size_t i = 0; i < m_size; ++i)
+            {
+                if constexpr (CallableWithIndex<Callable>)
+                {
+                    if (callable(i, *m_elements[i]) == LoopAction::Break)
+                    {
+                        break;
+                    }
+                }
+                else
+                {
+                    if (callable(*m_elements[i]) == LoopAction::Break)
+                    {
+                        break;
+                    }
+                }
+            }
+        }
+    };
+
+    struct Member
+    {
+        const CharType* key_data;
+        size_t key_size;
+        Value* value;
+
+        auto get_key() const -> StringViewType
+        {
+            return StringViewType{key_data, key_size};
+        }
+    };
+
+    class Object : public Value
+    {
+      public:
+        constexpr static Type static_type = Type::Object;
+
+      private:
+        Member* m_members{};
+        size_t m_size{};
+
+      public:
+        Object(Member* members, size_t size) : Value(static_type), m_members(members), m_size(size)
+        {
+        }
+
+      public:
+        auto size() const -> size_t
+        {
+            return m_size;
+        }
+        auto empty() const -> bool
+        {
+            return m_size == 0;
+        }
+        auto begin() const -> const Member*
+        {
+            return m_members;
+        }
+        auto end() const -> const Member*
+        {
+            return m_members + m_size;
+        }
+
+        // Members are kept in document order, if a key is duplicated then the last one wins like it does in JSON::Object
+        auto find(StringViewType key) const -> Value*
+        {
+            for (size_t i = m_size; i > 0; --i)
+            {
+                if (m_members[i - 1].get_key() == key)
+                {
+                    return m_members[i - 1].value;
+                }
+            }
+            return nullptr;
+        }
+
+        auto contains(StringViewType key) const -> bool
+        {
+            return find(key) != nullptr;
+        }
+
+        template <typename ValueType>
+        auto get(StringViewType key) const -> ValueType&
+        {
+            auto value = find(key);
+            if (!value)
+            {
+                throw std::runtime_error{to_string(fmt::format(STR("No key in JSON object with name {}"), key))};
+            }
+            if (!value->is<ValueType>())
+            {
+                throw std::runtime_error{to_string(fmt::format(STR("Value for key {} in JSON object has the wrong type"), key))};
+            }
+            return *value->as<ValueType>();
+        }
+    };
+
+    class Document
+    {
+      private:
+        // Heap allocated so that string views stay valid when the document is moved
+        std::unique_ptr<StringType> m_input{};
+        // Set instead of 'm_input' when the values view the mapped file directly
+        File::FileView m_mapped_input{};
+        Arena m_arena{};
+        Object* m_root{};
+
+      public:
+        Document(std::unique_ptr<StringType> input, Arena arena, Object* root) : m_input(std::move(input)), m_arena(std::move(arena)), m_root(root)
+        {
+        }
+        Document(File::FileView mapped_input, Arena arena, Object* root) : m_mapped_input(std::move(mapped_input)), m_arena(std::move(arena)), m_root(root)
+        {
+        }
+
+      public:
+        auto get_root() const -> Object&
+        {
+            return *m_root;
+        }
+        auto operator->() const -> Object*
+        {
+            return m_root;
+        }
+    };
+
+    /**
+     * Parses a JSON document whose root is an object.
+     * Throws std::runtime_error with the line and column of the first error if the input isn't valid JSON.
+     * Trailing commas and unknown escape sequences (kept verbatim) are accepted for compatibility with hand-written config files.
+     */
+    RC_JSON_API auto parse(StringType input) -> Document;
+    RC_JSON_API auto parse(const File::Handle&) -> Document;
+    // The document keeps the view alive and its strings point straight into the mapping when it's stored in the native encoding
+    // UTF-8 files are decoded while they're parsed, anything else is converted with FileView::to_string first
+    RC_JSON_API auto parse(File::FileView) -> Document;
+} // namespace RC::JSON::Dom
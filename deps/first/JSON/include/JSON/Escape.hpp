@@ -0,0 +1,11 @@
+#pragma once
+
+#include <JSON/Common.hpp>
+
+#include <String/StringType.hpp>
+
+namespace RC::JSON
+{
+    // Appends 'string' to 'buffer' as a quoted JSON string
+    RC_JSON_API auto append_escaped(StringType& buffer, StringViewType string) -> void;
+} // namespace RC::JSON
@@ -12,4 +12,6 @@ namespace RC::JSON::Parser
 {
     RC_JSON_API auto parse(StringType& input) -> std::unique_ptr<JSON::Object>;
     RC_JSON_API auto parse(const File::Handle&) -> std::unique_ptr<JSON::Object>;
+    // Tokenizes straight from the mapped file when it's stored in the native encoding, otherwise it's decoded once first
+    RC_JSON_API auto parse(const File::FileView&) -> std::unique_ptr<JSON::Object>;
 } // namespace RC::JSON::Parser
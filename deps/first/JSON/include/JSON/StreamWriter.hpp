@@ -0,0 +1,119 @@
+#pragma once
+
+#include <cmath>
+#include <concepts>
+#include <filesystem>
+#include <iterator>
+#include <vector>
+
+#include <File/File.hpp>
+#include <JSON/Common.hpp>
+#include <JSON/Escape.hpp>
+#include <JSON/Value.hpp>
+
+#include <fmt/core.h>
+#include <fmt/xchar.h>
+
+namespace RC::JSON
+{
+    template <typename SupposedStreamNumber>
+    concept StreamNumber = (std::integral<SupposedStreamNumber> || std::floating_point<SupposedStreamNumber>) && !std::is_same_v<SupposedStreamNumber, bool>;
+
+    /*
+        Forward-only JSON writer
+        Values are written to the file as soon as they are added, the file handle buffers them so that the file is written to in large chunks
+        Nothing is kept in memory except the current nesting, object members are written in the order they are added
+        Non-finite numbers are written as null, JSON has no representation for them
+
+        writer.begin_object();
+        writer.string(STR("name"), STR("value"));
+        writer.begin_array(STR("items"));
+        writer.number(1);
+        writer.end_array();
+        writer.end_object();
+        writer.finish();
+    */
+    class RC_JSON_API StreamWriter
+    {
+      private:
+        struct Scope
+        {
+            bool is_object{};
+            bool has_members{};
+        };
+
+      public:
+        constexpr static size_t write_buffer_size = 0x10000;
+
+      private:
+        File::Handle m_file;
+        // The text of the value that's being written, passed to 'm_file' once the value is complete
+        StringType m_buffer{};
+        std::vector<Scope> m_scopes{};
+        ShouldFormat m_should_format{};
+        bool m_has_pending_key{};
+        bool m_has_root_value{};
+
+      public:
+        StreamWriter(const std::filesystem::path& file_path, ShouldFormat should_format = ShouldFormat::Yes);
+        // Writes everything that's been added so far, use 'finish' to find out whether it was written and the document is complete
+        ~StreamWriter();
+
+        // Explicitly making the class non-copyable to enable dllexport
+        StreamWriter(const StreamWriter&) = delete;
+        auto operator=(const StreamWriter&) -> StreamWriter& = delete;
+
+      public:
+        auto begin_object() -> void;
+        auto begin_object(StringViewType key) -> void;
+        auto end_object() -> void;
+
+        auto begin_array() -> void;
+        auto begin_array(StringViewType key) -> void;
+        auto end_array() -> void;
+
+        // Starts an object member, must be followed by exactly one value, object or array
+        auto key(StringViewType key) -> void;
+
+        auto string(StringViewType value) -> void;
+        auto string(StringViewType key, StringViewType value) -> void;
+        auto boolean(bool value) -> void;
+        auto boolean(StringViewType key, bool value) -> void;
+        auto null() -> void;
+        auto null(StringViewType key) -> void;
+
+        template <StreamNumber NumberType>
+        auto number(NumberType value) -> void
+        {
+            if constexpr (std::floating_point<NumberType>)
+            {
+                if (!std::isfinite(value))
+                {
+                    null();
+                    return;
+                }
+            }
+            write_value_prefix();
+            fmt::format_to(std::back_inserter(m_buffer), STR("{}"), value);
+            write_buffer();
+        }
+
+        template <StreamNumber NumberType>
+        auto number(StringViewType key_name, NumberType value) -> void
+        {
+            key(key_name);
+            number(value);
+        }
+
+        // Flushes everything that's been written so far, throws if any object or array is still open
+        auto finish() -> void;
+        auto flush() -> void;
+
+      private:
+        auto write_buffer() -> void;
+        auto write_value_prefix() -> void;
+        auto write_newline_and_indent() -> void;
+        auto begin_scope(bool is_object, CharType open_char) -> void;
+        auto end_scope(bool is_object, CharType close_char) -> void;
+    };
+} // namespace RC::JSON
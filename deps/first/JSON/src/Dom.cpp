@@ -0,0 +1,552 @@
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <format>
+#include <stdexcept>
+#include <type_traits>
+
+#include <JSON/Dom.hpp>
+
+namespace RC::JSON::Dom
+{
+    auto Arena::allocate(size_t size, size_t alignment) -> void*
+    {
+        auto padding = (alignment - (reinterpret_cast<uintptr_t>(m_current) & (alignment - 1))) & (alignment - 1);
+        if (!m_current || padding + size > m_remaining)
+        {
+            // Allocations that don't fit in a regular block get a block of their own
+            auto new_block_size = std::max(block_size, size + alignment);
+            m_current = m_blocks.emplace_back(std::make_unique<std::byte[]>(new_block_size)).get();
+            m_remaining = new_block_size;
+            padding = (alignment - (reinterpret_cast<uintptr_t>(m_current) & (alignment - 1))) & (alignment - 1);
+        }
+
+        auto allocation = m_current + padding;
+        m_current = allocation + size;
+        m_remaining -= padding + size;
+        return allocation;
+    }
+
+    namespace Internal
+    {
+        // 'SourceChar' is CharType for native text and char for UTF-8 text, which is decoded into the arena as it's read
+        template <typename SourceChar>
+        class DomParser
+        {
+          private:
+            // Deep enough for any real config file while keeping the recursion far away from the end of the stack
+            constexpr static size_t max_depth = 512;
+
+          private:
+            const SourceChar* m_begin;
+            const SourceChar* m_cursor;
+            const SourceChar* m_end;
+            Arena& m_arena;
+            // Scratch stacks shared by all nesting levels, finished containers are copied into the arena as one contiguous block
+            std::vector<Value*> m_element_stack{};
+            std::vector<Member> m_member_stack{};
+            size_t m_depth{};
+
+          public:
+            DomParser(std::basic_string_view<SourceChar> input, Arena& arena) : m_begin(input.data()), m_cursor(input.data()), m_end(input.data() + input.size()), m_arena(arena)
+            {
+            }
+
+          public:
+            auto parse_document() -> Object*
+            {
+                // Skip a byte order mark if the input still has one, FileView has already stripped it from UTF-8 text
+                if constexpr (std::is_same_v<SourceChar, CharType>)
+                {
+                    if (m_cursor != m_end && *m_cursor == 0xFEFF)
+                    {
+                        ++m_cursor;
+                    }
+                }
+
+                skip_whitespace();
+                expect(STR('{'), "'{' at the start of the document");
+                auto root = parse_object();
+                skip_whitespace();
+                if (m_cursor != m_end)
+                {
+                    error("end of input after the root object");
+                }
+                return root;
+            }
+
+          private:
+            [[noreturn]] auto error(std::string_view expected) const -> void
+            {
+                size_t line{1};
+                size_t column{1};
+                for (auto c = m_begin; c < m_cursor && c < m_end; ++c)
+                {
+                    if (*c == STR('\n'))
+                    {
+                        ++line;
+                        column = 1;
+                    }
+                    else
+                    {
+                        ++column;
+                    }
+                }
+
+                auto message = std::format("Syntax error! ({} : {}): Expected {}", line, column, expected);
+                if (m_cursor < m_end)
+                {
+                    if constexpr (std::is_same_v<SourceChar, CharType>)
+                    {
+                        message.append(std::format(", got '{}'", to_string(StringViewType{m_cursor, 1})));
+                    }
+                    else
+                    {
+                        message.append(std::format(", got '{}'", *m_cursor));
+                    }
+                }
+                else
+                {
+                    message.append(", got end of input");
+                }
+                throw std::runtime_error{message};
+            }
+
+            auto skip_whitespace() -> void
+            {
+                while (m_cursor != m_end && (*m_cursor == STR(' ') || *m_cursor == STR('\n') || *m_cursor == STR('\r') || *m_cursor == STR('\t')))
+                {
+                    ++m_cursor;
+                }
+            }
+
+            auto expect(CharType c, std::string_view expected) -> void
+            {
+                if (m_cursor == m_end || *m_cursor != c)
+                {
+                    error(expected);
+                }
+                ++m_cursor;
+            }
+
+            auto enter_scope() -> void
+            {
+                if (++m_depth > max_depth)
+                {
+                    error("less deeply nested objects and arrays");
+                }
+            }
+
+            auto parse_value() -> Value*
+            {
+                skip_whitespace();
+                if (m_cursor == m_end)
+                {
+                    error("a value");
+                }
+
+                switch (*m_cursor)
+                {
+                case STR('{'):
+                    ++m_cursor;
+                    return parse_object();
+                case STR('['):
+                    ++m_cursor;
+                    return parse_array();
+                case STR('"'):
+                    ++m_cursor;
+                    return m_arena.create<String>(parse_string());
+                case STR('t'):
+                    parse_literal("true");
+                    return m_arena.create<Bool>(true);
+                case STR('f'):
+                    parse_literal("false");
+                    return m_arena.create<Bool>(false);
+                case STR('n'):
+                    parse_literal("null");
+                    return m_arena.create<Null>();
+                default:
+                    return parse_number();
+                }
+            }
+
+            auto parse_literal(std::string_view literal) -> void
+            {
+                if (static_cast<size_t>(m_end - m_cursor) < literal.size() || !std::equal(literal.begin(), literal.end(), m_cursor))
+                {
+                    error("a value");
+                }
+                m_cursor += literal.size();
+            }
+
+            auto parse_object() -> Object*
+            {
+                enter_scope();
+                auto stack_start = m_member_stack.size();
+
+                skip_whitespace();
+                while (m_cursor != m_end && *m_cursor != STR('}'))
+                {
+                    expect(STR('"'), "'\"' at the start of a key");
+                    auto key = parse_string();
+                    skip_whitespace();
+                    expect(STR(':'), "':' after a key");
+                    auto value = parse_value();
+                    m_member_stack.emplace_back(Member{key.data(), key.size(), value});
+
+                    skip_whitespace();
+                    if (m_cursor != m_end && *m_cursor == STR(','))
+                    {
+                        ++m_cursor;
+                        skip_whitespace();
+                    }
+                    else if (m_cursor == m_end || *m_cursor != STR('}'))
+                    {
+                        error("',' or '}' after an object member");
+                    }
+                }
+                expect(STR('}'), "'}' at the end of an object");
+
+                auto num_members = m_member_stack.size() - stack_start;
+                auto members = m_arena.create_array<Member>(num_members);
+                std::copy(m_member_stack.begin() + stack_start, m_member_stack.end(), members);
+                m_member_stack.resize(stack_start);
+
+                --m_depth;
+                return m_arena.create<Object>(members, num_members);
+            }
+
+            auto parse_array() -> Array*
+            {
+                enter_scope();
+                auto stack_start = m_element_stack.size();
+
+                skip_whitespace();
+                while (m_cursor != m_end && *m_cursor != STR(']'))
+                {
+                    m_element_stack.emplace_back(parse_value());
+
+                    skip_whitespace();
+                    if (m_cursor != m_end && *m_cursor == STR(','))
+                    {
+                        ++m_cursor;
+                        skip_whitespace();
+                    }
+                    else if (m_cursor == m_end || *m_cursor != STR(']'))
+                    {
+                        error("',' or ']' after an array element");
+                    }
+                }
+                expect(STR(']'), "']' at the end of an array");
+
+                auto num_elements = m_element_stack.size() - stack_start;
+                auto elements = m_arena.create_array<Value*>(num_elements);
+                std::copy(m_element_stack.begin() + stack_start, m_element_stack.end(), elements);
+                m_element_stack.resize(stack_start);
+
+                --m_depth;
+                return m_arena.create<Array>(elements, num_elements);
+            }
+
+            auto parse_hex4() -> uint32_t
+            {
+                if (m_end - m_cursor < 4)
+                {
+                    error("four hex digits after '\\u'");
+                }
+
+                uint32_t code_unit{};
+                for (int i = 0; i < 4; ++i, ++m_cursor)
+                {
+                    auto c = *m_cursor;
+                    code_unit <<= 4;
+                    if (c >= STR('0') && c <= STR('9'))
+                    {
+                        code_unit |= c - STR('0');
+                    }
+                    else if (c >= STR('a') && c <= STR('f'))
+                    {
+                        code_unit |= c - STR('a') + 10;
+                    }
+                    else if (c >= STR('A') && c <= STR('F'))
+                    {
+                        code_unit |= c - STR('A') + 10;
+                    }
+                    else
+                    {
+                        error("four hex digits after '\\u'");
+                    }
+                }
+                return code_unit;
+            }
+
+            // Surrogates are only kept as a high surrogate escape followed by a low surrogate escape, anything else becomes U+FFFD
+            // Expects the cursor to be right after the escape of 'code_unit'
+            auto decode_surrogate(uint32_t code_unit, CharType* out) -> CharType*
+            {
+                constexpr CharType replacement_character = 0xFFFD;
+                if (code_unit > 0xDBFF || m_end - m_cursor < 6 || m_cursor[0] != STR('\\') || m_cursor[1] != STR('u'))
+                {
+                    *out++ = replacement_character;
+                    return out;
+                }
+
+                auto next_escape = m_cursor;
+                m_cursor += 2;
+                auto low_surrogate = parse_hex4();
+                if (low_surrogate < 0xDC00 || low_surrogate > 0xDFFF)
+                {
+                    // The next escape is decoded on its own
+                    m_cursor = next_escape;
+                    *out++ = replacement_character;
+                    return out;
+                }
+
+                if constexpr (sizeof(CharType) >= 4)
+                {
+                    // Combined into a single code point for UTF-32 strings
+                    *out++ = static_cast<CharType>(0x10000 + ((code_unit - 0xD800) << 10) + (low_surrogate - 0xDC00));
+                }
+                else
+                {
+                    *out++ = static_cast<CharType>(code_unit);
+                    *out++ = static_cast<CharType>(low_surrogate);
+                }
+                return out;
+            }
+
+            // Copies or decodes text that has no escape sequences, runs of UTF-8 text always end right before an ASCII character
+            auto append_text(const SourceChar* first, const SourceChar* last, CharType* out) -> CharType*
+            {
+                if constexpr (std::is_same_v<SourceChar, CharType>)
+                {
+                    return std::copy(first, last, out);
+                }
+                else
+                {
+                    return File::decode_utf8(std::string_view{first, static_cast<size_t>(last - first)}, out);
+                }
+            }
+
+            auto skip_unescaped_text() -> void
+            {
+                while (m_cursor != m_end && *m_cursor != STR('"') && *m_cursor != STR('\\'))
+                {
+                    ++m_cursor;
+                }
+
+                if (m_cursor == m_end)
+                {
+                    error("'\"' at the end of a string");
+                }
+            }
+
+            // Expects the cursor to be right after the opening quote and leaves it right after the closing quote
+            // Unescaped control characters are kept like the old parser did, hand-written configs contain raw tabs
+            auto parse_string() -> StringViewType
+            {
+                auto start = m_cursor;
+                skip_unescaped_text();
+
+                if constexpr (std::is_same_v<SourceChar, CharType>)
+                {
+                    if (*m_cursor == STR('"'))
+                    {
+                        // Fast path, no escape sequences so the string can point straight into the input
+                        return StringViewType{start, static_cast<size_t>(m_cursor++ - start)};
+                    }
+                }
+
+                // Slow path, the decoded string is never longer than the encoded one, not even when it's decoded from UTF-8
+                auto string_end = m_cursor;
+                while (string_end != m_end && *string_end != STR('"'))
+                {
+                    string_end += *string_end == STR('\\') && string_end + 1 != m_end ? 2 : 1;
+                }
+                auto decoded = m_arena.create_array<CharType>(static_cast<size_t>(string_end - start));
+                auto out = append_text(start, m_cursor, decoded);
+
+                while (*m_cursor++ != STR('"'))
+                {
+                    // The cursor is right after a backslash
+                    if (m_cursor == m_end)
+                    {
+                        error("an escape sequence");
+                    }
+
+                    auto escaped = *m_cursor++;
+                    switch (escaped)
+                    {
+                    case STR('"'):
+                    case STR('\\'):
+                    case STR('/'):
+                        *out++ = static_cast<CharType>(escaped);
+                        break;
+                    case STR('b'):
+                        *out++ = STR('\b');
+                        break;
+                    case STR('f'):
+                        *out++ = STR('\f');
+                        break;
+                    case STR('n'):
+                        *out++ = STR('\n');
+                        break;
+                    case STR('r'):
+                        *out++ = STR('\r');
+                        break;
+                    case STR('t'):
+                        *out++ = STR('\t');
+                        break;
+                    case STR('u'): {
+                        auto code_unit = parse_hex4();
+                        if (code_unit >= 0xD800 && code_unit <= 0xDFFF)
+                        {
+                            out = decode_surrogate(code_unit, out);
+                            break;
+                        }
+                        *out++ = static_cast<CharType>(code_unit);
+                        break;
+                    }
+                    default:
+                        // Unknown escape sequences are kept verbatim, hand-written configs often contain unescaped Windows paths
+                        // The escaped character is read again as text so a multi-byte UTF-8 sequence is decoded as a whole
+                        *out++ = STR('\\');
+                        --m_cursor;
+                        break;
+                    }
+
+                    auto run_start = m_cursor;
+                    skip_unescaped_text();
+                    out = append_text(run_start, m_cursor, out);
+                }
+
+                return StringViewType{decoded, static_cast<size_t>(out - decoded)};
+            }
+
+            auto parse_number() -> Number*
+            {
+                auto start = m_cursor;
+                bool is_integer{true};
+
+                if (m_cursor != m_end && *m_cursor == STR('-'))
+                {
+                    ++m_cursor;
+                }
+
+                auto digits_start = m_cursor;
+                while (m_cursor != m_end && *m_cursor >= STR('0') && *m_cursor <= STR('9'))
+                {
+                    ++m_cursor;
+                }
+                if (m_cursor == digits_start)
+                {
+                    m_cursor = start;
+                    error("a value");
+                }
+                // Leading zeros are accepted like the old parser did, they're still read as decimal
+
+                if (m_cursor != m_end && *m_cursor == STR('.'))
+                {
+                    is_integer = false;
+                    ++m_cursor;
+                    auto fraction_start = m_cursor;
+                    while (m_cursor != m_end && *m_cursor >= STR('0') && *m_cursor <= STR('9'))
+                    {
+                        ++m_cursor;
+                    }
+                    if (m_cursor == fraction_start)
+                    {
+                        error("digits after the decimal point");
+                    }
+                }
+
+                if (m_cursor != m_end && (*m_cursor == STR('e') || *m_cursor == STR('E')))
+                {
+                    is_integer = false;
+                    ++m_cursor;
+                    if (m_cursor != m_end && (*m_cursor == STR('+') || *m_cursor == STR('-')))
+                    {
+                        ++m_cursor;
+                    }
+                    auto exponent_start = m_cursor;
+                    while (m_cursor != m_end && *m_cursor >= STR('0') && *m_cursor <= STR('9'))
+                    {
+                        ++m_cursor;
+                    }
+                    if (m_cursor == exponent_start)
+                    {
+                        error("digits in the exponent");
+                    }
+                }
+
+                // Numbers are plain ASCII so they can be narrowed for from_chars without any conversion
+                constexpr size_t max_number_length = 64;
+                auto length = static_cast<size_t>(m_cursor - start);
+                if (length >= max_number_length)
+                {
+                    m_cursor = start;
+                    error("a number with less than 64 characters");
+                }
+                char narrow[max_number_length];
+                std::transform(start, m_cursor, narrow, [](SourceChar c) {
+                    return static_cast<char>(c);
+                });
+
+                if (is_integer)
+                {
+                    int64_t value{};
+                    auto [ptr, ec] = std::from_chars(narrow, narrow + length, value);
+                    if (ec == std::errc{})
+                    {
+                        return m_arena.create<Number>(value);
+                    }
+                    // Integers that don't fit in 64 bits are stored as doubles instead
+                }
+
+                double value{};
+                auto [ptr, ec] = std::from_chars(narrow, narrow + length, value);
+                if (ec != std::errc{})
+                {
+                    m_cursor = start;
+                    error("a valid number");
+                }
+                return m_arena.create<Number>(value);
+            }
+        };
+    } // namespace Internal
+
+    auto parse(StringType input) -> Document
+    {
+        auto owned_input = std::make_unique<StringType>(std::move(input));
+        Arena arena{};
+        Internal::DomParser<CharType> parser{*owned_input, arena};
+        auto root = parser.parse_document();
+        return Document{std::move(owned_input), std::move(arena), root};
+    }
+
+    auto parse(const File::Handle& file) -> Document
+    {
+        return parse(file.read_all_view());
+    }
+
+    auto parse(File::FileView file_view) -> Document
+    {
+        Arena arena{};
+        if (auto native_text = file_view.as_native_text())
+        {
+            Internal::DomParser<CharType> parser{*native_text, arena};
+            auto root = parser.parse_document();
+            return Document{std::move(file_view), std::move(arena), root};
+        }
+
+        // UTF-8 is decoded while parsing instead of converting the whole file first, every string ends up in the arena
+        if (auto utf8_text = file_view.as_utf8_text())
+        {
+            Internal::DomParser<char> parser{*utf8_text, arena};
+            auto root = parser.parse_document();
+            return Document{std::move(file_view), std::move(arena), root};
+        }
+
+        return parse(file_view.to_string());
+    }
+} // namespace RC::JSON::Dom
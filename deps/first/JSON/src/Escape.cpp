@@ -0,0 +1,46 @@
+#include <iterator>
+
+#include <JSON/Escape.hpp>
+
+#include <fmt/format.h>
+#include <fmt/xchar.h>
+
+namespace RC::JSON
+{
+    auto append_escaped(StringType& buffer, StringViewType string) -> void
+    {
+        buffer.push_back(STR('"'));
+        for (auto c : string)
+        {
+            switch (c)
+            {
+            case STR('"'):
+                buffer.append(STR("\\\""));
+                break;
+            case STR('\\'):
+                buffer.append(STR("\\\\"));
+                break;
+            case STR('\n'):
+                buffer.append(STR("\\n"));
+                break;
+            case STR('\r'):
+                buffer.append(STR("\\r"));
+                break;
+            case STR('\t'):
+                buffer.append(STR("\\t"));
+                break;
+            default:
+                if (c < 0x20)
+                {
+                    fmt::format_to(std::back_inserter(buffer), STR("\\u{:04x}"), static_cast<uint32_t>(c));
+                }
+                else
+                {
+                    buffer.push_back(c);
+                }
+                break;
+            }
+        }
+        buffer.push_back(STR('"'));
+    }
+} // namespace RC::JSON
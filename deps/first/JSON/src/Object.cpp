@@ -1,5 +1,6 @@
 #include <JSON/Array.hpp>
 #include <JSON/Bool.hpp>
+#include <JSON/Escape.hpp>
 #include <JSON/Null.hpp>
 #include <JSON/Object.hpp>
 #include <JSON/String.hpp>
@@ -90,7 +91,8 @@ namespace RC::JSON
                 indent(indent_level, object_as_string);
             }
 
-            object_as_string.append(fmt::format(STR("\"{}\":"), key));
+            append_escaped(object_as_string, key);
+            object_as_string.push_back(STR(':'));
             object_as_string.append(value->serialize(should_format, indent_level));
 
             if (member_count + 1 < m_members.size())
@@ -32,7 +32,7 @@ namespace RC::JSON::Parser
             return tc;
         }
 
-        static auto parse_internal(File::StringType& input) -> std::unique_ptr<JSON::Object>
+        static auto parse_internal(File::StringViewType input) -> std::unique_ptr<JSON::Object>
         {
             // Tokenize -> START
             ParserBase::Tokenizer tokenizer;
@@ -61,7 +61,12 @@ namespace RC::JSON::Parser
 
     auto parse(const File::Handle& file) -> std::unique_ptr<JSON::Object>
     {
-        auto input = file.read_all();
-        return Internal::parse_internal(input);
+        return parse(file.read_all_view());
+    }
+
+    auto parse(const File::FileView& file_view) -> std::unique_ptr<JSON::Object>
+    {
+        File::StringType decoded_input{};
+        return Internal::parse_internal(file_view.get_text(decoded_input));
     }
 } // namespace RC::JSON::Parser
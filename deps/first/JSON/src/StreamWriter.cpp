@@ -0,0 +1,212 @@
+#include <stdexcept>
+
+#include <JSON/StreamWriter.hpp>
+
+namespace RC::JSON
+{
+    StreamWriter::StreamWriter(const std::filesystem::path& file_path, ShouldFormat should_format)
+        : m_file(File::open(file_path, File::OpenFor::Writing, File::OverwriteExistingFile::Yes, File::CreateIfNonExistent::Yes)),
+          m_should_format(should_format)
+    {
+        m_file.set_write_buffer_size(write_buffer_size);
+    }
+
+    StreamWriter::~StreamWriter()
+    {
+        try
+        {
+            flush();
+        }
+        catch (...)
+        {
+            // Destructors can't report errors, 'finish' does
+        }
+    }
+
+    auto StreamWriter::write_buffer() -> void
+    {
+        // The file layer refuses to write empty strings
+        if (m_buffer.empty())
+        {
+            return;
+        }
+        m_file.write_string_to_file(m_buffer);
+        m_buffer.clear();
+    }
+
+    auto StreamWriter::write_newline_and_indent() -> void
+    {
+        if (m_should_format == ShouldFormat::No)
+        {
+            return;
+        }
+
+        m_buffer.push_back(STR('\n'));
+        int32_t indent_level = static_cast<int32_t>(m_scopes.size());
+        indent(&indent_level, m_buffer);
+    }
+
+    auto StreamWriter::write_value_prefix() -> void
+    {
+        if (m_scopes.empty())
+        {
+            if (m_has_root_value)
+            {
+                throw std::runtime_error{"[JSON::StreamWriter] Only one root value can be written"};
+            }
+            m_has_root_value = true;
+            return;
+        }
+
+        auto& scope = m_scopes.back();
+        if (scope.is_object)
+        {
+            if (!m_has_pending_key)
+            {
+                throw std::runtime_error{"[JSON::StreamWriter] Values in an object must be preceded by a key"};
+            }
+            m_has_pending_key = false;
+            return;
+        }
+
+        if (scope.has_members)
+        {
+            m_buffer.push_back(STR(','));
+        }
+        scope.has_members = true;
+        write_newline_and_indent();
+    }
+
+    auto StreamWriter::begin_scope(bool is_object, CharType open_char) -> void
+    {
+        write_value_prefix();
+        m_buffer.push_back(open_char);
+        m_scopes.emplace_back(Scope{.is_object = is_object});
+    }
+
+    auto StreamWriter::end_scope(bool is_object, CharType close_char) -> void
+    {
+        if (m_scopes.empty() || m_scopes.back().is_object != is_object || m_has_pending_key)
+        {
+            throw std::runtime_error{"[JSON::StreamWriter] Mismatched end of object or array"};
+        }
+
+        bool had_members = m_scopes.back().has_members;
+        m_scopes.pop_back();
+
+        // Empty objects and arrays are kept on a single line, same as the tree serializer
+        if (had_members)
+        {
+            write_newline_and_indent();
+        }
+        m_buffer.push_back(close_char);
+        write_buffer();
+    }
+
+    auto StreamWriter::begin_object() -> void
+    {
+        begin_scope(true, STR('{'));
+    }
+
+    auto StreamWriter::begin_object(StringViewType key_name) -> void
+    {
+        key(key_name);
+        begin_object();
+    }
+
+    auto StreamWriter::end_object() -> void
+    {
+        end_scope(true, STR('}'));
+    }
+
+    auto StreamWriter::begin_array() -> void
+    {
+        begin_scope(false, STR('['));
+    }
+
+    auto StreamWriter::begin_array(StringViewType key_name) -> void
+    {
+        key(key_name);
+        begin_array();
+    }
+
+    auto StreamWriter::end_array() -> void
+    {
+        end_scope(false, STR(']'));
+    }
+
+    auto StreamWriter::key(StringViewType key_name) -> void
+    {
+        if (m_scopes.empty() || !m_scopes.back().is_object || m_has_pending_key)
+        {
+            throw std::runtime_error{"[JSON::StreamWriter] Keys can only be written directly inside an object"};
+        }
+
+        auto& scope = m_scopes.back();
+        if (scope.has_members)
+        {
+            m_buffer.push_back(STR(','));
+        }
+        scope.has_members = true;
+        write_newline_and_indent();
+
+        append_escaped(m_buffer, key_name);
+        m_buffer.push_back(STR(':'));
+        m_has_pending_key = true;
+    }
+
+    auto StreamWriter::string(StringViewType value) -> void
+    {
+        write_value_prefix();
+        append_escaped(m_buffer, value);
+        write_buffer();
+    }
+
+    auto StreamWriter::string(StringViewType key_name, StringViewType value) -> void
+    {
+        key(key_name);
+        string(value);
+    }
+
+    auto StreamWriter::boolean(bool value) -> void
+    {
+        write_value_prefix();
+        m_buffer.append(value ? STR("true") : STR("false"));
+        write_buffer();
+    }
+
+    auto StreamWriter::boolean(StringViewType key_name, bool value) -> void
+    {
+        key(key_name);
+        boolean(value);
+    }
+
+    auto StreamWriter::null() -> void
+    {
+        write_value_prefix();
+        m_buffer.append(STR("null"));
+        write_buffer();
+    }
+
+    auto StreamWriter::null(StringViewType key_name) -> void
+    {
+        key(key_name);
+        null();
+    }
+
+    auto StreamWriter::flush() -> void
+    {
+        write_buffer();
+        m_file.flush();
+    }
+
+    auto StreamWriter::finish() -> void
+    {
+        if (!m_scopes.empty())
+        {
+            throw std::runtime_error{"[JSON::StreamWriter] Tried to finish while an object or array is still open"};
+        }
+        flush();
+        m_file.close();
+    }
+} // namespace RC::JSON
@@ -1,8 +1,6 @@
+#include <JSON/Escape.hpp>
 #include <JSON/String.hpp>
 
-#include <fmt/core.h>
-#include <fmt/xchar.h>
-
 namespace RC::JSON
 {
     String::String(StringViewType string) : m_data(string)
@@ -11,6 +9,9 @@ namespace RC::JSON
 
     auto String::serialize([[maybe_unused]] ShouldFormat should_format, [[maybe_unused]] int32_t* indent_level) -> StringType
     {
-        return fmt::format(STR("\"{}\""), m_data);
+        StringType string{};
+        string.reserve(m_data.size() + 2);
+        append_escaped(string, m_data);
+        return string;
     }
 } // namespace RC::JSON
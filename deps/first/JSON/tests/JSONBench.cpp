@@ -0,0 +1,84 @@
+#include <filesystem>
+
+#include <JSON/Dom.hpp>
+#include <JSON/StreamWriter.hpp>
+#include <TestHarness/TestHarness.hpp>
+
+using namespace RC;
+using namespace RC::TestHarness;
+
+// Cost of streaming a document shaped like the object dumps, one object per object with a few members, and of parsing it back
+int main()
+{
+    constexpr size_t num_objects = 10'000;
+    auto directory = std::filesystem::temp_directory_path() / "JSONBench";
+    std::filesystem::create_directories(directory);
+    auto path = directory / "bench.json";
+
+    auto write_document = [&](JSON::ShouldFormat should_format) {
+        JSON::StreamWriter writer{path, should_format};
+        writer.begin_array();
+        for (size_t i = 0; i < num_objects; ++i)
+        {
+            writer.begin_object();
+            writer.string(STR("name"), STR("/Script/Engine.Actor:K2_GetActorLocation"));
+            writer.number(STR("index"), i);
+            writer.number(STR("offset"), 0.25 * static_cast<double>(i));
+            writer.boolean(STR("is_native"), true);
+            writer.end_object();
+        }
+        writer.end_array();
+        writer.finish();
+    };
+
+    write_document(JSON::ShouldFormat::No);
+    auto num_bytes = static_cast<size_t>(std::filesystem::file_size(path));
+    benchmark_throughput("StreamWriter, 10k objects, unformatted", num_bytes, 3, [&] {
+        write_document(JSON::ShouldFormat::No);
+    });
+
+    write_document(JSON::ShouldFormat::Yes);
+    num_bytes = static_cast<size_t>(std::filesystem::file_size(path));
+    benchmark_throughput("StreamWriter, 10k objects, formatted", num_bytes, 3, [&] {
+        write_document(JSON::ShouldFormat::Yes);
+    });
+
+    // The root of a DOM document must be an object
+    {
+        JSON::StreamWriter writer{path, JSON::ShouldFormat::Yes};
+        writer.begin_object();
+        writer.begin_array(STR("Objects"));
+        for (size_t i = 0; i < num_objects; ++i)
+        {
+            writer.begin_object();
+            writer.string(STR("name"), STR("/Script/Engine.Actor:K2_GetActorLocation"));
+            writer.string(STR("path"), STR("C:\\Games\\\"Quoted\"\\Content"));
+            writer.number(STR("index"), i);
+            writer.number(STR("offset"), 0.25 * static_cast<double>(i));
+            writer.boolean(STR("is_native"), true);
+            writer.end_object();
+        }
+        writer.end_array();
+        writer.end_object();
+        writer.finish();
+    }
+    num_bytes = static_cast<size_t>(std::filesystem::file_size(path));
+    auto input = File::open(path, File::OpenFor::Reading, File::OverwriteExistingFile::No, File::CreateIfNonExistent::No).read_all();
+    size_t num_parsed{};
+    benchmark_throughput("Dom::parse, 10k objects, from a string", num_bytes, 3, [&] {
+        auto document = JSON::Dom::parse(StringType{input});
+        num_parsed = document->get<JSON::Dom::Array>(STR("Objects")).size();
+        do_not_optimize(num_parsed);
+    });
+    CHECK(num_parsed == num_objects);
+    benchmark_throughput("Dom::parse, 10k objects, from the file", num_bytes, 3, [&] {
+        auto document = JSON::Dom::parse(File::open(path, File::OpenFor::Reading, File::OverwriteExistingFile::No, File::CreateIfNonExistent::No));
+        num_parsed = document->get<JSON::Dom::Array>(STR("Objects")).size();
+        do_not_optimize(num_parsed);
+    });
+    CHECK(num_parsed == num_objects);
+
+    std::filesystem::remove_all(directory);
+
+    return report();
+}
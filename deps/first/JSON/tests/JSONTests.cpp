@@ -0,0 +1,199 @@
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <string>
+
+#include <JSON/Array.hpp>
+#include <JSON/Dom.hpp>
+#include <JSON/Object.hpp>
+#include <JSON/StreamWriter.hpp>
+#include <TestHarness/TestHarness.hpp>
+
+using namespace RC;
+using RC::TestHarness::throws;
+
+static auto read_file(const std::filesystem::path& path) -> std::string
+{
+    std::ifstream stream{path, std::ios::binary};
+    return {std::istreambuf_iterator<char>{stream}, std::istreambuf_iterator<char>{}};
+}
+
+static auto test_stream_writer(const std::filesystem::path& path) -> void
+{
+    JSON::StreamWriter writer{path, JSON::ShouldFormat::No};
+    writer.begin_object();
+    writer.string(STR("name"), STR("quote\" backslash\\ newline\n control\x01"));
+    writer.number(STR("integer"), -42);
+    writer.number(STR("float"), 0.5);
+    writer.boolean(STR("bool"), true);
+    writer.null(STR("null"));
+    writer.begin_array(STR("items"));
+    writer.number(1);
+    writer.begin_object();
+    writer.end_object();
+    writer.end_array();
+    writer.end_object();
+    writer.finish();
+
+    CHECK(read_file(path) ==
+          R"({"name":"quote\" backslash\\ newline\n control\u0001","integer":-42,"float":0.5,"bool":true,"null":null,"items":[1,{}]})");
+}
+
+static auto test_non_finite_numbers(const std::filesystem::path& path) -> void
+{
+    JSON::StreamWriter writer{path, JSON::ShouldFormat::No};
+    writer.begin_array();
+    writer.number(std::numeric_limits<double>::infinity());
+    writer.number(-std::numeric_limits<float>::infinity());
+    writer.number(std::numeric_limits<double>::quiet_NaN());
+    writer.end_array();
+    writer.finish();
+
+    CHECK(read_file(path) == "[null,null,null]");
+}
+
+static auto test_unfinished_document(const std::filesystem::path& path) -> void
+{
+    {
+        JSON::StreamWriter writer{path, JSON::ShouldFormat::No};
+        writer.begin_array();
+        writer.number(1);
+        CHECK(throws([&] {
+            writer.finish();
+        }));
+    }
+    // The destructor writes what was added even though the document was left incomplete
+    {
+        JSON::StreamWriter writer{path, JSON::ShouldFormat::No};
+        writer.begin_array();
+        writer.string(STR("written by the destructor"));
+    }
+    CHECK(read_file(path) == R"(["written by the destructor")");
+}
+
+static auto test_large_document(const std::filesystem::path& path) -> void
+{
+    // Goes through the file handle's buffer several times
+    constexpr int num_items = 100'000;
+    {
+        JSON::StreamWriter writer{path, JSON::ShouldFormat::No};
+        writer.begin_array();
+        for (int i = 0; i < num_items; ++i)
+        {
+            writer.number(i);
+        }
+        writer.end_array();
+        writer.finish();
+    }
+
+    auto json = read_file(path);
+    CHECK(json.size() > JSON::StreamWriter::write_buffer_size);
+    CHECK(json.starts_with("[0,1,2,"));
+    CHECK(json.ends_with(",99998,99999]"));
+}
+
+static auto test_dom_leniency() -> void
+{
+    // Leading zeros and raw control characters were accepted by the old parser, hand-written configs rely on it
+    auto document = JSON::Dom::parse(STR("{\"Number\": 007, \"Negative\": -012, \"Tab\": \"a\tb\", \"Path\": \"C:\\Games\"}"));
+    CHECK(document->get<JSON::Dom::Number>(STR("Number")).get<int64_t>() == 7);
+    CHECK(document->get<JSON::Dom::Number>(STR("Negative")).get<int64_t>() == -12);
+    CHECK(document->get<JSON::Dom::String>(STR("Tab")).get_view() == STR("a\tb"));
+    // Unknown escape sequences are kept verbatim
+    CHECK(document->get<JSON::Dom::String>(STR("Path")).get_view() == STR("C:\\Games"));
+}
+
+static auto test_dom_surrogates() -> void
+{
+    auto document = JSON::Dom::parse(STR(R"({"Pair": "\ud83d\ude00", "Unpaired": "a\ud83db", "NotLow": "\ud83d\u0041", "Low": "\ude00", "AtEnd": "\ud83d"})"));
+    CHECK(document->get<JSON::Dom::String>(STR("Pair")).get_view() == STR("\U0001F600"));
+    CHECK(document->get<JSON::Dom::String>(STR("Unpaired")).get_view() == STR("a\uFFFDb"));
+    CHECK(document->get<JSON::Dom::String>(STR("NotLow")).get_view() == STR("\uFFFDA"));
+    CHECK(document->get<JSON::Dom::String>(STR("Low")).get_view() == STR("\uFFFD"));
+    CHECK(document->get<JSON::Dom::String>(STR("AtEnd")).get_view() == STR("\uFFFD"));
+}
+
+// Written with JSON::Object and read back with JSON::Dom, like LiveView does with filters.meta.json and watches.meta.json
+static auto test_live_view_round_trip(const std::filesystem::path& path) -> void
+{
+    const StringType tricky_name = STR("Quote\" Backslash\\ Tab\t NewLine\n Control\x01 Slash/ Accent\u00e9 Emoji\U0001F600");
+
+    auto write_file = [&](JSON::Object& json) {
+        auto file = File::open(path, File::OpenFor::Writing, File::OverwriteExistingFile::Yes, File::CreateIfNonExistent::Yes);
+        int32_t json_indent_level{};
+        file.write_string_to_file(json.serialize(JSON::ShouldFormat::Yes, &json_indent_level));
+    };
+    auto read_file = [&] {
+        return JSON::Dom::parse(File::open(path, File::OpenFor::Reading, File::OverwriteExistingFile::No, File::CreateIfNonExistent::No));
+    };
+
+    {
+        auto json = JSON::Object{};
+        auto& json_filters = json.new_array(STR("Filters"));
+        auto& bool_filter = json_filters.new_object();
+        bool_filter.new_string(STR("FilterName"), STR("IncludeInheritance"));
+        bool_filter.new_object(STR("FilterData")).new_bool(STR("Enabled"), true);
+        auto& array_filter = json_filters.new_object();
+        array_filter.new_string(STR("FilterName"), STR("ClassNamesFilter"));
+        auto& filter_data = array_filter.new_object(STR("FilterData"));
+        filter_data.new_bool(STR("IsExclude"), false);
+        auto& class_names = filter_data.new_array(STR("ClassNames"));
+        class_names.new_string(STR("Actor"));
+        class_names.new_string(tricky_name);
+        write_file(json);
+
+        auto document = read_file();
+        auto& filters = document->get<JSON::Dom::Array>(STR("Filters"));
+        CHECK(filters.size() == 2);
+        auto& read_bool_filter = *filters[0].as<JSON::Dom::Object>();
+        CHECK(read_bool_filter.get<JSON::Dom::String>(STR("FilterName")).get_view() == STR("IncludeInheritance"));
+        CHECK(read_bool_filter.get<JSON::Dom::Object>(STR("FilterData")).get<JSON::Dom::Bool>(STR("Enabled")).get());
+        auto& read_filter_data = filters[1].as<JSON::Dom::Object>()->get<JSON::Dom::Object>(STR("FilterData"));
+        CHECK(!read_filter_data.get<JSON::Dom::Bool>(STR("IsExclude")).get());
+        auto& read_class_names = read_filter_data.get<JSON::Dom::Array>(STR("ClassNames"));
+        CHECK(read_class_names.size() == 2);
+        CHECK(read_class_names[0].as<JSON::Dom::String>()->get_view() == STR("Actor"));
+        CHECK(read_class_names[1].as<JSON::Dom::String>()->get_view() == tricky_name);
+    }
+
+    {
+        auto json = JSON::Object{};
+        auto& json_watches = json.new_array(STR("Watches"));
+        auto watch = std::make_unique<JSON::Object>();
+        watch->new_string(STR("AcquisitionID"), STR("/Game/Maps/Map.Map:PersistentLevel.BP_Actor_C_1"));
+        watch->new_string(STR("PropertyName"), tricky_name);
+        watch->new_number(STR("AcquisitionMethod"), 1);
+        watch->new_number(STR("WatchType"), 0);
+        json_watches.add_object(std::move(watch));
+        write_file(json);
+
+        auto document = read_file();
+        auto& watches = document->get<JSON::Dom::Array>(STR("Watches"));
+        CHECK(watches.size() == 1);
+        auto& read_watch = *watches[0].as<JSON::Dom::Object>();
+        CHECK(read_watch.get<JSON::Dom::String>(STR("AcquisitionID")).get_view() == STR("/Game/Maps/Map.Map:PersistentLevel.BP_Actor_C_1"));
+        CHECK(read_watch.get<JSON::Dom::String>(STR("PropertyName")).get_view() == tricky_name);
+        CHECK(read_watch.get<JSON::Dom::Number>(STR("AcquisitionMethod")).get<int64_t>() == 1);
+        CHECK(read_watch.get<JSON::Dom::Number>(STR("WatchType")).get<int64_t>() == 0);
+    }
+}
+
+int main()
+{
+    auto directory = std::filesystem::temp_directory_path() / "JSONTests";
+    std::filesystem::create_directories(directory);
+    auto path = directory / "test.json";
+
+    test_stream_writer(path);
+    test_non_finite_numbers(path);
+    test_unfinished_document(path);
+    test_large_document(path);
+    test_dom_leniency();
+    test_dom_surrogates();
+    test_live_view_round_trip(path);
+
+    std::filesystem::remove_all(directory);
+
+    return RC::TestHarness::report();
+}
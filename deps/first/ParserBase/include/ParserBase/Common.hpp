@@ -1,5 +1,12 @@
 #pragma once
 
+// Only Windows builds export and import symbols
+#ifndef _WIN32
+#ifndef RC_PB_API
+#define RC_PB_API
+#endif
+#endif
+
 #ifndef RC_PARSER_BASE_EXPORTS
 #ifndef RC_PARSER_BASE_BUILD_STATIC
 #ifndef RC_PB_API
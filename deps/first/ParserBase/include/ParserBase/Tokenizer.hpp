@@ -1,5 +1,6 @@
 #pragma once
 
+#include <array>
 #include <memory>
 #include <stdexcept>
 #include <string>
@@ -41,11 +42,20 @@ namespace RC::ParserBase
         size_t m_current_line{0};
         size_t m_current_column{0};
 
+      private:
+        // Indices of the tokens that can start with a given character, in registration order
+        std::array<std::vector<size_t>, 128> m_ascii_dispatch{};
+        // Candidates for characters outside of the ASCII range
+        std::vector<size_t> m_non_ascii_dispatch{};
+
       public:
         RC_PB_API auto set_available_tokens(TokenContainer&&) -> void;
         // TODO: Maybe the constructor should take the input instead of 'tokenize'
-        RC_PB_API auto tokenize(const File::StringType& input) -> void;
+        RC_PB_API auto tokenize(File::StringViewType input) -> void;
         [[nodiscard]] RC_PB_API auto get_tokens() const -> const std::vector<Token>&;
         [[nodiscard]] RC_PB_API auto get_last_token() const -> const Token&;
+
+      private:
+        auto build_dispatch_table() -> void;
     };
 } // namespace RC::ParserBase
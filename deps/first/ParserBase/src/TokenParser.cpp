@@ -4,7 +4,7 @@
 
 namespace RC::ParserBase
 {
-    TokenParser::TokenParser(const Tokenizer& tokenizer, File::StringType& input) : m_tokenizer(tokenizer), m_data(input)
+    TokenParser::TokenParser(const Tokenizer& tokenizer, File::StringViewType input) : m_tokenizer(tokenizer), m_data(input)
     {
     }
 
@@ -20,7 +20,7 @@ namespace RC::ParserBase
             throw std::runtime_error{"Tried retrieving data of a token that doesn't have any data"};
         }
 
-        auto data = m_data.substr(token.get_start(), token.get_end() - token.get_start() + 1);
+        File::StringType data{m_data.substr(token.get_start(), token.get_end() - token.get_start() + 1)};
         data.erase(std::find(data.begin(), data.end(), STR('\0')), data.end());
         return data;
     }
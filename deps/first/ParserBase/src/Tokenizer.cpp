@@ -1,6 +1,3 @@
-#include <fstream>
-#include <sstream>
-
 #include <ParserBase/Token.hpp>
 #include <ParserBase/Tokenizer.hpp>
 
@@ -41,64 +38,66 @@ namespace RC::ParserBase
         m_token_container = std::move(token_container);
     }
 
-    auto Tokenizer::tokenize(const File::StringType& input) -> void
+    auto Tokenizer::build_dispatch_table() -> void
     {
-        // printf_s("Tokenizer::tokenize()\n\n");
-
-        if (!m_token_container.m_has_eof_token_type)
+        for (auto& candidates : m_ascii_dispatch)
         {
-            throw std::runtime_error{"Please call TokenContainer::set_of_token before attempting to tokenize"};
+            candidates.clear();
         }
+        m_non_ascii_dispatch.clear();
 
-        /*
-        printf_s("Possible tokens\n");
-        for (const auto& token : m_token_container.get_all())
+        // Tokens are added to the candidate lists in registration order because that order decides which token wins
+        // Tokens with an empty identifier match every character and are therefore candidates everywhere
+        const auto& tokens = m_token_container.get_all();
+        for (size_t token_index = 0; token_index < tokens.size(); ++token_index)
         {
-            printf_s("Token: %S\n", token.to_string().c_str());
-            printf_s("Identifier: %S\n", token.get_identifier().data());
-
-            if (!token.get_rules().empty())
+            File::StringViewType identifier = tokens[token_index].get_identifier();
+            if (identifier.empty())
             {
-                printf_s("Rules\n");
-                for (const auto& rule : token.get_rules())
+                for (auto& candidates : m_ascii_dispatch)
                 {
-                    printf_s("    %S\n", rule->to_string().c_str());
+                    candidates.emplace_back(token_index);
                 }
+                m_non_ascii_dispatch.emplace_back(token_index);
+            }
+            else if (static_cast<size_t>(identifier[0]) < m_ascii_dispatch.size())
+            {
+                m_ascii_dispatch[static_cast<size_t>(identifier[0])].emplace_back(token_index);
             }
+            else
+            {
+                m_non_ascii_dispatch.emplace_back(token_index);
+            }
+        }
+    }
 
-            printf_s("\n");
+    auto Tokenizer::tokenize(File::StringViewType input) -> void
+    {
+        if (!m_token_container.m_has_eof_token_type)
+        {
+            throw std::runtime_error{"Please call TokenContainer::set_of_token before attempting to tokenize"};
         }
-        //*/
 
         if (input.empty())
         {
             throw std::runtime_error{"[Tokenizer::tokenize] Input was empty"};
         }
 
-        File::StringType a;
+        // The token set is compiled once into a first-character dispatch table
+        // Each character is then only compared against the tokens that can possibly start with it
+        build_dispatch_table();
 
-        const File::CharType* input_array = input.c_str();
+        const auto& tokens = m_token_container.get_all();
+        const File::CharType* input_array = input.data();
+        const size_t input_size = input.size();
         size_t global_cursor{};
 
-        auto peek = [&](File::StringType& out_str, const File::CharType* character, size_t num_chars) -> void {
-            if (global_cursor + num_chars <= input.size())
-            {
-                for (size_t i = 0; i < num_chars; ++i)
-                {
-                    out_str += *character;
-                    ++character;
-                }
-            }
-        };
-
         struct TokenFoundWrapper
         {
             const Token* token{nullptr};
             bool matched_anything{false};
         };
 
-        File::StringType current_empty_token{};
-        File::StringType empty_token_data{};
         TokenFoundWrapper empty_token{};
         size_t start_of_empty_token{};
         bool start_of_empty_token_set{};
@@ -112,17 +111,16 @@ namespace RC::ParserBase
                 empty_token.token->m_line = m_current_line;
                 empty_token.token->m_column = m_current_column + 1;
                 m_tokens_in_input.emplace_back(*empty_token.token);
-                empty_token_data.clear();
                 empty_token = {};
                 start_of_empty_token_set = false;
             }
         };
 
-        for (; global_cursor < input.size(); ++c, ++global_cursor)
+        for (; global_cursor < input_size; ++c, ++global_cursor)
         {
             TokenFoundWrapper token_found{};
 
-            if (c && *c == STR('\n'))
+            if (*c == STR('\n'))
             {
                 ++m_current_line;
                 m_current_column = 0;
@@ -132,54 +130,57 @@ namespace RC::ParserBase
                 ++m_current_column;
             }
 
-            for (auto& token : m_token_container.get_all())
+            const auto& candidates = static_cast<size_t>(*c) < m_ascii_dispatch.size() ? m_ascii_dispatch[static_cast<size_t>(*c)] : m_non_ascii_dispatch;
+            for (size_t token_index : candidates)
             {
+                const Token& token = tokens[token_index];
                 int advance_cursor_by{-1};
                 bool all_rules_obeyed{true};
 
                 File::StringViewType identifier_to_find = token.get_identifier();
-                File::StringType compare_to;
                 size_t identifier_size = identifier_to_find.size();
-                peek(compare_to, c, identifier_size);
                 bool identifier_should_match_all = identifier_to_find.empty();
 
                 // Empty identifier matches everything
-                if (identifier_to_find == compare_to || identifier_should_match_all)
+                // Otherwise compare in place, the identifier can't match if it would run past the end of the input
+                if (!identifier_should_match_all &&
+                    (global_cursor + identifier_size > input_size || File::StringViewType{c, identifier_size} != identifier_to_find))
+                {
+                    continue;
+                }
+
+                for (const auto& rule : token.get_rules())
+                {
+                    advance_cursor_by = rule->exec(token, c, global_cursor, *this);
+
+                    if (advance_cursor_by == -1)
+                    {
+                        all_rules_obeyed = false;
+                    }
+                }
+
+                if (all_rules_obeyed)
                 {
-                    for (const auto& rule : token.get_rules())
+                    token_found = {.token = &token, .matched_anything = identifier_should_match_all};
+                    token_found.token->m_start = global_cursor;
+
+                    if (identifier_size > 1)
                     {
-                        advance_cursor_by = rule->exec(token, c, global_cursor, *this);
+                        advance_cursor_by += static_cast<int>(advance_cursor_by == -1 ? identifier_size : identifier_size - 1);
+                    }
 
-                        if (advance_cursor_by == -1)
-                        {
-                            all_rules_obeyed = false;
-                        }
+                    if (advance_cursor_by > 0)
+                    {
+                        c += advance_cursor_by;
+                        global_cursor += advance_cursor_by;
+                        m_current_column += advance_cursor_by;
                     }
 
-                    if (all_rules_obeyed /* && !identifier_should_match_all*/)
+                    token_found.token->m_end = global_cursor;
+
+                    if (!identifier_should_match_all)
                     {
-                        // current_empty_token.clear();
-                        token_found = {.token = &token, .matched_anything = identifier_should_match_all};
-                        token_found.token->m_start = global_cursor;
-
-                        if (identifier_size > 1)
-                        {
-                            advance_cursor_by += static_cast<int>(advance_cursor_by == -1 ? identifier_size : identifier_size - 1);
-                        }
-
-                        if (advance_cursor_by > 0)
-                        {
-                            c += advance_cursor_by;
-                            global_cursor += advance_cursor_by;
-                            m_current_column += advance_cursor_by;
-                        }
-
-                        token_found.token->m_end = global_cursor;
-
-                        if (!identifier_should_match_all)
-                        {
-                            break;
-                        }
+                        break;
                     }
                 }
             }
@@ -194,7 +195,6 @@ namespace RC::ParserBase
                         start_of_empty_token_set = true;
                     }
 
-                    empty_token_data += *c;
                     empty_token = token_found;
                 }
                 else
@@ -204,7 +204,6 @@ namespace RC::ParserBase
                     token_found.token->m_line = m_current_line;
                     token_found.token->m_column = m_current_column;
                     m_tokens_in_input.emplace_back(*token_found.token);
-                    a.clear();
                 }
             }
         }
@@ -0,0 +1,69 @@
+#include <ParserBase/Token.hpp>
+#include <ParserBase/Tokenizer.hpp>
+#include <TestHarness/TestHarness.hpp>
+
+using namespace RC;
+using namespace RC::TestHarness;
+
+// The token set of the Ini parser
+enum IniTokenType : int
+{
+    CarriageReturn,
+    NewLine,
+    Space,
+    Characters,
+    Equals,
+    ClosingSquareBracket,
+    OpeningSquareBracket,
+    SemiColon,
+    EndOfFile,
+};
+
+static auto create_ini_tokens() -> ParserBase::TokenContainer
+{
+    ParserBase::TokenContainer tc;
+    tc.add(ParserBase::Token::create(IniTokenType::CarriageReturn, STR("CarriageReturn"), STR("\r")));
+    tc.add(ParserBase::Token::create(IniTokenType::NewLine, STR("NewLine"), STR("\n")));
+    tc.add(ParserBase::Token::create(IniTokenType::Space, STR("Space"), STR(" ")));
+    tc.add(ParserBase::Token::create(IniTokenType::Characters, STR("Characters"), STR(""), ParserBase::Token::HasData::Yes));
+    tc.add(ParserBase::Token::create(IniTokenType::Equals, STR("Equals"), STR("=")));
+    tc.add(ParserBase::Token::create(IniTokenType::ClosingSquareBracket, STR("CloseSquareBracket"), STR("]")));
+    tc.add(ParserBase::Token::create(IniTokenType::OpeningSquareBracket, STR("OpenSquareBracket"), STR("[")));
+    tc.add(ParserBase::Token::create(IniTokenType::SemiColon, STR("SemiColon"), STR(";")));
+    tc.set_eof_token(IniTokenType::EndOfFile);
+    return tc;
+}
+
+// Tokenizer throughput on input shaped like MemberVariableLayout.ini, sections of offsets with comments
+int main()
+{
+    File::StringType input{};
+    for (int section = 0; section < 500; ++section)
+    {
+        input.append(STR("; Offsets of a class\r\n[UObjectBase_"));
+        input.append(std::to_wstring(section));
+        input.append(STR("]\r\n"));
+        for (int key = 0; key < 20; ++key)
+        {
+            input.append(STR("MemberVariable"));
+            input.append(std::to_wstring(key));
+            input.append(STR(" = 0x"));
+            input.append(std::to_wstring(key * 8));
+            input.append(STR("\r\n"));
+        }
+    }
+
+    size_t num_tokens{};
+    auto num_bytes = input.size() * sizeof(File::CharType);
+    benchmark_throughput("Tokenizer, Ini token set, 10k keys", num_bytes, 10, [&] {
+        ParserBase::Tokenizer tokenizer;
+        tokenizer.set_available_tokens(create_ini_tokens());
+        tokenizer.tokenize(input);
+        num_tokens = tokenizer.get_tokens().size();
+        do_not_optimize(num_tokens);
+    });
+    // Every key line is 'Characters Space Equals Space Characters CarriageReturn NewLine'
+    CHECK(num_tokens > 500 * 20 * 7);
+
+    return report();
+}
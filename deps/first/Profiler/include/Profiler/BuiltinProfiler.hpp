@@ -0,0 +1,401 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <unordered_set>
+#include <vector>
+
+namespace RC::Profiler
+{
+    /*
+        Built-in profiler, used by the 'Builtin' profiler flavor
+
+        Unlike Tracy and Superluminal it's part of every build configuration, a scope costs a single relaxed load until recording is started at runtime
+        While recording, every scope writes one event with its begin and end time into a ring buffer owned by the current thread when it ends
+        Recording never locks or allocates after a thread's first event, old events are overwritten once a buffer wraps
+        'dump_chrome_trace' writes the events currently held in every buffer as a Chrome trace, it can be opened in ui.perfetto.dev or chrome://tracing
+
+        Scope names are stored as pointers, they must outlive the dump
+        Names passed to transient scopes are copied, once per distinct name and thread
+    */
+    struct ProfilerEvent
+    {
+        const char* name;
+        int64_t begin_ns;
+        // Negative for instant events such as frame marks
+        int64_t duration_ns;
+    };
+
+    class BuiltinProfiler
+    {
+      public:
+        constexpr static size_t events_per_thread = 1 << 16;
+
+      private:
+        struct TransientNameHash
+        {
+            using is_transparent = void;
+            auto operator()(std::string_view name) const -> size_t
+            {
+                return std::hash<std::string_view>{}(name);
+            }
+        };
+
+        struct ThreadBuffer
+        {
+            uint64_t thread_id{};
+            // Guarded by 'm_buffers_mutex'
+            std::string thread_name{};
+            std::unique_ptr<ProfilerEvent[]> events{std::make_unique<ProfilerEvent[]>(events_per_thread)};
+            // Total number of events ever written, the newest event is at (write_count - 1) % events_per_thread
+            std::atomic<uint64_t> write_count{};
+            // Value of 'write_count' when the buffer was last cleared, older events aren't part of dumps
+            std::atomic<uint64_t> cleared_count{};
+            // Owning thread only, set nodes never move so events can keep pointing at the names
+            std::unordered_set<std::string, TransientNameHash, std::equal_to<>> transient_names{};
+        };
+
+        struct ThreadSnapshot
+        {
+            uint64_t thread_id{};
+            std::string thread_name{};
+            std::vector<ProfilerEvent> events{};
+        };
+
+      private:
+        // Outside of the instance so that checking it never goes through a function-local static
+        inline static std::atomic<bool> s_is_recording{};
+
+        std::mutex m_buffers_mutex{};
+        std::vector<std::unique_ptr<ThreadBuffer>> m_buffers{};
+
+      public:
+        auto static get() -> BuiltinProfiler&
+        {
+            static BuiltinProfiler profiler{};
+            return profiler;
+        }
+
+        auto static is_recording() -> bool
+        {
+            return s_is_recording.load(std::memory_order_relaxed);
+        }
+
+        auto static now() -> int64_t
+        {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+        }
+
+      public:
+        auto start() -> void
+        {
+            s_is_recording = true;
+        }
+
+        auto stop() -> void
+        {
+            s_is_recording = false;
+        }
+
+        auto clear() -> void
+        {
+            // Buffers are never freed because each recording thread caches a pointer to its own
+            std::scoped_lock lock(m_buffers_mutex);
+            for (const auto& buffer : m_buffers)
+            {
+                buffer->cleared_count = buffer->write_count.load(std::memory_order_acquire);
+            }
+        }
+
+        auto record(const char* name, int64_t begin_ns, int64_t duration_ns) -> void
+        {
+            auto buffer = get_thread_buffer();
+            auto write_count = buffer->write_count.load(std::memory_order_relaxed);
+            buffer->events[write_count % events_per_thread] = {name, begin_ns, duration_ns};
+            buffer->write_count.store(write_count + 1, std::memory_order_release);
+        }
+
+        auto mark_frame(const char* name) -> void
+        {
+            if (is_recording())
+            {
+                record(name, now(), -1);
+            }
+        }
+
+        // Returns a copy of 'name' that lives as long as the profiler
+        auto intern_transient_name(std::string_view name) -> const char*
+        {
+            auto& transient_names = get_thread_buffer()->transient_names;
+            if (auto it = transient_names.find(name); it != transient_names.end())
+            {
+                return it->c_str();
+            }
+            return transient_names.emplace(name).first->c_str();
+        }
+
+        auto set_thread_name(std::string_view name) -> void
+        {
+            auto buffer = get_thread_buffer();
+            std::scoped_lock lock(m_buffers_mutex);
+            buffer->thread_name = name;
+        }
+
+        // Number of events currently held across all threads
+        auto get_num_events() -> size_t
+        {
+            std::scoped_lock lock(m_buffers_mutex);
+            size_t num_events{};
+            for (const auto& buffer : m_buffers)
+            {
+                auto write_count = buffer->write_count.load(std::memory_order_acquire);
+                num_events += static_cast<size_t>(std::min<uint64_t>(write_count - buffer->cleared_count.load(), events_per_thread));
+            }
+            return num_events;
+        }
+
+        // Safe to call while recording, events that could have been overwritten during the copy are dropped
+        // Throws std::runtime_error if the file can't be written
+        auto dump_chrome_trace(const std::filesystem::path& path) -> void
+        {
+            auto snapshots = snapshot();
+
+            // Timestamps are made relative to the first event so that they stay readable
+            auto first_ns = INT64_MAX;
+            for (const auto& thread_snapshot : snapshots)
+            {
+                for (const auto& event : thread_snapshot.events)
+                {
+                    first_ns = std::min(first_ns, event.begin_ns);
+                }
+            }
+
+            if (path.has_parent_path())
+            {
+                std::filesystem::create_directories(path.parent_path());
+            }
+            std::ofstream stream{path, std::ios::binary};
+            if (!stream)
+            {
+                throw std::runtime_error{"Could not open '" + path.string() + "' for writing"};
+            }
+
+            stream << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+            bool is_first_event = true;
+            auto begin_event = [&](std::string_view phase, std::string_view name, uint64_t thread_id) {
+                stream << (is_first_event ? "\n" : ",\n") << "{\"ph\":\"" << phase << "\",\"pid\":0,\"tid\":" << thread_id << ",\"name\":";
+                write_json_string(stream, name);
+                is_first_event = false;
+            };
+
+            for (const auto& thread_snapshot : snapshots)
+            {
+                if (!thread_snapshot.thread_name.empty())
+                {
+                    begin_event("M", "thread_name", thread_snapshot.thread_id);
+                    stream << ",\"args\":{\"name\":";
+                    write_json_string(stream, thread_snapshot.thread_name);
+                    stream << "}}";
+                }
+
+                for (const auto& event : thread_snapshot.events)
+                {
+                    char timestamp[64]{};
+                    if (event.duration_ns < 0)
+                    {
+                        begin_event("i", event.name, thread_snapshot.thread_id);
+                        std::snprintf(timestamp, sizeof(timestamp), ",\"s\":\"t\",\"ts\":%.3f}", (event.begin_ns - first_ns) / 1000.0);
+                    }
+                    else
+                    {
+                        begin_event("X", event.name, thread_snapshot.thread_id);
+                        std::snprintf(timestamp, sizeof(timestamp), ",\"ts\":%.3f,\"dur\":%.3f}", (event.begin_ns - first_ns) / 1000.0, event.duration_ns / 1000.0);
+                    }
+                    stream << timestamp;
+                }
+            }
+            stream << "\n]}\n";
+
+            if (!stream)
+            {
+                throw std::runtime_error{"Could not write '" + path.string() + "'"};
+            }
+        }
+
+      private:
+        auto get_thread_buffer() -> ThreadBuffer*
+        {
+            thread_local ThreadBuffer* buffer = register_thread();
+            return buffer;
+        }
+
+        auto register_thread() -> ThreadBuffer*
+        {
+            std::stringstream thread_id_stream{};
+            thread_id_stream << std::this_thread::get_id();
+
+            auto buffer = std::make_unique<ThreadBuffer>();
+            thread_id_stream >> buffer->thread_id;
+
+            std::scoped_lock lock(m_buffers_mutex);
+            return m_buffers.emplace_back(std::move(buffer)).get();
+        }
+
+        auto snapshot() -> std::vector<ThreadSnapshot>
+        {
+            std::scoped_lock lock(m_buffers_mutex);
+            std::vector<ThreadSnapshot> snapshots{};
+            for (const auto& buffer : m_buffers)
+            {
+                auto cleared_count = buffer->cleared_count.load();
+                auto end = buffer->write_count.load(std::memory_order_acquire);
+                auto begin = std::max(cleared_count, end > events_per_thread ? end - events_per_thread : 0);
+
+                // Copied as at most two contiguous ranges to keep the window in which the owning thread can lap us small
+                std::vector<ProfilerEvent> events(static_cast<size_t>(end - begin));
+                auto first_slot = static_cast<size_t>(begin % events_per_thread);
+                auto num_before_wrap = std::min(events.size(), events_per_thread - first_slot);
+                std::memcpy(events.data(), &buffer->events[first_slot], num_before_wrap * sizeof(ProfilerEvent));
+                std::memcpy(events.data() + num_before_wrap, &buffer->events[0], (events.size() - num_before_wrap) * sizeof(ProfilerEvent));
+
+                // The owning thread kept writing during the copy, anything it may have overwritten in the meantime is dropped
+                // One extra event is dropped for the slot that may have been mid-write
+                // The fence keeps the copy from being reordered after the load below
+                std::atomic_thread_fence(std::memory_order_acquire);
+                auto end_after_copy = buffer->write_count.load(std::memory_order_acquire);
+                if (end_after_copy + 1 > begin + events_per_thread)
+                {
+                    auto num_overwritten = std::min<uint64_t>(end_after_copy + 1 - (begin + events_per_thread), events.size());
+                    events.erase(events.begin(), events.begin() + static_cast<ptrdiff_t>(num_overwritten));
+                }
+
+                if (!events.empty() || !buffer->thread_name.empty())
+                {
+                    snapshots.emplace_back(ThreadSnapshot{buffer->thread_id, buffer->thread_name, std::move(events)});
+                }
+            }
+            return snapshots;
+        }
+
+        auto static write_json_string(std::ostream& stream, std::string_view string) -> void
+        {
+            stream << '"';
+            for (auto ch : string)
+            {
+                switch (ch)
+                {
+                case '"':
+                    stream << "\\\"";
+                    break;
+                case '\\':
+                    stream << "\\\\";
+                    break;
+                case '\n':
+                    stream << "\\n";
+                    break;
+                case '\t':
+                    stream << "\\t";
+                    break;
+                default:
+                    if (static_cast<unsigned char>(ch) < 0x20)
+                    {
+                        char escaped[8]{};
+                        std::snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned char>(ch));
+                        stream << escaped;
+                    }
+                    else
+                    {
+                        stream << ch;
+                    }
+                    break;
+                }
+            }
+            stream << '"';
+        }
+    };
+
+    // Records the time between its construction and destruction, does nothing unless the profiler was recording when it was constructed
+    class Scope
+    {
+      private:
+        const char* m_name{};
+        int64_t m_begin_ns{};
+
+      public:
+        explicit Scope(const char* name, bool is_active = true)
+        {
+            if (is_active && BuiltinProfiler::is_recording())
+            {
+                m_name = name;
+                m_begin_ns = BuiltinProfiler::now();
+            }
+        }
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+        ~Scope()
+        {
+            if (m_name)
+            {
+                BuiltinProfiler::get().record(m_name, m_begin_ns, BuiltinProfiler::now() - m_begin_ns);
+            }
+        }
+    };
+
+    // Same as Scope for names that don't outlive the scope
+    class TransientScope
+    {
+      private:
+        const char* m_name{};
+        int64_t m_begin_ns{};
+
+      public:
+        explicit TransientScope(std::string_view name, bool is_active = true)
+        {
+            if (is_active && BuiltinProfiler::is_recording())
+            {
+                m_name = BuiltinProfiler::get().intern_transient_name(name);
+                m_begin_ns = BuiltinProfiler::now();
+            }
+        }
+
+        // 'get_name' is only called while recording, used by 'ProfilerTransientScopeNamed' so that names are free to build otherwise
+        template <typename NameGetter>
+            requires std::is_invocable_r_v<std::string_view, NameGetter&>
+        explicit TransientScope(NameGetter&& get_name, bool is_active = true)
+        {
+            if (is_active && BuiltinProfiler::is_recording())
+            {
+                m_name = BuiltinProfiler::get().intern_transient_name(get_name());
+                m_begin_ns = BuiltinProfiler::now();
+            }
+        }
+
+        TransientScope(const TransientScope&) = delete;
+        TransientScope& operator=(const TransientScope&) = delete;
+
+        ~TransientScope()
+        {
+            if (m_name)
+            {
+                BuiltinProfiler::get().record(m_name, m_begin_ns, BuiltinProfiler::now() - m_begin_ns);
+            }
+        }
+    };
+} // namespace RC::Profiler
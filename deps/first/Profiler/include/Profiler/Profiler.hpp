@@ -1,6 +1,27 @@
 #pragma once
 
-#if STATS && !DISABLE_PROFILER
+// The builtin profiler is recorded at runtime on demand, so unlike the other flavors it's available without STATS
+#if !DISABLE_PROFILER && IS_BUILTIN
+
+#include <Profiler/BuiltinProfiler.hpp>
+
+#define RC_PROFILER_CONCAT_IMPL(a, b) a##b
+#define RC_PROFILER_CONCAT(a, b) RC_PROFILER_CONCAT_IMPL(a, b)
+
+#define ProfilerFrameMark() ::RC::Profiler::BuiltinProfiler::get().mark_frame("Frame")
+#define ProfilerFrameMarkNamed(name) ::RC::Profiler::BuiltinProfiler::get().mark_frame(name)
+
+#define ProfilerScope() ::RC::Profiler::Scope RC_PROFILER_CONCAT(rc_profiler_scope_, __LINE__)(__FUNCTION__)
+// 'name' is only evaluated while recording
+#define ProfilerTransientScopeNamed(scope, name, active)                                                                                                       \
+    ::RC::Profiler::TransientScope scope([&]() -> decltype(auto) { return (name); }, active)
+#define ProfilerScopeNamed(name) ::RC::Profiler::Scope RC_PROFILER_CONCAT(rc_profiler_scope_, __LINE__)(name)
+#define ProfilerScopeColor(color) ProfilerScope()
+#define ProfilerScopeNameColor(name, color) ProfilerScopeNamed(name)
+
+#define ProfilerSetThreadName(name) ::RC::Profiler::BuiltinProfiler::get().set_thread_name(name)
+
+#elif STATS && !DISABLE_PROFILER
 
 #if IS_TRACY
 
@@ -0,0 +1,39 @@
+#include <string>
+
+#include <Profiler/Profiler.hpp>
+#include <TestHarness/TestHarness.hpp>
+
+using namespace RC::Profiler;
+using namespace RC::TestHarness;
+
+// Cost of the profiler macros per scope, they're left in hot paths so the idle cost matters most
+int main()
+{
+    constexpr size_t num_iterations = 1'000'000;
+    auto& profiler = BuiltinProfiler::get();
+    std::string transient_name = "transient scope";
+
+    profiler.clear();
+    benchmark("ProfilerScopeNamed, idle", num_iterations, [] {
+        ProfilerScopeNamed("scope");
+    });
+    benchmark("ProfilerTransientScopeNamed, idle", num_iterations, [&] {
+        ProfilerTransientScopeNamed(scope, transient_name + " built", true);
+    });
+
+    profiler.start();
+    benchmark("ProfilerScopeNamed, recording", num_iterations, [] {
+        ProfilerScopeNamed("scope");
+    });
+    benchmark("ProfilerTransientScopeNamed, recording", num_iterations, [&] {
+        ProfilerTransientScopeNamed(scope, transient_name, true);
+    });
+    benchmark("ProfilerTransientScopeNamed, recording, inactive", num_iterations, [&] {
+        ProfilerTransientScopeNamed(scope, transient_name, false);
+    });
+    profiler.stop();
+    CHECK(profiler.get_num_events() == BuiltinProfiler::events_per_thread);
+    profiler.clear();
+
+    return report();
+}
@@ -0,0 +1,168 @@
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <thread>
+
+#include <Profiler/Profiler.hpp>
+#include <TestHarness/TestHarness.hpp>
+
+using namespace RC::Profiler;
+using RC::TestHarness::throws;
+
+static auto read_file(const std::filesystem::path& path) -> std::string
+{
+    std::ifstream stream{path, std::ios::binary};
+    return {std::istreambuf_iterator<char>{stream}, std::istreambuf_iterator<char>{}};
+}
+
+static auto count_occurrences(std::string_view string, std::string_view substring) -> size_t
+{
+    size_t count{};
+    for (auto pos = string.find(substring); pos != string.npos; pos = string.find(substring, pos + substring.size()))
+    {
+        ++count;
+    }
+    return count;
+}
+
+static auto test_wraparound(const std::filesystem::path& path) -> void
+{
+    auto& profiler = BuiltinProfiler::get();
+    profiler.clear();
+
+    // Begin times are the event index so that the oldest event left after wrapping can be told apart
+    constexpr int64_t num_overwritten = 100;
+    for (int64_t i = 0; i < static_cast<int64_t>(BuiltinProfiler::events_per_thread) + num_overwritten; ++i)
+    {
+        profiler.record("wraparound", i, 1);
+    }
+    CHECK(profiler.get_num_events() == BuiltinProfiler::events_per_thread);
+
+    // Dumps of a full buffer leave out its oldest event, it's in the slot the owning thread writes next
+    profiler.dump_chrome_trace(path);
+    auto trace = read_file(path);
+    CHECK(count_occurrences(trace, "\"name\":\"wraparound\"") == BuiltinProfiler::events_per_thread - 1);
+    // Timestamps are relative to the oldest event that's dumped, the newest one is 'events_per_thread - 2' ns later
+    CHECK(count_occurrences(trace, "\"ts\":0.000,") == 1);
+    CHECK(count_occurrences(trace, "\"ts\":65.534,") == 1);
+    CHECK(trace.ends_with("\n]}\n"));
+
+    profiler.clear();
+    CHECK(profiler.get_num_events() == 0);
+}
+
+static auto test_dump_while_recording(const std::filesystem::path& path) -> void
+{
+    auto& profiler = BuiltinProfiler::get();
+    profiler.clear();
+    profiler.start();
+
+    std::atomic<bool> keep_recording{true};
+    std::thread worker{[&] {
+        profiler.set_thread_name("worker");
+        while (keep_recording)
+        {
+            ProfilerScopeNamed("worker scope");
+        }
+    }};
+
+    for (int i = 0; i < 5; ++i)
+    {
+        profiler.dump_chrome_trace(path);
+        auto trace = read_file(path);
+        auto num_events = count_occurrences(trace, "{\"ph\":\"X\"");
+        CHECK(num_events <= BuiltinProfiler::events_per_thread);
+        // Every complete event must have come from the worker, a torn copy would show up as another name or a bad pointer
+        CHECK(count_occurrences(trace, "\"name\":\"worker scope\"") == num_events);
+        CHECK(trace.ends_with("\n]}\n"));
+    }
+
+    keep_recording = false;
+    worker.join();
+    profiler.stop();
+    profiler.clear();
+}
+
+static auto test_json_escaping(const std::filesystem::path& path) -> void
+{
+    auto& profiler = BuiltinProfiler::get();
+    profiler.clear();
+    profiler.start();
+
+    std::thread worker{[&] {
+        profiler.set_thread_name("quote\" backslash\\ newline\n tab\t control\x01");
+        ProfilerTransientScopeNamed(scope, std::string{"transient \"name\""}, true);
+    }};
+    worker.join();
+
+    profiler.stop();
+    profiler.dump_chrome_trace(path);
+    auto trace = read_file(path);
+    CHECK(count_occurrences(trace, R"("name":"quote\" backslash\\ newline\n tab\t control\u0001")") == 1);
+    CHECK(count_occurrences(trace, R"("name":"transient \"name\"")") == 1);
+    profiler.clear();
+}
+
+static auto test_transient_name_is_lazy() -> void
+{
+    auto& profiler = BuiltinProfiler::get();
+    int num_names_built{};
+    auto build_name = [&] {
+        ++num_names_built;
+        return std::string{"lazy"};
+    };
+
+    {
+        ProfilerTransientScopeNamed(scope, build_name(), true);
+    }
+    CHECK(num_names_built == 0);
+
+    profiler.start();
+    {
+        ProfilerTransientScopeNamed(scope, build_name(), false);
+    }
+    CHECK(num_names_built == 0);
+    {
+        ProfilerTransientScopeNamed(scope, build_name(), true);
+    }
+    CHECK(num_names_built == 1);
+    profiler.stop();
+    profiler.clear();
+}
+
+static auto test_unwritable_path(const std::filesystem::path& directory) -> void
+{
+    auto& profiler = BuiltinProfiler::get();
+
+    // The path is an existing directory
+    CHECK(throws([&] {
+        profiler.dump_chrome_trace(directory);
+    }));
+
+    // The parent is a regular file
+    auto file = directory / "not_a_directory";
+    std::ofstream{file} << "file";
+    CHECK(throws([&] {
+        profiler.dump_chrome_trace(file / "trace.json");
+    }));
+}
+
+int main()
+{
+    auto directory = std::filesystem::temp_directory_path() / "BuiltinProfilerTests";
+    std::filesystem::create_directories(directory);
+    auto path = directory / "trace.json";
+
+    test_wraparound(path);
+    test_dump_while_recording(path);
+    test_json_escaping(path);
+    test_transient_name_is_lazy();
+    test_unwritable_path(directory);
+
+    std::filesystem::remove_all(directory);
+
+    return RC::TestHarness::report();
+}
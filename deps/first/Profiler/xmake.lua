@@ -6,7 +6,7 @@ add_requires("Superluminal", { system = true, optional = true, debug = is_mode_d
 option("profilerFlavor")
     set_default("Tracy")
     set_showmenu(true)
-    set_values("Tracy", "Superluminal", "None")
+    set_values("Tracy", "Superluminal", "Builtin", "None")
 
 target(projectName)
     set_kind("headeronly")
@@ -23,12 +23,14 @@ target(projectName)
 
         if flavor == "Tracy" then
             target:add("packages", "Tracy", { public = true })
-            target:add("defines", "IS_TRACY=1", "IS_SUPERLUMINAL=0", { public = true })
+            target:add("defines", "IS_TRACY=1", "IS_SUPERLUMINAL=0", "IS_BUILTIN=0", { public = true })
         elseif flavor == "Superluminal" then
             target:add("packages", "Superluminal", { public = true })
-            target:add("defines", "IS_TRACY=0", "IS_SUPERLUMINAL=1", { public = true })
+            target:add("defines", "IS_TRACY=0", "IS_SUPERLUMINAL=1", "IS_BUILTIN=0", { public = true })
+        elseif flavor == "Builtin" then
+            target:add("defines", "IS_TRACY=0", "IS_SUPERLUMINAL=0", "IS_BUILTIN=1", { public = true })
         elseif flavor == "None" then
-            target:add("defines", "IS_TRACY=0", "IS_SUPERLUMINAL=0", "DISABLE_PROFILER", { public = true })
+            target:add("defines", "IS_TRACY=0", "IS_SUPERLUMINAL=0", "IS_BUILTIN=0", "DISABLE_PROFILER", { public = true })
         end
     end)
     
\ No newline at end of file
@@ -0,0 +1,99 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <limits>
+#include <stdexcept>
+#include <string_view>
+
+// Shared by every test and benchmark executable
+// Tests are standalone executables that return 'report()' from main, it's non-zero when a check failed
+namespace RC::TestHarness
+{
+    inline int num_failures{};
+
+    inline auto fail(const char* file, int line, const char* condition) -> void
+    {
+        std::printf("%s:%d: CHECK(%s) failed\n", file, line, condition);
+        ++num_failures;
+    }
+
+    template <typename Callable>
+    auto throws(Callable callable) -> bool
+    {
+        try
+        {
+            callable();
+        }
+        catch (const std::runtime_error&)
+        {
+            return true;
+        }
+        return false;
+    }
+
+    inline auto report() -> int
+    {
+        if (num_failures)
+        {
+            std::printf("%d check(s) failed\n", num_failures);
+            return 1;
+        }
+        std::printf("All checks passed\n");
+        return 0;
+    }
+
+    // Keeps the compiler from optimizing away a benchmarked result
+    inline const void* volatile g_sink{};
+    template <typename T>
+    auto do_not_optimize(const T& value) -> void
+    {
+        g_sink = &value;
+    }
+
+    // Runs 'callable' 'num_iterations' times per run and returns the nanoseconds per iteration of the fastest run
+    template <typename Callable>
+    auto measure(size_t num_iterations, Callable&& callable) -> double
+    {
+        constexpr int num_runs = 5;
+        callable();
+        auto fastest = std::numeric_limits<double>::max();
+        for (int run = 0; run < num_runs; ++run)
+        {
+            auto start = std::chrono::steady_clock::now();
+            for (size_t i = 0; i < num_iterations; ++i)
+            {
+                callable();
+            }
+            std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+            fastest = std::min(fastest, elapsed.count() / static_cast<double>(num_iterations));
+        }
+        return fastest;
+    }
+
+    template <typename Callable>
+    auto benchmark(std::string_view name, size_t num_iterations, Callable&& callable) -> double
+    {
+        auto ns_per_iteration = measure(num_iterations, callable);
+        std::printf("%-56.*s %14.1f ns/op\n", static_cast<int>(name.size()), name.data(), ns_per_iteration);
+        return ns_per_iteration;
+    }
+
+    // Same as 'benchmark' for callables that process 'num_bytes' per iteration, also prints the throughput
+    template <typename Callable>
+    auto benchmark_throughput(std::string_view name, size_t num_bytes, size_t num_iterations, Callable&& callable) -> double
+    {
+        auto ns_per_iteration = measure(num_iterations, callable);
+        auto mb_per_second = static_cast<double>(num_bytes) / (1024.0 * 1024.0) / (ns_per_iteration / 1e9);
+        std::printf("%-56.*s %14.1f ns/op %10.1f MB/s\n", static_cast<int>(name.size()), name.data(), ns_per_iteration, mb_per_second);
+        return mb_per_second;
+    }
+} // namespace RC::TestHarness
+
+#define CHECK(condition)                                                                                                                                       \
+    if (!(condition))                                                                                                                                          \
+    {                                                                                                                                                          \
+        ::RC::TestHarness::fail(__FILE__, __LINE__, #condition);                                                                                               \
+    }